@@ -0,0 +1,58 @@
+/*
+ * Adaptive Refresh Scheduler
+ * Tự điều chỉnh chu kỳ poll theo độ biến động của metric
+ *
+ * Metric thay đổi nhanh (chơi game, build...) -> poll nhanh dần về minInterval.
+ * Metric đứng yên -> giãn dần về maxInterval. Chỉ dùng số nguyên (fixed10_t),
+ * không phụ thuộc phần cứng nên có thể chạy trên host với trace đã ghi.
+ */
+
+#ifndef ADAPTIVE_REFRESH_H
+#define ADAPTIVE_REFRESH_H
+
+#include <Arduino.h>
+#include "system_data.h"
+
+class AdaptiveRefresh {
+public:
+  // Volatility score thresholds (sum of per-metric deltas, fixed10_t points)
+  static constexpr fixed10_t FAST_THRESHOLD = 100;  // >= 10 points -> speed up
+  static constexpr fixed10_t SLOW_THRESHOLD = 20;   // <= 2 points  -> back off
+  static constexpr fixed10_t TERM_CAP = 300;        // Cap per metric (30 points)
+  
+  AdaptiveRefresh(uint16_t minMs = 500, uint16_t maxMs = 10000);
+  
+  // Bounds (from UserSettings); current interval is clamped into them
+  void setBounds(uint16_t minMs, uint16_t maxMs);
+  
+  // Feed one received sample; returns the next poll interval (ms)
+  uint16_t update(const SystemData& data, unsigned long nowMs);
+  
+  // Forget history (e.g. after mode switch)
+  void reset(unsigned long nowMs);
+  
+  uint16_t getInterval() const { return interval; }
+  fixed10_t getLastScore() const { return lastScore; }
+  
+  // Average polls per minute since reset(), x10 (e.g. 125 = 12.5/min)
+  fixed10_t getPollsPerMinute(unsigned long nowMs) const;
+  
+private:
+  uint16_t minInterval;
+  uint16_t maxInterval;
+  uint16_t interval;
+  
+  // Previous sample (only the fields that drive volatility)
+  bool hasPrev;
+  fixed10_t prevCpuLoad, prevGpuLoad, prevRamPercent, prevCpuTemp, prevNet;
+  fixed10_t lastScore;
+  
+  uint32_t polls;
+  unsigned long startMs;
+  
+  static fixed10_t term(fixed10_t now, fixed10_t prev);
+  fixed10_t score(const SystemData& data) const;
+  void remember(const SystemData& data);
+};
+
+#endif // ADAPTIVE_REFRESH_H
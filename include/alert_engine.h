@@ -0,0 +1,86 @@
+/*
+ * Alert Engine Module
+ * Luật cảnh báo theo ngưỡng cho từng metric: ngưỡng bật, ngưỡng tắt (hysteresis),
+ * thời gian duy trì. Chạy mỗi lần nhận sample, điều khiển viền tile / nháy màn hình / nhấp nháy đèn nền.
+ *
+ * - Số luật cố định (ALERT_RULE_MAX), trạng thái trong mảng tĩnh: O(1) mỗi sample, không cấp phát
+ * - Không phụ thuộc WiFi/phần cứng - chạy được trên host (tools/replay --alert)
+ */
+
+#ifndef ALERT_ENGINE_H
+#define ALERT_ENGINE_H
+
+#include <Arduino.h>
+#include "system_data.h"
+
+#ifndef ALERT_RULE_MAX
+  #define ALERT_RULE_MAX 6
+#endif
+
+// Metrics a rule can watch (values are fixed10_t, same units as SystemData)
+enum AlertMetric : uint8_t {
+  ALERT_CPU_TEMP = 0,
+  ALERT_CPU_LOAD,
+  ALERT_GPU_TEMP,
+  ALERT_GPU_LOAD,
+  ALERT_RAM_LOAD,
+  ALERT_DISK_TEMP,   // Hottest disk
+  ALERT_NET_TOTAL,   // Up + down over all NICs (Mb/s)
+  ALERT_METRIC_COUNT
+};
+
+// What an active rule does (bit flags, 0 = rule slot unused)
+enum AlertAction : uint8_t {
+  ALERT_HIGHLIGHT = 1 << 0,  // Alert border on the metric's tile
+  ALERT_FLASH     = 1 << 1,  // Invert the whole screen for a few seconds when it trips
+  ALERT_PULSE     = 1 << 2   // Pulse the backlight while it stays active
+};
+
+// One rule as stored in the settings EEPROM block (see SettingsManager)
+struct AlertRule {
+  uint8_t metric;     // AlertMetric
+  uint8_t actions;    // AlertAction bits
+  int16_t raiseAt;    // Trips at >= raiseAt (x10), or <= when clearAt > raiseAt (low alarm)
+  int16_t clearAt;    // Clears strictly past this value (x10) - the gap is the hysteresis
+  uint8_t sustainS;   // Seconds the value must stay past raiseAt before tripping
+};
+
+class AlertEngine {
+public:
+  AlertEngine();
+
+  // Replace the rule set (state restarts; slots with actions == 0 are ignored)
+  void setRules(const AlertRule* rules, uint8_t count);
+
+  // Evaluate one sample. Returns true when any rule tripped or cleared.
+  bool update(const SystemData& data, unsigned long now);
+
+  uint8_t getActions() const { return activeActions; }       // Union over active rules
+  uint8_t getRaisedActions() const { return raisedActions; } // Rules that tripped in the last update()
+  uint16_t getHighlightMask() const { return highlightMask; } // Bit per AlertMetric with a highlighted alert
+  uint8_t getRuleCount() const { return ruleCount; }                  // Slots, including unused ones
+  const AlertRule& getRule(uint8_t i) const { return rules[i]; }
+  bool isEnabled(uint8_t i) const;
+  bool isActive(uint8_t i) const { return state[i].active; }
+
+  // Metric table (names are the keys used by /alerts and tools/replay)
+  static fixed10_t metricValue(const SystemData& data, uint8_t metric);
+  static const char* metricName(uint8_t metric);
+  static int8_t metricFromName(const char* name);  // -1 = unknown
+
+private:
+  struct RuleState {
+    bool active;
+    bool pending;          // Past raiseAt, waiting for sustainS
+    unsigned long since;   // When pending started
+  };
+
+  AlertRule rules[ALERT_RULE_MAX];
+  RuleState state[ALERT_RULE_MAX];
+  uint8_t ruleCount;
+  uint8_t activeActions;
+  uint8_t raisedActions;
+  uint16_t highlightMask;
+};
+
+#endif // ALERT_ENGINE_H
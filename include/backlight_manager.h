@@ -0,0 +1,80 @@
+/*
+ * Backlight Manager Module
+ * PWM backlight với fade mượt và timeline idle: sáng -> mờ -> tắt
+ *
+ * Timeline được reset mỗi khi có hoạt động (nút bấm). Fade không chặn loop -
+ * gọi update() thường xuyên trong loop().
+ */
+
+#ifndef BACKLIGHT_MANAGER_H
+#define BACKLIGHT_MANAGER_H
+
+#include <Arduino.h>
+
+#ifndef BACKLIGHT_TIMEOUT
+  #define BACKLIGHT_TIMEOUT 0  // 0 = never turn off
+#endif
+
+#ifndef BACKLIGHT_DIM_TIMEOUT
+  #define BACKLIGHT_DIM_TIMEOUT (BACKLIGHT_TIMEOUT / 2)  // 0 = never dim
+#endif
+
+#ifndef BACKLIGHT_FADE_MS
+  #define BACKLIGHT_FADE_MS 400
+#endif
+
+enum BacklightState {
+  BACKLIGHT_FULL = 0,
+  BACKLIGHT_DIM,
+  BACKLIGHT_OFF
+};
+
+class BacklightManager {
+public:
+  static constexpr uint8_t DEFAULT_FULL = 255;
+  static constexpr uint8_t DEFAULT_DIM = 40;
+  
+  BacklightManager(uint8_t pin);
+  
+  void begin();
+  void update();  // Advance fade + idle timeline (call in loop)
+  
+  // Button / user activity - restart the idle timeline.
+  // Returns true if the backlight was off (screen content is stale).
+  bool noteActivity();
+  
+  // Manual control (menu / toggle)
+  void wake();
+  void sleep();
+  
+  // Alert pulse: swing between full and 1/4 while on (keeps the screen awake)
+  void setPulse(bool on);
+  
+  // Brightness levels (0-255)
+  void setLevels(uint8_t full, uint8_t dim);
+  uint8_t getFullLevel() const { return fullLevel; }
+  
+  BacklightState getState() const { return state; }
+  bool isOff() const { return state == BACKLIGHT_OFF; }
+  
+private:
+  uint8_t pin;
+  uint8_t fullLevel;
+  uint8_t dimLevel;
+  BacklightState state;
+  bool pulsing;
+  
+  // Fade
+  uint8_t current;
+  uint8_t fadeFrom;
+  uint8_t fadeTarget;
+  unsigned long fadeStart;
+  
+  unsigned long lastActivity;
+  
+  void fadeTo(uint8_t level);
+  void write(uint8_t level);
+  void enterState(BacklightState newState);
+};
+
+#endif // BACKLIGHT_MANAGER_H
@@ -0,0 +1,79 @@
+/*
+ * Bridge Discovery Module
+ * Tự tìm PC bridge qua mDNS (_hwmon._tcp) khi IP của PC thay đổi
+ *
+ * - Địa chỉ đã resolve vẫn nằm trong ConfigData (serverIP/port) - lúc bình
+ *   thường không query gì cả, chỉ dùng địa chỉ cache
+ * - Fetch lỗi -> request(): query chạy nền (không chặn loop), có kết quả thì
+ *   main cập nhật URL, vài giây là hồi phục thay vì phải vào lại config portal
+ * - Tên bridge (hostname PC) được nhớ trong EEPROM để chọn đúng máy khi LAN
+ *   có nhiều bridge
+ */
+
+#ifndef BRIDGE_DISCOVERY_H
+#define BRIDGE_DISCOVERY_H
+
+#include <Arduino.h>
+#include <ESP8266mDNS.h>
+
+#ifndef DISCOVERY_ENABLED
+  #define DISCOVERY_ENABLED true
+#endif
+
+#define DISCOVERY_EEPROM_OFFSET 128  // Between ConfigData (~120 bytes) and UserSettings (200)
+#define DISCOVERY_MAGIC 0x4244       // "BD"
+
+// EEPROM layout
+struct BridgeCacheData {
+  uint16_t magic;
+  char name[24];      // Hostname of the bridge we follow ("" = take any)
+  uint8_t checksum;
+};
+
+class BridgeDiscovery {
+public:
+  static constexpr unsigned long QUERY_TIMEOUT = 4000;      // Give up on a query after (ms)
+  static constexpr unsigned long REQUERY_INTERVAL = 30000;  // Min gap between background queries (ms)
+
+  BridgeDiscovery();
+
+  // Load the remembered bridge name (mDNS itself starts on the first query)
+  void begin(const char* deviceName);
+
+  // Start a background query (rate-limited, no-op while one is running)
+  void request();
+
+  // Pump mDNS and finish/expire the query (call each loop)
+  void handle();
+
+  // Address found by the last query (once)
+  bool takeResult(IPAddress& ip, uint16_t& port);
+
+  // Blocking lookup for the config portal
+  bool resolve(IPAddress& ip, uint16_t& port, unsigned long timeoutMs = QUERY_TIMEOUT);
+
+  bool isSearching() const { return query != nullptr; }
+
+  // Follow this bridge from now on (saved only when it changes)
+  void rememberBridge(const String& name);
+  const char* getBridgeName() const { return cache.name; }
+
+private:
+  BridgeCacheData cache;
+  const char* hostname;
+  MDNSResponder::hMDNSServiceQuery query;
+  unsigned long queryStartedAt;
+  unsigned long lastQuery;
+  bool found;
+  IPAddress foundIP;
+  uint16_t foundPort;
+
+  bool startQuery();
+  void stopQuery();
+  void onAnswer(const MDNSResponder::MDNSServiceInfo& info);
+  bool matches(const MDNSResponder::MDNSServiceInfo& info) const;
+
+  static uint8_t checksum(const BridgeCacheData& data);
+};
+
+#endif // BRIDGE_DISCOVERY_H
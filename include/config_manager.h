@@ -32,6 +32,7 @@ public:
   String getWiFiSSID() { return String(config.wifiSSID); }
   String getWiFiPassword() { return String(config.wifiPassword); }
   String getServerURL();
+  bool updateServerAddress(const char* ip, uint16_t port);  // Rediscovered bridge; saves only if changed
   
   bool hasValidConfig();
   bool isConfigMode() { return configMode; }
@@ -46,8 +47,12 @@ public:
   
   // Fallback detection
   bool shouldFallbackToConfig();
-  void reportServerFailure();  // Call this when server fetch fails
-  void reportServerSuccess();  // Call this when server fetch succeeds
+  
+  // Temporary AP while the server stays unreachable (stored config kept)
+  void startRecoveryAP();
+  void stopRecoveryAP();
+  bool handleRecoveryAP();     // True when a new server address was saved
+  bool isRecoveryAP() const { return recoveryAP; }
   
   // Display feedback (optional)
   void setDisplayManager(class DisplayManager* disp) { displayManager = disp; }
@@ -55,6 +60,9 @@ public:
   // Button handler for exit via long press
   void setButtonHandler(class ButtonHandler* btn) { buttonHandler = btn; }
   
+  // mDNS lookup when the portal's server address is left empty
+  void setDiscovery(class BridgeDiscovery* disc) { discovery = disc; }
+  
 private:
   // Display helpers
   void showReconnectDisplay();
@@ -79,17 +87,20 @@ private:
   const char* apPassword;
   
   // Validation state
-  String tempServerIP;
+  String tempServerIP;      // Empty = discover via mDNS
   uint16_t tempServerPort;
+  bool serverSubmitted;     // Server form posted
+  String tempHosts;         // Extra hosts (HostPoller list, saved with the config)
   String tempWiFiSSID;      // Store WiFi SSID from portal
   String tempWiFiPassword;  // Store WiFi password from portal
   int connectionFailCount;
-  int serverFailCount;
   unsigned long lastConnectionAttempt;
-  unsigned long lastServerCheck;
+  bool recoveryAP;
+  bool recoveryChanged;
   
   // Optional display feedback
   class DisplayManager* displayManager;
+  class BridgeDiscovery* discovery;
   class ButtonHandler* buttonHandler;
   
   // WiFiManager callbacks
@@ -99,6 +110,7 @@ private:
   // Web handlers for server config
   void handleRoot();
   void handleServerConfig();
+  void handleRecoveryServer();
   void handleCancel();
   void handleTestServer();
   void handleStatus();
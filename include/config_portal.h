@@ -1,20 +1,25 @@
 /*
- * Config Portal HTML Generators
- * Separated for better performance and maintainability
+ * Config Portal Pages
+ * Trang cấu hình nhúng sẵn trong PROGMEM (nguồn HTML trong web/)
  */
 
 #ifndef CONFIG_PORTAL_H
 #define CONFIG_PORTAL_H
 
 #include <Arduino.h>
+#include <ESP8266WebServer.h>
 
 class ConfigPortal {
 public:
-  // HTML generators
-  static String generateServerConfigHTML();
-  static String generateSuccessHTML(const String& apSSID, const String& serverIP, uint16_t serverPort);
-  static String generateTestingHTML();
-  static String generateErrorHTML(const char* error);
+  // Static pages (gzip)
+  static void sendServerConfigPage(ESP8266WebServer& server);
+  static void sendTestingPage(ESP8266WebServer& server);
+  static void sendCancelledPage(ESP8266WebServer& server);
+
+  // Templated pages (streamed)
+  static void sendSuccessPage(ESP8266WebServer& server, const char* apSSID,
+                              const char* serverIP, uint16_t serverPort);
+  static void sendErrorPage(ESP8266WebServer& server, const char* error);
 };
 
 #endif // CONFIG_PORTAL_H
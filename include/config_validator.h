@@ -16,6 +16,10 @@ public:
   
   // Test server connection
   static bool testServer(const char* serverIP, uint16_t serverPort, int timeout = 5000);
+  
+  // Check a typed server address without contacting it: host is an IP or name
+  // (letters, digits, '.', '-') shorter than maxLen, port empty (= 80) or 1-65535
+  static bool checkServer(const char* host, const char* portText, size_t maxLen, uint16_t& port);
 };
 
 #endif // CONFIG_VALIDATOR_H
@@ -0,0 +1,82 @@
+/*
+ * Crash Log Module
+ * Ghi lý do reset + trạng thái cuối của lần chạy trước vào ring buffer trên flash
+ *
+ * - Trong lúc chạy: stage hiện tại, uptime, free heap được ghi vào RTC memory
+ *   (không tốn flash, còn nguyên sau crash/watchdog/ESP.restart())
+ * - Khi crash: custom_crash_callback lưu vài địa chỉ code trên stack vào RTC
+ * - Mỗi lần boot: gộp reset reason + snapshot RTC thành 1 record 36 byte và
+ *   append vào sector flash cuối của vùng FS (không dùng filesystem). Chỉ xóa
+ *   sector khi đầy (~113 lần boot), giữ lại CAPACITY record mới nhất.
+ */
+
+#ifndef CRASH_LOG_H
+#define CRASH_LOG_H
+
+#include <Arduino.h>
+
+#ifndef CRASH_LOG_FLASH
+  #define CRASH_LOG_FLASH true  // Persist in the last FS sector (disable if you add LittleFS/SPIFFS)
+#endif
+
+#ifndef CRASH_RTC_OFFSET
+  #define CRASH_RTC_OFFSET 51   // RTC user memory block, right after HealthLog (16..50)
+#endif
+
+// Where loop() was when the run ended
+enum LoopStage : uint8_t {
+  STAGE_NONE = 0,     // Unknown (power-on)
+  STAGE_SETUP,
+  STAGE_INPUT,        // Button / backlight / menu timeout
+  STAGE_MENU,
+  STAGE_OTA_WEB,
+  STAGE_CONFIG,
+  STAGE_WIFI,
+  STAGE_OTA,
+  STAGE_FW_UPDATE,
+  STAGE_METRICS,
+  STAGE_FETCH,
+  STAGE_RENDER,
+  STAGE_IDLE,
+  STAGE_HOSTS,        // Extra host polling / carousel
+  STAGE_DISCOVERY     // mDNS bridge lookup
+};
+
+struct CrashRecord {
+  uint16_t boot;      // Boot number (persistent)
+  uint8_t reason;     // REASON_* of this boot (rst_info)
+  uint8_t stage;      // LoopStage of the previous run
+  uint32_t uptimeS;   // How long the previous run lasted (0 = unknown)
+  uint16_t freeHeap;  // Free heap at its last stage change
+  uint8_t exccause;   // Exception cause (reason == exception)
+  uint8_t depth;      // Valid entries in stack[]
+  uint32_t epc1;
+  uint32_t excvaddr;
+  uint32_t stack[4];  // Code addresses found on the stack (decode with addr2line)
+};
+
+class CrashLog {
+public:
+  static constexpr uint8_t CAPACITY = 8;    // Records kept / shown
+  static constexpr uint8_t STACK_DEPTH = 4;
+
+  // Record this boot (call first thing in setup)
+  static void begin();
+
+  // Mark the current loop stage (cheap: RTC write only)
+  static void stage(LoopStage s);
+
+  static uint8_t count();
+  static bool get(uint8_t index, CrashRecord& out);  // 0 = this boot
+  static uint16_t getBootCount();
+  static uint8_t getLastReason();
+
+  static const char* reasonName(uint8_t reason);
+  static const char* stageName(uint8_t s);
+  static bool isCrash(uint8_t reason);  // Exception or watchdog
+
+  // Called from custom_crash_callback()
+  static void captureStack(uint32_t stackStart, uint32_t stackEnd);
+};
+
+#endif // CRASH_LOG_H
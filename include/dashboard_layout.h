@@ -0,0 +1,156 @@
+/*
+ * Dashboard Layout Tables
+ * Bảng vị trí tile tính sẵn lúc compile (constexpr) theo SCREEN_WIDTH/HEIGHT/ROTATION
+ *
+ * Renderer chỉ cần duyệt DASHBOARD_LAYOUT - không tính toán lại mỗi frame.
+ * Thêm kích thước màn hình mới = chỉ sửa dữ liệu ở đây.
+ * Layout tùy chỉnh (descriptor từ bridge) được tính thành cùng dạng TileSlot, xem layout_store.h
+ */
+
+#ifndef DASHBOARD_LAYOUT_H
+#define DASHBOARD_LAYOUT_H
+
+#include <Arduino.h>
+#include "display_manager.h"  // SCREEN_WIDTH / SCREEN_HEIGHT
+
+#ifndef SCREEN_ROTATION
+  #define SCREEN_ROTATION 0
+#endif
+
+// Kích thước thực sau khi xoay (rotation 1/3 = landscape)
+#if (SCREEN_ROTATION & 1)
+  #define DASHBOARD_WIDTH  SCREEN_HEIGHT
+  #define DASHBOARD_HEIGHT SCREEN_WIDTH
+#else
+  #define DASHBOARD_WIDTH  SCREEN_WIDTH
+  #define DASHBOARD_HEIGHT SCREEN_HEIGHT
+#endif
+
+#if DASHBOARD_WIDTH > DASHBOARD_HEIGHT
+  #define DASHBOARD_LANDSCAPE 1
+#else
+  #define DASHBOARD_LANDSCAPE 0
+#endif
+
+// Tile types (what the renderer draws in a slot)
+enum TileKind : uint8_t {
+  TILE_CPU = 0,
+  TILE_RAM,
+  TILE_GPU,
+  TILE_VRAM,
+  TILE_STORAGE,
+  TILE_NET,        // Combined UP+DOWN
+  TILE_NET_UP,
+  TILE_NET_DOWN,
+  TILE_CORES,      // Per-core load heatmap
+  TILE_PUSH,       // Named metric pushed to the device (PushMetrics)
+  TILE_KIND_COUNT  // Append new kinds above (layout descriptors store these numbers)
+};
+
+// One precomputed tile slot
+struct TileSlot {
+  TileKind kind;
+  int16_t x, y, w, h;
+  const char* metric;  // TILE_PUSH: metric name, else nullptr
+  uint16_t color;      // Frame color override (0 = the tile's own color)
+};
+
+namespace DashboardLayout {
+  // Grid metrics
+  constexpr int16_t HEADER_H = 10;   // Header bar height
+  constexpr int16_t MARGIN   = 2;    // Screen margin
+  constexpr int16_t SPACING  = 2;    // Gap between tiles
+  constexpr int16_t PAD      = 2;    // Inner tile padding
+  constexpr int16_t FONT_W   = 6;    // Built-in 5x7 font advance (size 1)
+  constexpr int16_t FONT_H   = 8;
+
+  constexpr int16_t WIDTH  = DASHBOARD_WIDTH;
+  constexpr int16_t HEIGHT = DASHBOARD_HEIGHT;
+
+#if DASHBOARD_LANDSCAPE
+  constexpr int16_t COLS = 3;
+  constexpr int16_t ROWS = 2;
+#else
+  constexpr int16_t COLS = 2;
+  constexpr int16_t ROWS = 4;
+#endif
+
+  constexpr int16_t TOP    = HEADER_H + MARGIN;
+  constexpr int16_t TILE_W = (WIDTH - MARGIN * 2 - SPACING * (COLS - 1)) / COLS;
+  constexpr int16_t TILE_H = (HEIGHT - TOP - MARGIN - SPACING * (ROWS - 1)) / ROWS;
+
+  constexpr int16_t colX(int16_t col) { return MARGIN + col * (TILE_W + SPACING); }
+  constexpr int16_t rowY(int16_t row) { return TOP + row * (TILE_H + SPACING); }
+  constexpr int16_t spanW(int16_t cols) { return cols * TILE_W + (cols - 1) * SPACING; }
+
+  constexpr TileSlot slot(TileKind kind, int16_t col, int16_t row, int16_t span = 1) {
+    return TileSlot{kind, colX(col), rowY(row), spanW(span), TILE_H, nullptr, 0};
+  }
+
+  constexpr TileSlot pushSlot(const char* metric, int16_t col, int16_t row, int16_t span = 1) {
+    return TileSlot{TILE_PUSH, colX(col), rowY(row), spanW(span), TILE_H, metric, 0};
+  }
+
+  // Cell size for an arbitrary cols x rows grid (layout descriptors)
+  constexpr int16_t gridW(int16_t cols) { return (WIDTH - MARGIN * 2 - SPACING * (cols - 1)) / cols; }
+  constexpr int16_t gridH(int16_t rows) { return (HEIGHT - TOP - MARGIN - SPACING * (rows - 1)) / rows; }
+
+  // X position để căn phải `chars` ký tự trong tile
+  constexpr int16_t alignRight(int16_t x, int16_t w, int16_t chars, int16_t size = 1) {
+    return x + w - PAD - chars * FONT_W * size;
+  }
+
+  // Dòng đáy tile (small text)
+  constexpr int16_t bottomLine(int16_t y, int16_t h) { return y + h - PAD - FONT_H; }
+
+  // Vị trí số lớn (size 2) căn giữa theo chiều dọc
+  constexpr int16_t centerLine(int16_t y, int16_t h) { return y + h / 2 - FONT_H; }
+}
+
+// The VRAM slot can show the core heatmap or a pushed metric instead
+#ifndef DASHBOARD_CORE_HEATMAP
+  #define DASHBOARD_CORE_HEATMAP false
+#endif
+#if DASHBOARD_CORE_HEATMAP
+  #define DASHBOARD_SLOT_VRAM(col, row) DashboardLayout::slot(TILE_CORES, col, row)
+#elif defined(DASHBOARD_PUSH_METRIC)
+  #define DASHBOARD_SLOT_VRAM(col, row) DashboardLayout::pushSlot(DASHBOARD_PUSH_METRIC, col, row)
+#else
+  #define DASHBOARD_SLOT_VRAM(col, row) DashboardLayout::slot(TILE_VRAM, col, row)
+#endif
+
+#if DASHBOARD_LANDSCAPE
+// Row 1: CPU | RAM | GPU
+// Row 2: VRAM (or CORES / pushed metric) | STORAGE | NET
+constexpr TileSlot DASHBOARD_LAYOUT[] = {
+  DashboardLayout::slot(TILE_CPU,     0, 0),
+  DashboardLayout::slot(TILE_RAM,     1, 0),
+  DashboardLayout::slot(TILE_GPU,     2, 0),
+  DASHBOARD_SLOT_VRAM(0, 1),
+  DashboardLayout::slot(TILE_STORAGE, 1, 1),
+  DashboardLayout::slot(TILE_NET,     2, 1),
+};
+#else
+// Row 1: CPU | RAM
+// Row 2: GPU | VRAM (or CORES / pushed metric)
+// Row 3: STORAGE (full width)
+// Row 4: UP | DOWN
+constexpr TileSlot DASHBOARD_LAYOUT[] = {
+  DashboardLayout::slot(TILE_CPU,      0, 0),
+  DashboardLayout::slot(TILE_RAM,      1, 0),
+  DashboardLayout::slot(TILE_GPU,      0, 1),
+  DASHBOARD_SLOT_VRAM(1, 1),
+  DashboardLayout::slot(TILE_STORAGE,  0, 2, 2),
+  DashboardLayout::slot(TILE_NET_UP,   0, 3),
+  DashboardLayout::slot(TILE_NET_DOWN, 1, 3),
+};
+#endif
+
+constexpr uint8_t DASHBOARD_TILE_COUNT = sizeof(DASHBOARD_LAYOUT) / sizeof(DASHBOARD_LAYOUT[0]);
+
+static_assert(DashboardLayout::TILE_W > 0 && DashboardLayout::TILE_H > 0,
+              "Screen too small for dashboard grid");
+static_assert(DashboardLayout::rowY(DashboardLayout::ROWS - 1) + DashboardLayout::TILE_H <= DashboardLayout::HEIGHT,
+              "Dashboard rows overflow the screen");
+
+#endif // DASHBOARD_LAYOUT_H
@@ -9,6 +9,29 @@
 #include <Arduino.h>
 #include <Adafruit_GFX.h>
 #include "system_data.h"
+#include "glyph_cache.h"
+#include "backlight_manager.h"
+
+struct TileSlot;  // dashboard_layout.h
+class PushMetrics;
+
+// Storage/NET tiles with more disks/NICs than fit rotate through pages
+#ifndef TILE_PAGE_INTERVAL
+  #define TILE_PAGE_INTERVAL 4000  // ms per page
+#endif
+
+#ifndef ALERT_FLASH_MS
+  #define ALERT_FLASH_MS 5000  // Screen flash length when a FLASH alert trips
+#endif
+
+// One line of the multi-host summary page
+struct HostSummaryRow {
+  const char* label;
+  const SystemData* data;
+  bool online;
+  uint16_t latencyMs;  // Last poll round trip (0 = unknown)
+  uint16_t memBytes;   // Heap held for this host (0 = not tracked)
+};
 
 // Include thư viện TFT phù hợp
 #ifdef TFT_ST7735
@@ -62,19 +85,44 @@ private:
   uint8_t csPin, dcPin, rstPin, ledPin;
   uint8_t rotation;
   bool displayOn;
+  bool plainRendering;  // Low-memory mode: GFX text only, no glyph blits
+  BacklightManager backlight;  // PWM brightness + idle dim/off timeline
+  GlyphCache glyphs;  // Pre-expanded size-2 digits for big readouts
+  uint8_t tilePage;            // Free-running page counter (each tile takes it modulo its own page count)
+  unsigned long tilePageAt;    // When tilePage last advanced
+  uint8_t heatLevel[CORE_MAX]; // Core heatmap: color level on screen per cell
+  uint8_t heatCount;           // Cores in the drawn grid (0 = not on screen, full redraw)
+  uint16_t highlightMask;      // AlertMetric bits whose tiles get the alert border
+  unsigned long flashUntil;    // Alert flash: invert toggles until then (0 = idle)
+  unsigned long flashToggleAt;
+  bool inverted;
+  const PushMetrics* pushed;   // Values for TILE_PUSH slots (nullptr = none)
+  const TileSlot* layout;      // Active dashboard tiles (DASHBOARD_LAYOUT or a LayoutStore)
+  uint8_t layoutCount;
+  uint16_t frameColor;         // Frame color override of the tile being drawn (0 = none)
   
   // Helper methods for gaming UI
-  void drawProgressBar(int16_t x, int16_t y, int16_t w, int16_t h, float percent, uint16_t color, uint16_t bgColor);
-  void drawTemperatureGauge(int16_t x, int16_t y, int16_t size, float temp, float maxTemp, uint16_t color);
   void drawCenteredText(int16_t y, const char* text, uint16_t color, uint8_t size = 1);
+  void drawBigNumber(int16_t x, int16_t y, const char* text);  // Leaves cursor after text
+  void printFixed(fixed10_t value, bool decimal);
+  void clearScreen();  // fillScreen + forget partially-kept tiles
   
   // Helper functions for tile rendering
+  void drawTile(const TileSlot& slot, const SystemData& data);
+  void drawTileContent(const TileSlot& slot, const SystemData& data);
+  void drawTileFrame(int x, int y, int w, int h, const char* label, uint16_t color);
+  void drawTilePercent(int x, int y, int h, int percent);
+  void drawTilePager(int x, int y, int w, uint8_t page, uint8_t pages);
+  uint8_t tilePages(const TileSlot& slot, const SystemData& data);
   void drawTile_CPU(int x, int y, int w, int h, const SystemData& data);
   void drawTile_RAM(int x, int y, int w, int h, const SystemData& data);
   void drawTile_GPU(int x, int y, int w, int h, const SystemData& data);
   void drawTile_VRAM(int x, int y, int w, int h, const SystemData& data);
   void drawTile_Storage(int x, int y, int w, int h, const SystemData& data);
   void drawTile_Network_Combined(int x, int y, int w, int h, const SystemData& data);
+  void drawTile_NetRate(int x, int y, int w, int h, const char* label, const SystemData& data, bool up);
+  void drawTile_Cores(int x, int y, int w, int h, const SystemData& data);
+  void drawTile_Push(int x, int y, int w, int h, const char* metric);
   
 public:
   DisplayManager(uint8_t cs, uint8_t dc, uint8_t rst, uint8_t led, uint8_t rot = 1);
@@ -84,16 +132,39 @@ public:
   void showSplashScreen();
   void showWiFiConnecting();
   void showWiFiStatus(bool success, String ip = "");
-  void displaySystemInfo(const SystemData& data);
+  void displaySystemInfo(const SystemData& data, const char* title = "SYS", uint16_t highlight = 0);
+  void displayHostSummary(const HostSummaryRow* rows, uint8_t count);
+  void drawStaleBadge(unsigned long ageS, bool apActive);  // Header marker while the server is down
+  bool advanceTilePage(const SystemData& data);  // Next disk/NIC page; redraws only paged tiles
   void clear();
   void turnOn();
   void turnOff();
   void toggle();
-  bool isOn();
+  bool isOn();  // False while the backlight is off (rendering is skipped)
+  bool isEnabled() const { return displayOn; }  // Not turned off by the user (idle backlight may be off)
+  
+  // Backlight (PWM) + alert flash timing - call every loop
+  void updateBacklight();
+  bool noteActivity();  // Restart idle timeline; true = screen was off (redraw needed)
+  void setBrightness(uint8_t full, uint8_t dim) { backlight.setLevels(full, dim); }
+  
+  // Alert escalation (AlertEngine): one-shot screen flash, backlight pulse while active
+  void flashAlert();
+  void setAlertPulse(bool on);
+  
+  // Switch the dashboard to another tile set (kept by the caller); takes effect on the next frame
+  void setLayout(const TileSlot* slots, uint8_t count);
+  
+  // Named metrics pushed to the device, shown by TILE_PUSH slots
+  void setPushMetrics(const PushMetrics* metrics) { pushed = metrics; }
+  
+  // Low-memory mode (HeapGuard): skip the glyph cache and its line buffer
+  void setPlainRendering(bool plain) { plainRendering = plain; }
   
   // Helper methods for config portal
   void drawText(int16_t x, int16_t y, const char* text, uint16_t color, uint8_t size = 1);
   void drawText(int16_t x, int16_t y, String text, uint16_t color, uint8_t size = 1);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);  // Clear a line before redrawing it
 };
 
 #endif // DISPLAY_MANAGER_H
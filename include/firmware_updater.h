@@ -0,0 +1,94 @@
+/*
+ * Firmware Updater Module
+ * Tự kiểm tra firmware mới trên PC bridge (pull) và tải ngầm
+ *
+ * - Hỏi /firmware/manifest theo chu kỳ dài (mặc định 6h), gửi kèm device ID
+ *   + version hiện tại để bridge ghi nhận và quyết định staged rollout
+ * - Tải image theo từng lát nhỏ mỗi loop() qua OtaSession (SHA-256) nên
+ *   dashboard vẫn chạy bình thường; mất kết nối -> resume bằng HTTP Range
+ * - Chỉ reboot khi image đã verify xong
+ */
+
+#ifndef FIRMWARE_UPDATER_H
+#define FIRMWARE_UPDATER_H
+
+#include <Arduino.h>
+#include <ESP8266HTTPClient.h>
+#include <WiFiClient.h>
+#include "ota_session.h"
+
+#ifndef FW_UPDATE_ENABLED
+  #define FW_UPDATE_ENABLED true
+#endif
+
+#ifndef FW_CHECK_INTERVAL
+  #define FW_CHECK_INTERVAL 21600000UL  // 6h between manifest checks
+#endif
+
+#ifndef FW_FIRST_CHECK_DELAY
+  #define FW_FIRST_CHECK_DELAY 60000UL  // Let the dashboard settle after boot
+#endif
+
+#ifndef FW_STALL_TIMEOUT
+  #define FW_STALL_TIMEOUT 15000UL      // No bytes for this long -> reconnect
+#endif
+
+class DisplayManager;  // Forward declaration
+
+enum FirmwareUpdateState : uint8_t {
+  FW_IDLE = 0,
+  FW_DOWNLOADING,
+  FW_READY            // Verified - rebooting
+};
+
+class FirmwareUpdater {
+public:
+  static constexpr size_t STEP_BYTES = 4096;   // Max bytes pulled per handle()
+  static constexpr size_t READ_BYTES = 512;    // Stack buffer per read
+  static constexpr uint8_t MAX_RETRIES = 5;    // Reconnects before giving up until next check
+
+  FirmwareUpdater();
+
+  // Bridge address (same host/port as /system-info)
+  void setServer(const String& host, uint16_t port);
+  void setDisplayManager(DisplayManager* dm) { display = dm; }
+
+  // Call every loop() while the dashboard runs
+  void handle();
+
+  // Drop an in-flight download (e.g. web OTA mode takes over Update)
+  void abort();
+
+  bool isDownloading() const { return state == FW_DOWNLOADING; }
+  uint8_t getPercent() const { return session.getPercent(); }
+  const char* getDeviceId() const { return deviceId; }
+
+private:
+  String baseUrl;
+  char deviceId[16];
+  char targetVersion[16];
+  char imagePath[64];
+
+  FirmwareUpdateState state;
+  OtaSession session;
+  WiFiClient client;
+  HTTPClient http;
+  bool streaming;
+  uint32_t streamOffset;     // Image offset of the next byte on the stream
+  uint8_t retries;
+  unsigned long checkTimer;
+  unsigned long checkDelay;
+  unsigned long lastByteMs;
+  DisplayManager* display;
+
+  bool checkManifest();
+  bool openStream();
+  void closeStream();
+  void pump();
+  void giveUp(const char* reason);
+  void report(const char* status, const char* detail = "");
+  void scheduleNextCheck(unsigned long delayMs);
+  void showRebootScreen();
+};
+
+#endif // FIRMWARE_UPDATER_H
@@ -0,0 +1,41 @@
+/*
+ * Fixed-Point Helpers
+ * ESP8266 không có FPU - mọi metric lưu dạng số nguyên x10 (1 chữ số thập phân)
+ *
+ * Ví dụ: 45.5°C -> 455, 8.3 GB -> 83, 12.0 Mb/s -> 120
+ */
+
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <Arduino.h>
+
+typedef int32_t fixed10_t;   // Value * 10
+#define FIXED10_SCALE 10
+
+namespace Fixed10 {
+  constexpr fixed10_t fromInt(int32_t v) { return v * FIXED10_SCALE; }
+  
+  // Integer part (truncates toward zero, same as the old (int) casts)
+  constexpr int32_t toInt(fixed10_t v) { return v / FIXED10_SCALE; }
+  
+  // Nearest integer (half away from zero)
+  constexpr int32_t roundInt(fixed10_t v) {
+    return (v >= 0 ? v + FIXED10_SCALE / 2 : v - FIXED10_SCALE / 2) / FIXED10_SCALE;
+  }
+  
+  // part / total as a percentage in tenths, rounded and clamped to 0..1000
+  // (0 if total <= 0).
+  // 32-bit math only (int64 division is a libgcc call on Xtensa).
+  fixed10_t percent(int32_t part, int32_t total);
+  
+  // Integer-only formatters (no printf, no soft-float).
+  // Return number of chars written (buffer always NUL-terminated).
+  size_t formatInt(char* buf, size_t len, int32_t v);
+  size_t format(char* buf, size_t len, fixed10_t v, bool decimal = true);
+  
+  // "85", "-3.5", "90.25" -> x10 (extra decimals truncated). False on junk.
+  bool parse(const char* s, fixed10_t& out);
+}
+
+#endif // FIXED_POINT_H
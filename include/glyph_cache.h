@@ -0,0 +1,59 @@
+/*
+ * Glyph Cache Module
+ * Cache glyph số lớn (size 2) đã scale sẵn, blit cả chuỗi bằng 1 lần ghi cửa sổ SPI
+ *
+ * Adafruit GFX vẽ mỗi pixel của font 5x7 ở size 2 bằng một fillRect 2x2
+ * (hàng chục SPI transaction mỗi chữ số). Cache này mở rộng glyph một lần lúc
+ * begin() thành mask 2-bit (alpha 0..3, có làm mịn cạnh chéo), sau đó mỗi
+ * readout chỉ cần setAddrWindow + writePixels theo từng dòng.
+ */
+
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <Arduino.h>
+#include <Adafruit_SPITFT.h>
+
+#ifndef GLYPH_SMOOTHING
+  #define GLYPH_SMOOTHING true  // Anti-alias diagonal edges when scaling
+#endif
+
+class GlyphCache {
+public:
+  static constexpr uint8_t SCALE = 2;
+  static constexpr uint8_t CELL_W = 6 * SCALE;   // 5px glyph + 1px spacing
+  static constexpr uint8_t CELL_H = 8 * SCALE;   // 7px glyph + 1px spacing
+  static constexpr uint8_t MAX_CHARS = 8;        // Longest cached readout
+  static constexpr uint8_t GLYPH_COUNT = 13;     // "0123456789.-%"
+
+  GlyphCache();
+
+  // Expand glyphs into the mask cache (call once)
+  void begin();
+
+  // True if every char of text is cached and fits MAX_CHARS
+  bool canDraw(const char* text) const;
+
+  // Width in pixels of a cached string
+  int16_t width(const char* text) const { return strlen(text) * CELL_W; }
+
+  // Blit text at (x, y) in a single address window. Returns false if the
+  // string can't be drawn from the cache (caller should fall back to GFX).
+  bool drawString(Adafruit_SPITFT* tft, int16_t x, int16_t y, const char* text,
+                  uint16_t fg, uint16_t bg);
+
+private:
+  static constexpr uint8_t MASK_BYTES = (CELL_W * CELL_H * 2) / 8;  // 2bpp
+
+  uint8_t masks[GLYPH_COUNT][MASK_BYTES];
+  bool ready;
+
+  static int8_t glyphIndex(char c);
+  static uint16_t blend(uint16_t fg, uint16_t bg, uint8_t alpha);  // alpha 0..3
+
+  void buildGlyph(uint8_t index);
+  void setAlpha(uint8_t index, uint8_t px, uint8_t py, uint8_t alpha);
+  uint8_t getAlpha(uint8_t index, uint8_t px, uint8_t py) const;
+};
+
+#endif // GLYPH_CACHE_H
@@ -0,0 +1,69 @@
+/*
+ * Health Log Module
+ * Nhật ký sự kiện sức khỏe (ring buffer) lưu trong RTC user memory
+ *
+ * RTC memory giữ nguyên qua ESP.restart(), watchdog reset và crash (chỉ mất khi
+ * rút điện), ghi không tốn flash. Mỗi entry 8 byte: thời điểm + trạng thái heap.
+ */
+
+#ifndef HEALTH_LOG_H
+#define HEALTH_LOG_H
+
+#include <Arduino.h>
+
+#ifndef HEALTH_RTC_OFFSET
+  #define HEALTH_RTC_OFFSET 16  // RTC user memory block (4 bytes each); 0-15 left for others
+#endif
+
+#ifndef RTC_EBOOT_BLOCK
+  #define RTC_EBOOT_BLOCK 64    // Blocks 64+ hold the eboot OTA command (overwritten by every update)
+#endif
+
+enum HealthEvent : uint8_t {
+  HEALTH_NONE = 0,
+  HEALTH_HEAP_LOW,        // Entered low-memory mode
+  HEALTH_HEAP_CRITICAL,   // Headroom below the critical threshold
+  HEALTH_HEAP_RECOVERED,  // Back to normal mode
+  HEALTH_HEAP_RESTART     // Planned restart (last resort)
+};
+
+struct HealthEntry {
+  uint32_t uptimeS;   // Seconds since boot when logged
+  uint16_t maxBlock;  // Largest free heap block (bytes)
+  uint8_t frag;       // Heap fragmentation (%)
+  uint8_t event;      // HealthEvent
+};
+
+class HealthLog {
+public:
+  static constexpr uint8_t CAPACITY = 16;
+  static constexpr uint8_t RTC_BLOCKS = (12 + sizeof(HealthEntry) * CAPACITY) / 4;  // sizeof(Record) / 4
+
+  // Load the ring from RTC (reset it if invalid) and count this boot
+  static void begin();
+
+  static void log(HealthEvent event, uint16_t maxBlock, uint8_t frag);
+
+  static uint8_t count();
+  static bool get(uint8_t index, HealthEntry& out);  // 0 = newest
+  static uint16_t getBootCount();
+
+  static const char* eventName(uint8_t event);
+
+private:
+  struct Record {
+    uint32_t magic;
+    uint16_t bootCount;
+    uint8_t head;       // Next slot to write
+    uint8_t used;
+    HealthEntry entries[CAPACITY];
+    uint32_t crc;       // Over everything above
+  };
+
+  static Record rec;
+
+  static uint32_t checksum();
+  static void save();
+};
+
+#endif // HEALTH_LOG_H
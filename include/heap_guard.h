@@ -0,0 +1,81 @@
+/*
+ * Heap Guard Module
+ * Theo dõi block heap lớn nhất + độ phân mảnh, hạ cấp trước khi hết bộ nhớ
+ *
+ * String trong các module web/network phân mảnh heap dần sau nhiều ngày chạy.
+ * Khi headroom thấp, firmware chuyển sang chế độ ít bộ nhớ (JSON pool nhỏ,
+ * parse thẳng từ stream, vẽ thường không dùng glyph cache). Restart chủ động
+ * lúc rảnh chỉ là phương án cuối khi đã critical quá HEAP_RESTART_GRACE.
+ * Mọi lần chuyển mức đều ghi vào HealthLog.
+ */
+
+#ifndef HEAP_GUARD_H
+#define HEAP_GUARD_H
+
+#include <Arduino.h>
+
+#ifndef HEAP_LOW_BLOCK
+  #define HEAP_LOW_BLOCK 6144        // Largest free block below this -> low-memory mode (bytes)
+#endif
+
+#ifndef HEAP_CRITICAL_BLOCK
+  #define HEAP_CRITICAL_BLOCK 3072   // ...below this -> critical (bytes)
+#endif
+
+#ifndef HEAP_LOW_FRAG
+  #define HEAP_LOW_FRAG 50           // Fragmentation at/above this -> low-memory mode (%)
+#endif
+
+#ifndef HEAP_CRITICAL_FRAG
+  #define HEAP_CRITICAL_FRAG 75
+#endif
+
+#ifndef HEAP_RESTART_GRACE
+  #define HEAP_RESTART_GRACE 600000UL  // Critical this long (ms) -> restart at the next idle moment (0 = never)
+#endif
+
+enum HeapLevel : uint8_t {
+  HEAP_OK = 0,
+  HEAP_LOW,
+  HEAP_CRITICAL
+};
+
+class HeapGuard {
+public:
+  static constexpr unsigned long CHECK_INTERVAL = 5000;  // Sample period (ms)
+  static constexpr uint8_t ESCALATE_SAMPLES = 2;         // Consecutive bad samples before degrading
+  static constexpr uint8_t RECOVER_SAMPLES = 6;          // Consecutive good samples before recovering
+  static constexpr uint16_t BLOCK_HYSTERESIS = 1024;     // Extra headroom needed to recover (bytes)
+  static constexpr uint8_t FRAG_HYSTERESIS = 10;         // ...and fragmentation margin (%)
+
+  HeapGuard();
+
+  // Sample the heap (rate-limited); true when the level changed
+  bool update();
+
+  HeapLevel getLevel() const { return level; }
+  bool isDegraded() const { return level != HEAP_OK; }
+  const char* getLevelText() const;
+
+  // Critical for longer than HEAP_RESTART_GRACE - restart when idle
+  bool restartDue() const;
+  void restart();  // Log + ESP.restart()
+
+  uint32_t getMinMaxBlock() const { return minMaxBlock; }  // Low-water mark since boot
+
+private:
+  HeapLevel level;
+  uint8_t badSamples;
+  uint8_t goodSamples;
+  unsigned long lastCheck;
+  unsigned long criticalSince;
+  uint32_t lastMaxBlock;
+  uint8_t lastFrag;
+  uint32_t minMaxBlock;
+
+  HeapLevel classify(uint32_t maxBlock, uint8_t frag) const;
+  bool clearOfLow(uint32_t maxBlock, uint8_t frag) const;
+  void setLevel(HeapLevel next);
+};
+
+#endif // HEAP_GUARD_H
@@ -0,0 +1,121 @@
+/*
+ * Host Poller Module
+ * Poll thêm vài bridge (máy build, server...) song song với bridge chính
+ *
+ * - Danh sách host lưu EEPROM (nhập ở config portal, "host[:port]" mỗi dòng)
+ * - Mỗi host là một state machine trên WiFiClient: gửi request rồi quay lại
+ *   loop(), chỉ parse khi đã nhận đủ body -> không chặn dashboard/nút bấm.
+ *   Tối đa MAX_INFLIGHT socket cùng lúc, các host được poll lệch pha nhau.
+ * - Mỗi host có SystemData riêng; tên bị cắt còn NAME_MAX ký tự nên heap mỗi
+ *   host có giới hạn (getMemoryUsage)
+ */
+
+#ifndef HOST_POLLER_H
+#define HOST_POLLER_H
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include "system_data.h"
+
+#ifndef MULTI_HOST_MAX
+  #define MULTI_HOST_MAX 3           // Extra hosts besides the primary bridge
+#endif
+
+#ifndef MULTI_HOST_INTERVAL
+  #define MULTI_HOST_INTERVAL 5000   // Poll period per extra host (ms)
+#endif
+
+#ifndef CAROUSEL_INTERVAL
+  #define CAROUSEL_INTERVAL 8000     // Auto-advance dashboard pages (ms, 0 = button only)
+#endif
+
+#define HOSTS_EEPROM_OFFSET 256      // After UserSettings (200+)
+#define HOSTS_MAGIC 0x4854           // "HT"
+
+struct HostEntry {
+  char address[24];  // IP or hostname
+  uint16_t port;
+};
+
+// EEPROM layout
+struct HostListData {
+  uint16_t magic;
+  uint8_t count;
+  HostEntry hosts[MULTI_HOST_MAX];
+  uint8_t checksum;
+};
+
+class HostPoller {
+public:
+  static constexpr uint8_t MAX_INFLIGHT = 2;        // Concurrent sockets
+  static constexpr unsigned long TIMEOUT = 3000;    // Per request (ms)
+  static constexpr uint16_t CONNECT_TIMEOUT = 1000; // The only blocking step (LAN: a few ms)
+  static constexpr uint8_t NAME_MAX = 20;           // Longest kept name string
+  static constexpr uint16_t MAX_BODY = 2048;        // Larger replies are dropped (fits the TCP window)
+
+  HostPoller();
+
+  // Load the host list from EEPROM
+  void begin();
+
+  // Parse "host[:port]" entries (newline/comma/space separated) and save.
+  // Empty text clears the list.
+  static bool saveHostList(const char* text);
+
+  // Advance every host (non-blocking, call each loop)
+  void handle();
+
+  // Low-memory mode: close sockets and stop polling
+  void setPaused(bool paused);
+
+  uint8_t count() const { return hostCount; }
+  const SystemData& getData(uint8_t i) const { return slots[i].data; }
+  const char* getLabel(uint8_t i) const;   // Bridge hostname, else address
+  const char* getAddress(uint8_t i) const { return slots[i].entry.address; }
+  bool isOnline(uint8_t i) const;
+  uint16_t getLatency(uint8_t i) const { return slots[i].latencyMs; }
+  size_t getMemoryUsage(uint8_t i) const;  // Bytes held for host i (slot + strings)
+  size_t getMemoryUsage() const;
+
+  // True once per new sample of host i
+  bool takeUpdate(uint8_t i);
+
+private:
+  enum SlotState : uint8_t {
+    SLOT_IDLE = 0,
+    SLOT_HEADERS,   // Request sent, waiting for the status line + headers
+    SLOT_BODY       // Waiting until Content-Length bytes are buffered (or the server closes)
+  };
+
+  struct Slot {
+    HostEntry entry;
+    WiFiClient client;
+    SystemData data;
+    SlotState state;
+    bool statusOk;
+    bool updated;
+    uint8_t failures;
+    uint8_t lineLen;
+    char line[40];            // Current header line (longer lines are cut)
+    uint16_t latencyMs;
+    int32_t contentLength;    // -1 = until the server closes
+    unsigned long startedAt;
+    unsigned long nextPoll;
+  };
+
+  Slot slots[MULTI_HOST_MAX];
+  uint8_t hostCount;
+  bool paused;
+
+  uint8_t inflight() const;
+  void start(Slot& slot);
+  void readHeaders(Slot& slot);
+  void headerLine(Slot& slot);
+  void readBody(Slot& slot);
+  void finish(Slot& slot, bool ok);
+
+  static uint8_t checksum(const HostListData& list);
+  static void clip(String& s);
+};
+
+#endif // HOST_POLLER_H
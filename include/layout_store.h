@@ -0,0 +1,84 @@
+/*
+ * Layout Store Module
+ * Bố cục dashboard dạng dữ liệu: descriptor nhị phân (bridge biên dịch từ JSON bằng
+ * server/layout_compiler.py) được tính thành mảng TileSlot một lần khi nạp
+ *
+ * - Renderer chỉ duyệt mảng TileSlot như DASHBOARD_LAYOUT - không parse, không cấp phát mỗi frame
+ * - Descriptor lưu nguyên trong 1 sector flash (ngay trước sector của CrashLog),
+ *   tên metric của tile PUSH trỏ thẳng vào bản trong RAM
+ * - Đổi layout (POST /layout, hoặc bridge đổi "layout" trong /system-info) có hiệu lực ngay, không reboot
+ * - Layout POST lên panel được ghim: layout của bridge bị bỏ qua cho tới khi reset
+ *
+ * Định dạng v1:
+ *   'H' 'L' version=1 cols rows count
+ *   count x [kind col row colSpan rowSpan style nameLen name[nameLen] ('\0' nếu nameLen > 0)]
+ *   kind = TileKind, style = chỉ số bảng màu (0 = màu mặc định của tile)
+ */
+
+#ifndef LAYOUT_STORE_H
+#define LAYOUT_STORE_H
+
+#include <Arduino.h>
+#include "dashboard_layout.h"
+
+#ifndef LAYOUT_FLASH
+  #define LAYOUT_FLASH true     // Persist in the FS sector before CrashLog's (disable if you add LittleFS/SPIFFS)
+#endif
+
+#ifndef LAYOUT_TILE_MAX
+  #define LAYOUT_TILE_MAX 12
+#endif
+
+#ifndef LAYOUT_DESC_MAX
+  #define LAYOUT_DESC_MAX 256   // Largest descriptor (bytes)
+#endif
+
+class LayoutStore {
+public:
+  static constexpr uint8_t VERSION = 1;
+  static constexpr uint8_t GRID_MAX = 8;      // Columns / rows
+  static constexpr int16_t CELL_MIN_W = 24;   // Smallest cell that still fits a label + value
+  static constexpr int16_t CELL_MIN_H = 20;
+  static constexpr unsigned long RETRY_MS = 10000;  // First retry after a failed bridge download
+
+  LayoutStore();
+
+  // Saved layout from flash, else the built-in DASHBOARD_LAYOUT
+  void begin();
+
+  // Validate a descriptor and switch to it. False = rejected, current layout kept (see getError()).
+  // pinned = set on the panel itself (POST /layout): bridge layouts are ignored until reset().
+  bool apply(const uint8_t* data, size_t len, bool pinned = false);
+
+  bool save();   // Persist the active descriptor (and whether it is pinned)
+  void reset();  // Back to the built-in layout, saved one erased, unpinned
+
+  // True once after each apply()/reset(): the renderer should pick up getSlots()
+  bool takeChanged();
+
+  const TileSlot* getSlots() const { return slots; }
+  uint8_t getCount() const { return count; }
+  uint32_t getId() const { return id; }          // CRC32 of the descriptor (0 = built-in)
+  bool isCustom() const { return id != 0; }
+  bool isPinned() const { return pinned; }
+  const char* getError() const { return error; }
+
+  static uint32_t crc32(const uint8_t* data, size_t len);
+  static const char* kindName(uint8_t kind);
+
+private:
+  uint8_t desc[LAYOUT_DESC_MAX];  // Active descriptor (TILE_PUSH names point in here)
+  size_t descLen;
+  TileSlot slots[LAYOUT_TILE_MAX];
+  uint8_t count;
+  uint32_t id;
+  bool changed;
+  bool pinned;
+  const char* error;
+  uint32_t sectorAddr;            // 0 = no flash region
+
+  void useBuiltin();
+  bool compile(const uint8_t* data, size_t len, TileSlot* out, uint8_t& n);
+};
+
+#endif // LAYOUT_STORE_H
@@ -13,12 +13,16 @@ class DisplayManager;
 class SettingsManager;
 class ConfigManager;
 class OTAWebManager;
+class AdaptiveRefresh;
+class PowerManager;
 
 // Menu states
 enum MenuState {
   MENU_SYSTEM_INFO = 0,    // Back to dashboard
   MENU_REFRESH_RATE,       // Change refresh rate
+  MENU_BRIGHTNESS,         // Change backlight brightness
   MENU_NETWORK_INFO,       // Show network info
+  MENU_RESET_LOG,          // Show reset/crash history
   MENU_SERVER_CONFIG,      // Change server IP/Port
   MENU_WIFI_CONFIG,        // Change WiFi credentials
   MENU_OTA_UPDATE,         // OTA firmware update
@@ -33,7 +37,9 @@ enum MenuState {
 enum SubMenuState {
   SUBMENU_NONE = 0,
   SUBMENU_REFRESH_SELECT,     // Selecting refresh rate
+  SUBMENU_BRIGHTNESS_SELECT,  // Selecting backlight brightness
   SUBMENU_NETWORK_DISPLAY,    // Showing network info
+  SUBMENU_RESET_LOG_DISPLAY,  // Paging through reset records
   SUBMENU_CONFIRM_RESET,      // Confirm factory reset (all)
   SUBMENU_CONFIRM_RESET_SERVER, // Confirm server reset
   SUBMENU_CONFIRM_RESET_WIFI, // Confirm WiFi reset
@@ -46,9 +52,12 @@ private:
   SettingsManager* settings;
   ConfigManager* config;
   OTAWebManager* otaWeb;
+  AdaptiveRefresh* adaptive;  // Optional - polls/min stats in refresh menu
+  PowerManager* power;        // Optional - radio duty in network info
   
   MenuState currentState;
   SubMenuState subMenuState;
+  uint8_t resetLogPage;
   
   bool menuActive;
   unsigned long menuEnterTime;
@@ -66,7 +75,9 @@ private:
   
   // Submenu handlers
   void handleRefreshRateMenu();
+  void handleBrightnessMenu();
   void handleNetworkInfoMenu();
+  void handleResetLogMenu();
   void handleConfirmDialog(const char* title, const char* message);
   
 public:
@@ -79,6 +90,8 @@ public:
   
   // Callback for exit notification
   void setExitCallback(void (*callback)()) { onExitCallback = callback; }
+  void setAdaptiveRefresh(AdaptiveRefresh* ar) { adaptive = ar; }
+  void setPowerManager(PowerManager* pm) { power = pm; }
   
   // Navigation
   void next();                  // Next menu item
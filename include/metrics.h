@@ -0,0 +1,152 @@
+/*
+ * Metrics Module
+ * Bộ đếm sức khỏe firmware luôn bật + endpoint HTTP (Prometheus text / JSON)
+ *
+ * - Counter là static: module nào cũng ghi được (Metrics::recordX) mà không
+ *   cần truyền con trỏ qua lại
+ * - Scrape ghi thẳng ra socket qua buffer trên stack (MetricsWriter), không
+ *   dựng String nào -> không cấp phát heap mỗi lần scrape
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+
+class HostPoller;
+class AlertEngine;
+class SettingsManager;
+class PushMetrics;
+class LayoutStore;
+
+#ifndef METRICS_ENABLED
+  #define METRICS_ENABLED true
+#endif
+
+#ifndef METRICS_PORT
+  #define METRICS_PORT 9100  // Prometheus exporter convention (80 is used by OTA/config)
+#endif
+
+// Buffered Print that flushes to another Print (a WiFiClient) in fixed chunks
+class MetricsWriter : public Print {
+public:
+  static constexpr size_t BUF_SIZE = 256;
+
+  explicit MetricsWriter(Print& sink) : sink(sink), used(0) {}
+  ~MetricsWriter() { flush(); }
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* data, size_t len) override;
+  void flush() override;
+
+  // printf into the buffer itself (Print::printf allocates past 64 chars).
+  // A line that does not fit flushes the buffer and is formatted again.
+  void appendf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+private:
+  Print& sink;
+  char buf[BUF_SIZE];
+  size_t used;
+};
+
+// Fixed-bucket latency histogram (emitted as cumulative Prometheus buckets)
+class LatencyHistogram {
+public:
+  static constexpr uint8_t BUCKETS = 7;
+  static const uint16_t BOUNDS_MS[BUCKETS];   // Upper bounds; +Inf is implicit
+
+  LatencyHistogram();
+  void record(uint32_t ms);
+
+  uint32_t getCount() const { return count; }
+  uint32_t getSumMs() const { return sumMs; }
+  uint32_t getCumulative(uint8_t bucket) const;  // bucket == BUCKETS -> +Inf
+
+private:
+  uint32_t counts[BUCKETS + 1];
+  uint32_t count;
+  uint32_t sumMs;
+};
+
+class Metrics {
+public:
+  // Hook WiFi connect/disconnect events (call once in setup)
+  static void begin();
+
+  static void recordFetch(uint32_t latencyMs, bool ok);
+  static void recordParse(uint32_t us);
+  static void recordRender(uint32_t us);
+  static void recordFlashWrite();
+  static void recordDnsLookup() { dnsLookups++; }  // ServerTarget cache misses
+  static void setHeapLevel(uint8_t level) { heapLevel = level; }  // HeapGuard
+  static void setHostPoller(const HostPoller* poller) { hosts = poller; }  // Per-host gauges
+  static void setAlertEngine(const AlertEngine* engine) { alerts = engine; }  // Alert rule states
+  static void setRecoveryTier(uint8_t tier) { recoveryTier = tier; }      // RecoveryPolicy
+  static void recordRecovery(uint32_t ms);                                // Outage -> first good fetch
+  static void recordPush(bool ok, uint16_t values, uint32_t bytes, uint32_t us);  // POST /push
+
+  static uint16_t getFailStreak() { return failStreak; }
+  static uint32_t getFlashWrites() { return flashWrites; }
+  static uint32_t getWiFiReconnects() { return wifiConnects > 0 ? wifiConnects - 1 : 0; }
+
+  static void writePrometheus(MetricsWriter& out);
+  static void writeJson(MetricsWriter& out);
+  static void writeAlerts(MetricsWriter& out);  // JSON array of rules + state (also GET /alerts)
+
+private:
+  static LatencyHistogram fetchLatency;
+  static uint32_t fetchOk;
+  static uint32_t fetchFail;
+  static uint16_t failStreak;
+  static uint16_t failStreakMax;
+  static uint32_t parseLastUs, parseMaxUs;
+  static uint32_t renderLastUs, renderMaxUs;
+  static uint32_t wifiConnects;
+  static uint32_t wifiDisconnects;
+  static uint32_t flashWrites;
+  static uint32_t dnsLookups;
+  static uint8_t recoveryTier;
+  static uint32_t outages;
+  static uint32_t recoveryLastMs, recoveryMaxMs;
+  static uint32_t pushOk, pushRejected, pushValues, pushBytes;
+  static uint32_t pushParseLastUs, pushParseMaxUs, pushParseSumUs;
+  static uint8_t heapLevel;
+  static const HostPoller* hosts;
+  static const AlertEngine* alerts;
+};
+
+// GET /metrics (Prometheus text) and /metrics.json on METRICS_PORT,
+// plus GET/POST /alerts to read and edit the alert rules and
+// GET/POST /push for pushed metrics (PUSH_ENABLED) and
+// GET/POST /layout for the dashboard layout
+class MetricsServer {
+public:
+  explicit MetricsServer(uint16_t port = METRICS_PORT);
+
+  void setAlerts(AlertEngine* engine, SettingsManager* store);  // Before begin()
+  void setPushMetrics(PushMetrics* table) { pushed = table; }   // Before begin()
+  void setLayoutStore(LayoutStore* store) { layouts = store; }  // Before begin()
+  void begin();
+  void handle();
+
+private:
+  ESP8266WebServer server;
+  bool started;
+  AlertEngine* alertEngine;
+  SettingsManager* settings;
+  PushMetrics* pushed;
+  LayoutStore* layouts;
+
+  void serve(bool json);
+  bool checkToken();   // PUSH_TOKEN on write requests; false = 401 already sent
+  void serveAlerts();
+  void updateAlert();
+  void servePush();
+  void receiveBody(size_t limit);  // Raw body chunks -> fixed buffer
+  void ingestPush();
+  void serveLayout();
+  void updateLayout();
+};
+
+#endif // METRICS_H
@@ -8,32 +8,74 @@
 
 #include <Arduino.h>
 #include <ESP8266WiFi.h>
-#include <ESP8266HTTPClient.h>
 #include <WiFiClient.h>
+#include <ArduinoJson.h>
 #include "system_data.h"
+#include "server_target.h"
+
+#ifndef JSON_POOL_SIZE
+  #define JSON_POOL_SIZE (2048 + 4 * CORE_MAX)  // ArduinoJson pool for /system-info (bytes, + packed core strings)
+#endif
+
+#ifndef JSON_POOL_LOW
+  #define JSON_POOL_LOW 1024   // Pool in low-memory mode (filtered, parsed from the socket)
+#endif
+
+// The bridge trims disk/NIC lists to what SystemData can hold (bounded JSON size)
+#define SYSINFO_STR_(x) #x
+#define SYSINFO_STR(x) SYSINFO_STR_(x)
+#define SYSTEM_INFO_PATH "/system-info?fixed=1&disks=" SYSINFO_STR(DISK_MAX) "&nics=" SYSINFO_STR(NIC_MAX) \
+                         "&cores=" SYSINFO_STR(CORE_MAX)
+#define SYSTEM_INFO_PATH_LOW "/system-info?fixed=1&disks=2&nics=1&cores=0"  // Fits JSON_POOL_LOW
 
 class NetworkManager {
+public:
+  static constexpr unsigned long HTTP_TIMEOUT = 5000;  // Per read (ms)
+  
 private:
   const char* ssid;
   const char* password;
-  String serverUrl;
+  ServerTarget server;  // Cached address + prebuilt request
+  String targetHost;    // Kept to rebuild the request when the memory mode changes
+  uint16_t targetPort;
   WiFiClient wifiClient;
   unsigned long lastUpdate;
   unsigned long updateInterval;
+  bool lowMemory;
+  
+  void buildRequest();
+  int readResponseHead(int32_t& contentLength);
+  bool readBody(String& payload, int32_t contentLength);
   
 public:
-  NetworkManager(const char* wifiSsid, const char* wifiPass, String serverURL, unsigned long interval = 3000);
+  NetworkManager(const char* wifiSsid, const char* wifiPass, const char* serverHost, uint16_t serverPort,
+                 unsigned long interval = 3000);
   bool connectWiFi(int maxAttempts = 20);
   bool isConnected();
   void reconnect();
   bool fetchSystemData(SystemData& data);
+  
+  // GET /layout from the bridge into buf (LayoutStore descriptor). False if missing or larger than cap.
+  bool fetchLayout(uint8_t* buf, size_t cap, size_t& len);
   bool shouldUpdate();
+  unsigned long getTimeUntilUpdate() const;  // ms until shouldUpdate() fires
   void resetUpdateTimer();
   String getLocalIP();
   
+  // Bridge moved (BridgeDiscovery) - rebuilds the cached request
+  void setServer(const char* host, uint16_t port);
+  
+  // Configured server is a hostname: drop its cached address and ask DNS now.
+  // False for IP literals and for names DNS cannot resolve.
+  bool refreshServerName();
+  
   // Settings management
   void setUpdateInterval(unsigned long interval) { updateInterval = interval; }
   unsigned long getUpdateInterval() const { return updateInterval; }
+  
+  // Low-memory mode (HeapGuard): no payload String, smaller filtered JSON pool
+  void setLowMemory(bool on);
+  bool isLowMemory() const { return lowMemory; }
 };
 
 #endif // NETWORK_MANAGER_H
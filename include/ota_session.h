@@ -0,0 +1,79 @@
+/*
+ * OTA Session Module
+ * Nhận firmware theo từng đoạn (range), hash SHA-256 khi đang stream,
+ * chỉ commit (Update.end) khi digest khớp manifest
+ *
+ * - Đoạn gửi lại (trùng offset) được bỏ qua, đoạn nhảy cóc bị từ chối
+ *   kèm offset mong đợi -> client hỏi lại và resume
+ * - Đoạn cuối chỉ được ghi vào flash SAU khi digest đã khớp; nếu sai thì
+ *   Updater bị huỷ và firmware cũ vẫn boot bình thường
+ */
+
+#ifndef OTA_SESSION_H
+#define OTA_SESSION_H
+
+#include <Arduino.h>
+#include <bearssl/bearssl_hash.h>
+
+enum OtaState : uint8_t {
+  OTA_IDLE = 0,
+  OTA_RECEIVING,
+  OTA_VERIFIED,      // Digest matched, image committed - reboot to apply
+  OTA_FAILED
+};
+
+enum OtaWriteResult : uint8_t {
+  OTA_WRITE_OK = 0,
+  OTA_WRITE_DUPLICATE,   // Already had these bytes (retransmit)
+  OTA_WRITE_GAP,         // offset > received - client must resume
+  OTA_WRITE_ERROR        // Session failed (flash error / bad digest)
+};
+
+class OtaSession {
+public:
+  static constexpr uint8_t DIGEST_LEN = 32;
+
+  OtaSession();
+
+  // Start a session for an image of `size` bytes with the given SHA-256
+  // (64 hex chars). If the same image is already in progress this resumes it.
+  // rawSize = uncompressed size for .bin.gz images (eboot inflates them on
+  // reboot); only used to report the effective rate.
+  bool begin(uint32_t size, const char* sha256Hex, uint32_t rawSize = 0);
+
+  // Feed bytes that belong at image offset `offset`
+  OtaWriteResult write(uint32_t offset, const uint8_t* data, size_t len);
+
+  // Drop the session (firmware in flash stays untouched)
+  void abort();
+
+  OtaState getState() const { return state; }
+  uint32_t getOffset() const { return received; }
+  uint32_t getSize() const { return size; }
+  uint8_t getPercent() const;
+  const char* getError() const { return error; }
+
+  // Throughput over the transfer, in tenths of KB/s
+  uint32_t getRateKBps10() const;
+
+  // Gzip image: firmware bytes delivered per second (rate * raw/size)
+  bool isCompressed() const { return rawSize > size; }
+  uint32_t getEffectiveRateKBps10() const;
+
+private:
+  OtaState state;
+  uint32_t size;
+  uint32_t rawSize;
+  uint32_t received;
+  uint8_t expected[DIGEST_LEN];
+  br_sha256_context sha;
+  unsigned long firstByteMs;
+  unsigned long lastByteMs;
+  const char* error;
+
+  static bool parseHex(const char* hex, uint8_t* out, size_t outLen);
+  bool finish(const uint8_t* tail, size_t len);
+  void fail(const char* reason);
+};
+
+#endif // OTA_SESSION_H
@@ -8,24 +8,31 @@
 
 #include <Arduino.h>
 #include <ESP8266WebServer.h>
-#include <ESP8266HTTPUpdateServer.h>
 #include "display_manager.h"
+#include "ota_session.h"
 
 class OTAWebManager {
 private:
   DisplayManager* display;
   ESP8266WebServer* webServer;
-  ESP8266HTTPUpdateServer* httpUpdater;
   bool isActive;
   String currentIP;
   
+  // Chunked upload state (see OtaSession)
+  OtaSession session;
+  uint32_t chunkOffset;
+  bool chunkRejected;
+  unsigned long lastProgressDraw;
+  
   void showActiveScreen();
   void showClosedScreen();
-  String generateRootHTML();
-  String generateUpdateHTML();
+  void showProgress();
+  void sendRootPage();
+  void sendStatus(int code);
   void handleUpdatePage();
-  void handleUpload();
-  void handleUploadCallback();
+  void handleBegin();
+  void handleChunk();
+  void handleChunkDone();
   
 public:
   OTAWebManager();
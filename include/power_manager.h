@@ -0,0 +1,61 @@
+/*
+ * Power Manager Module
+ * WiFi modem sleep / light sleep giữa các lần fetch + ước lượng thời gian radio bật
+ *
+ * Ở refresh 5s, radio chỉ thực sự truyền vài chục ms mỗi chu kỳ. Giữa hai lần
+ * fetch, loop() nhường CPU bằng các lát delay() ngắn để SDK vào sleep (căn
+ * theo DTIM), nút bấm vẫn được poll đủ nhanh và đánh thức được light sleep.
+ */
+
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include "fixed_point.h"
+
+// Power modes
+#define POWER_MODE_OFF    0  // Radio always awake (lowest latency)
+#define POWER_MODE_MODEM  1  // Modem sleep between DTIM beacons
+#define POWER_MODE_LIGHT  2  // Light sleep (CPU + radio) while idle
+
+#ifndef WIFI_SLEEP_MODE
+  #define WIFI_SLEEP_MODE POWER_MODE_OFF
+#endif
+
+#ifndef WIFI_LISTEN_INTERVAL
+  #define WIFI_LISTEN_INTERVAL 3  // Wake every N DTIM periods (1-10)
+#endif
+
+class PowerManager {
+public:
+  static constexpr unsigned long IDLE_SLICE = 30;       // Max sleep per loop (ms) - keeps button responsive
+  static constexpr unsigned long WAKE_MARGIN = 20;      // Stop sleeping this early before a fetch (ms)
+  static constexpr uint16_t BEACON_DUTY_X1000 = 30;     // Est. radio duty while idle in sleep (3.0%)
+  
+  PowerManager(uint8_t mode = WIFI_SLEEP_MODE, uint8_t wakePin = 0xFF);
+  
+  // Apply sleep mode (call after WiFi is connected)
+  void begin();
+  
+  // Bracket each HTTP fetch - radio is fully on during it
+  void beginFetch();
+  void endFetch();
+  
+  // Yield between fetches; msUntilNext = time until the next scheduled fetch
+  void idle(unsigned long msUntilNext);
+  
+  // Estimated radio-on time since boot
+  uint32_t getRadioOnMs() const;
+  fixed10_t getRadioDutyPercent() const;  // x10
+  
+  uint8_t getMode() const { return mode; }
+  const char* getModeText() const;
+  
+private:
+  uint8_t mode;
+  uint8_t wakePin;
+  unsigned long fetchStart;
+  uint32_t fetchMs;       // Measured time spent in fetches
+};
+
+#endif // POWER_MANAGER_H
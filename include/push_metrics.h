@@ -0,0 +1,80 @@
+/*
+ * Push Metrics Module
+ * Bảng metric đặt tên do hệ thống khác đẩy vào (POST /push trên cổng metrics):
+ * alertmanager webhook, trạng thái CI, render farm...
+ *
+ * - Số entry cố định (PUSH_METRIC_MAX), tên tối đa PUSH_NAME_LEN - 1 ký tự, đầy thì thay entry cũ nhất
+ * - Body được parse tại chỗ trong buffer cố định (JSON zero-copy hoặc nhị phân), không cấp phát heap
+ * - Không phụ thuộc WiFi/phần cứng - build được trên host
+ */
+
+#ifndef PUSH_METRICS_H
+#define PUSH_METRICS_H
+
+#include <Arduino.h>
+#include "fixed_point.h"
+
+#ifndef PUSH_ENABLED
+  #define PUSH_ENABLED false
+#endif
+
+#ifndef PUSH_TOKEN
+  #define PUSH_TOKEN ""         // Non-empty: POST /push, /alerts, /layout need ?token=<PUSH_TOKEN>
+#endif
+
+#ifndef PUSH_METRIC_MAX
+  #define PUSH_METRIC_MAX 16
+#endif
+
+#ifndef PUSH_NAME_LEN
+  #define PUSH_NAME_LEN 16      // Including the NUL
+#endif
+
+#ifndef PUSH_BODY_MAX
+  #define PUSH_BODY_MAX 1536    // Largest accepted request body
+#endif
+
+#ifndef PUSH_JSON_POOL
+  #define PUSH_JSON_POOL 1024   // Zero-copy parse: only slots, strings stay in the body
+#endif
+
+#ifndef PUSH_METRIC_TTL
+  #define PUSH_METRIC_TTL 300000  // ms without an update before a value shows as missing
+#endif
+
+struct PushMetric {
+  char name[PUSH_NAME_LEN];
+  fixed10_t value;
+  unsigned long updatedAt;
+};
+
+class PushMetrics {
+public:
+  PushMetrics();
+
+  // Store one value (name need not be NUL-terminated). False = invalid name.
+  bool set(const char* name, size_t nameLen, fixed10_t value, unsigned long now);
+
+  // Fresh value by name (false = never pushed or older than PUSH_METRIC_TTL)
+  bool get(const char* name, fixed10_t& value, unsigned long now) const;
+
+  uint8_t count() const { return used; }
+  const PushMetric& at(uint8_t i) const { return entries[i]; }
+
+  // Parse one request body in place (body is modified, body[len] must be writable).
+  // Returns the number of values stored, or -1 if the body is malformed.
+  //   JSON:   {"ci.status": 1, "farm.queue": 42.5} or an Alertmanager webhook
+  //   Binary: repeated [u8 name length][name][int32 little-endian value x10]
+  int16_t ingestJson(char* body, size_t len, unsigned long now);
+  int16_t ingestBinary(const uint8_t* body, size_t len, unsigned long now);
+
+private:
+  PushMetric entries[PUSH_METRIC_MAX];
+  uint8_t used;
+
+  static bool validName(const char* name, size_t len);
+  PushMetric* slot(const char* name, size_t len, unsigned long now);  // Find or claim
+  int16_t ingestWebhook(char* body, size_t len, unsigned long now);
+};
+
+#endif // PUSH_METRICS_H
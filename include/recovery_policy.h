@@ -0,0 +1,71 @@
+/*
+ * Recovery Policy Module
+ * Xử lý mất kết nối server theo từng bậc thay vì xóa config + reboot
+ *
+ *   1 lần lỗi     -> STALE: giữ dữ liệu cũ trên màn hình, hiện tuổi dữ liệu
+ *   2 lần lỗi     -> REDISCOVER: tìm lại bridge qua mDNS (chạy nền)
+ *   3+ lần lỗi    -> BACKOFF: giãn chu kỳ poll gấp đôi mỗi lần (tới RECOVERY_MAX_INTERVAL)
+ *   mất lâu       -> AP: bật AP tạm để sửa địa chỉ server, config cũ vẫn giữ nguyên
+ *
+ * Chỉ là state machine (không I/O) - main loop quyết định làm gì ở mỗi bậc.
+ * Thời gian hồi phục (lỗi đầu tiên -> fetch OK) được ghi lại cho /metrics.
+ */
+
+#ifndef RECOVERY_POLICY_H
+#define RECOVERY_POLICY_H
+
+#include <Arduino.h>
+
+#ifndef RECOVERY_BACKOFF_AFTER
+  #define RECOVERY_BACKOFF_AFTER 3        // Consecutive failures before polling slows down
+#endif
+
+#ifndef RECOVERY_MAX_INTERVAL
+  #define RECOVERY_MAX_INTERVAL 60000UL   // Slowest retry while backing off (ms)
+#endif
+
+#ifndef RECOVERY_AP_AFTER
+  #define RECOVERY_AP_AFTER 600000UL      // Outage this long -> temporary config AP (ms, 0 = never)
+#endif
+
+enum RecoveryTier : uint8_t {
+  RECOVERY_OK = 0,
+  RECOVERY_STALE,        // Showing the last good data
+  RECOVERY_REDISCOVER,   // + mDNS lookup
+  RECOVERY_BACKOFF,      // + slower polling
+  RECOVERY_AP            // + temporary AP for reconfiguration
+};
+
+class RecoveryPolicy {
+public:
+  static constexpr uint8_t REDISCOVER_AFTER = 2;
+
+  RecoveryPolicy();
+
+  // Feed fetch results; true when the tier changed
+  bool reportFailure();
+  bool reportSuccess();
+
+  RecoveryTier getTier() const { return tier; }
+  const char* getTierText() const;
+  bool isDegraded() const { return tier != RECOVERY_OK; }
+
+  // Next poll interval given the normal one
+  unsigned long getRetryInterval(unsigned long normal) const;
+
+  uint16_t getFailures() const { return failures; }
+  unsigned long getOutageMs() const;          // 0 when connected
+  unsigned long getDataAgeMs() const;         // Since the last good fetch
+  uint32_t getLastRecoveryMs() const { return lastRecoveryMs; }
+
+private:
+  RecoveryTier tier;
+  uint16_t failures;
+  unsigned long outageStart;
+  unsigned long lastSuccess;
+  uint32_t lastRecoveryMs;
+
+  RecoveryTier target() const;
+};
+
+#endif // RECOVERY_POLICY_H
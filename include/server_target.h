@@ -0,0 +1,58 @@
+/*
+ * Server Target Module
+ * Cache địa chỉ đã resolve + request line dựng sẵn cho bridge chính
+ *
+ * - Config portal cho phép nhập domain ("server.local", "example.com"):
+ *   DNS chỉ được hỏi khi cache hết hạn (DNS_CACHE_TTL) hoặc kết nối lỗi
+ * - DNS lỗi nhưng còn địa chỉ cũ -> dùng tiếp địa chỉ cũ (serve-stale) cho tới khi kết nối tới nó lỗi,
+ *   hỏi lại DNS sau STALE_RETRY (không chờ hết TTL)
+ * - Request line dựng 1 lần khi đổi server -> mỗi lần fetch không tạo String nào
+ */
+
+#ifndef SERVER_TARGET_H
+#define SERVER_TARGET_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+#ifndef DNS_CACHE_TTL
+  #define DNS_CACHE_TTL 600000UL  // Re-resolve hostnames after this long (ms)
+#endif
+
+class ServerTarget {
+public:
+  static constexpr size_t HOST_MAX = 32;
+  static constexpr size_t REQUEST_MAX = 160;
+  static constexpr uint32_t DNS_TIMEOUT = 2000;  // ms (core default is 10s)
+  static constexpr uint32_t STALE_RETRY = 30000; // Ask DNS again this soon while serving stale
+
+  ServerTarget();
+
+  // Build the request once (IP literals are parsed here and never resolved)
+  bool set(const char* host, uint16_t port, const char* path);
+
+  // Cached address; DNS only when missing or expired
+  bool resolve(IPAddress& out);
+
+  // Connect failed - resolve again on the next fetch, forget the cached address
+  void invalidate();
+
+  const char* getRequest() const { return request; }
+  size_t getRequestLength() const { return requestLen; }
+  const char* getHost() const { return host; }
+  bool isLiteral() const { return literal; }
+  uint16_t getPort() const { return port; }
+
+private:
+  char host[HOST_MAX];
+  uint16_t port;
+  bool literal;         // Host is an IP address
+  bool resolved;
+  IPAddress address;
+  unsigned long resolvedAt;
+  unsigned long ttl;    // DNS_CACHE_TTL, or STALE_RETRY after a failed lookup
+  char request[REQUEST_MAX];
+  size_t requestLen;
+};
+
+#endif // SERVER_TARGET_H
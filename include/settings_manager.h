@@ -9,23 +9,44 @@
 
 #include <Arduino.h>
 #include <EEPROM.h>
+#include "alert_engine.h"
 
 // Settings storage offset (ConfigManager uses 0-118, we use 200+ to be safe)
 #define SETTINGS_EEPROM_OFFSET 200
 #define SETTINGS_MAGIC 0xFEED  // Magic number to verify settings
 
+// Alert rules: own block at the end of EEPROM (after the host list)
+#define ALERTS_EEPROM_OFFSET 448
+#define ALERTS_MAGIC 0x414C    // "AL"
+
+struct AlertSettings {
+  uint16_t magic;
+  AlertRule rules[ALERT_RULE_MAX];  // actions == 0 = empty slot
+  uint8_t checksum;
+};
+
 // User settings structure
 struct UserSettings {
   uint16_t magic;              // Magic number for validation
   uint16_t refreshInterval;    // Refresh rate in milliseconds
   uint8_t displayMode;         // Display mode (0=Full, 1=Compact) - Future
-  uint8_t reserved[10];        // Reserved for future use
+  uint8_t adaptiveRefresh;     // 1 = adaptive polling (volatility-driven)
+  uint16_t adaptiveMinInterval; // Adaptive floor (ms), 0 = default
+  uint16_t adaptiveMaxInterval; // Adaptive ceiling (ms), 0 = default
+  uint8_t backlightFull;       // Backlight PWM level when active (0 = default)
+  uint8_t backlightDim;        // Backlight PWM level when idle-dimmed (0 = default)
+  uint8_t reserved[3];         // Reserved for future use
   
   // Constructor with defaults
   UserSettings() : 
     magic(SETTINGS_MAGIC),
     refreshInterval(5000),     // Default 5s (0.2 Hz)
-    displayMode(0) {
+    displayMode(0),
+    adaptiveRefresh(0),
+    adaptiveMinInterval(500),  // Fastest: 0.5s
+    adaptiveMaxInterval(10000), // Slowest: 10s
+    backlightFull(255),
+    backlightDim(40) {
     memset(reserved, 0, sizeof(reserved));
   }
 };
@@ -33,6 +54,9 @@ struct UserSettings {
 class SettingsManager {
 private:
   UserSettings settings;
+  AlertSettings alerts;
+  
+  static uint8_t alertChecksum(const AlertSettings& data);
   
 public:
   SettingsManager();
@@ -48,17 +72,35 @@ public:
   // Getters
   uint16_t getRefreshInterval() const { return settings.refreshInterval; }
   uint8_t getDisplayMode() const { return settings.displayMode; }
+  bool isAdaptiveRefresh() const { return settings.adaptiveRefresh != 0; }
+  uint16_t getAdaptiveMinInterval() const;
+  uint16_t getAdaptiveMaxInterval() const;
+  uint8_t getBacklightFull() const { return settings.backlightFull ? settings.backlightFull : 255; }
+  uint8_t getBacklightDim() const { return settings.backlightDim ? settings.backlightDim : 40; }
   
   // Setters
   void setRefreshInterval(uint16_t interval);
   void setDisplayMode(uint8_t mode);
+  void setAdaptiveRefresh(bool enabled);
+  void setAdaptiveBounds(uint16_t minMs, uint16_t maxMs);
+  void setBacklightLevels(uint8_t full, uint8_t dim);
+  
+  // Alert rules (fixed slots, see AlertEngine)
+  const AlertRule* getAlertRules() const { return alerts.rules; }
+  bool setAlertRule(uint8_t slot, const AlertRule& rule);  // false = invalid slot/metric
+  bool saveAlerts();
+  void resetAlerts();  // Built-in defaults (not saved)
   
   // Validation
   bool isValid() const { return settings.magic == SETTINGS_MAGIC; }
   
   // Refresh rate helpers
   const char* getRefreshRateText() const;
-  void cycleRefreshRate();  // Cycle through available rates
+  void cycleRefreshRate();  // Cycle through available rates (incl. Auto)
+  
+  // Brightness helpers
+  const char* getBrightnessText() const;
+  void cycleBrightness();   // 100% -> 75% -> 50% -> 25% -> 100%
 };
 
 #endif // SETTINGS_MANAGER_H
@@ -7,20 +7,51 @@
 #define SYSTEM_DATA_H
 
 #include <Arduino.h>
+#include "fixed_point.h"
 
-// System data struct
+#ifndef DISK_MAX
+  #define DISK_MAX 8  // Disks kept per sample (the bridge is asked for no more)
+#endif
+
+#ifndef NIC_MAX
+  #define NIC_MAX 4   // Network interfaces kept per sample
+#endif
+
+#ifndef CORE_MAX
+  #define CORE_MAX 128  // Logical CPUs kept for the core heatmap (2 bytes each)
+#endif
+
+// One disk / network interface - fixed size, filled without heap allocation
+struct DiskInfo {
+  static constexpr uint8_t NAME_LEN = 12;
+  char name[NAME_LEN];                      // Model, cut to NAME_LEN - 1 chars
+  fixed10_t temp, load;                     // °C, % used space
+};
+
+struct NicInfo {
+  static constexpr uint8_t NAME_LEN = 12;
+  char name[NAME_LEN];
+  fixed10_t down, up;                       // Mb/s
+};
+
+// System data struct (metrics are fixed10_t = value * 10, see fixed_point.h)
 struct SystemData {
+  String hostName;                          // Bridge machine name (empty on older bridges)
   String cpuName;
-  float cpuTemp, cpuLoad, cpuPower;
-  float ramUsed, ramTotal, ramPercent;
+  fixed10_t cpuTemp, cpuLoad, cpuPower;     // °C, %, W
+  fixed10_t ramUsed, ramTotal, ramPercent;  // GB, GB, %
   String gpuName;
-  float gpuTemp, gpuLoad, gpuPower;
-  int gpuMemUsed, gpuMemTotal;
-  String disk1Name, disk2Name;
-  float disk1Temp, disk1Load, disk2Temp, disk2Load;
-  String netName;
-  float netDown, netUp;
-  bool hasData;
+  fixed10_t gpuTemp, gpuLoad, gpuPower;     // °C, %, W
+  int gpuMemUsed, gpuMemTotal;              // MB (plain integers)
+  DiskInfo disks[DISK_MAX];
+  uint8_t diskCount;
+  NicInfo nics[NIC_MAX];
+  uint8_t nicCount;
+  uint8_t coreLoad[CORE_MAX];               // % per logical CPU
+  uint8_t coreClock[CORE_MAX];              // 100 MHz units (0 = unknown)
+  uint8_t coreCount;
+  uint32_t layoutId;                        // CRC32 of the bridge's layout descriptor (0 = none)
+  bool hasData;                             // A sample has arrived (kept through outages)
   
   // Constructor
   SystemData() : 
@@ -28,9 +59,16 @@ struct SystemData {
     ramUsed(0), ramTotal(0), ramPercent(0),
     gpuTemp(0), gpuLoad(0), gpuPower(0),
     gpuMemUsed(0), gpuMemTotal(0),
-    disk1Temp(0), disk1Load(0), disk2Temp(0), disk2Load(0),
-    netDown(0), netUp(0),
+    disks(), diskCount(0), nics(), nicCount(0),
+    coreLoad(), coreClock(), coreCount(0), layoutId(0),
     hasData(false) {}
+  
+  // Traffic over all interfaces (Mb/s)
+  fixed10_t netTotal() const {
+    fixed10_t total = 0;
+    for (uint8_t i = 0; i < nicCount; i++) total += nics[i].down + nics[i].up;
+    return total;
+  }
 };
 
 // Gaming Color Palette (RGB565)
@@ -43,5 +81,6 @@ struct SystemData {
 #define COLOR_DISK     0x051F  // Deep Blue (storage)
 #define COLOR_NET      0x841F  // Purple (network)
 #define COLOR_VRAM     0xF81F  // Magenta (VRAM)
+#define COLOR_ALERT    0xFFE0  // Yellow (alert border)
 
 #endif // SYSTEM_DATA_H
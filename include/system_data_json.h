@@ -0,0 +1,26 @@
+/*
+ * System Data JSON Module
+ * Đọc JSON /system-info thành SystemData (dùng chung cho NetworkManager, HostPoller)
+ *
+ * Không phụ thuộc WiFi/phần cứng - build được trên host (env:native) để
+ * replay dữ liệu đã ghi (tools/replay).
+ */
+
+#ifndef SYSTEM_DATA_JSON_H
+#define SYSTEM_DATA_JSON_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "system_data.h"
+
+namespace SystemDataJson {
+  constexpr size_t FILTER_CAPACITY = 640;  // StaticJsonDocument for buildFilter()
+  
+  // Deserialization filter: only the fields parse() reads
+  void buildFilter(JsonDocument& filter);
+  
+  // Copy a /system-info document into data (fixed=1 or float replies)
+  void parse(JsonDocument& doc, SystemData& data);
+}
+
+#endif // SYSTEM_DATA_JSON_H
@@ -0,0 +1,562 @@
+/*
+ * Web Assets (GENERATED - do not edit)
+ * Sinh tự động bởi web/embed_web_assets.py từ các file trong web/
+ */
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+// config_cancelled.html: 398 -> 300 bytes (gzip)
+static const uint8_t WEB_CONFIG_CANCELLED_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x4d, 0x90, 0x4b, 0x4f, 0xc4, 0x30,
+  0x0c, 0x84, 0xef, 0xfd, 0x15, 0x45, 0x1c, 0x7a, 0xa1, 0xed, 0x16, 0xc1, 0x02, 0x69, 0xda, 0xcb,
+  0x02, 0x57, 0x10, 0x82, 0x03, 0x47, 0x6f, 0xe2, 0xb6, 0x16, 0x69, 0x52, 0x25, 0xde, 0x17, 0xab,
+  0xfd, 0xef, 0xb4, 0xfb, 0x90, 0x38, 0x8d, 0x6c, 0x8f, 0x3e, 0x8d, 0x47, 0x5e, 0x3d, 0xbf, 0x2d,
+  0x3e, 0xbf, 0xdf, 0x5f, 0xe2, 0x8e, 0x7b, 0x53, 0x47, 0xf2, 0x22, 0x08, 0x7a, 0x94, 0x1e, 0x19,
+  0x62, 0xd5, 0x81, 0x0f, 0xc8, 0x55, 0xf2, 0xf5, 0xf9, 0x9a, 0x3e, 0x26, 0x97, 0xb5, 0x85, 0x1e,
+  0xab, 0x64, 0x4d, 0xb8, 0x19, 0x9c, 0xe7, 0x24, 0x56, 0xce, 0x32, 0xda, 0xd1, 0xb6, 0x21, 0xcd,
+  0x5d, 0xa5, 0x71, 0x4d, 0x0a, 0xd3, 0xe3, 0x70, 0x43, 0x96, 0x98, 0xc0, 0xa4, 0x41, 0x81, 0xc1,
+  0xaa, 0x98, 0x18, 0x4c, 0x6c, 0xb0, 0x5e, 0x80, 0x55, 0x68, 0x0c, 0x6a, 0x99, 0x9f, 0x16, 0x91,
+  0x0c, 0xbc, 0x9b, 0x74, 0xe9, 0xf4, 0x6e, 0xdf, 0x8c, 0xcc, 0xb4, 0x81, 0x9e, 0xcc, 0x4e, 0x04,
+  0xb0, 0x21, 0x0d, 0xe8, 0xa9, 0x29, 0x97, 0xa0, 0x7e, 0x5a, 0xef, 0x56, 0x56, 0x8b, 0xeb, 0xf9,
+  0xfc, 0x01, 0x11, 0x4a, 0xe5, 0x8c, 0xf3, 0x62, 0xd3, 0x11, 0x63, 0xc9, 0xb8, 0xe5, 0x14, 0x0c,
+  0xb5, 0x56, 0xa8, 0x31, 0x11, 0xfa, 0x72, 0x00, 0xad, 0xc9, 0xb6, 0xe2, 0x7e, 0x36, 0x6c, 0x0f,
+  0x51, 0x57, 0x9c, 0xc0, 0x81, 0x7e, 0x51, 0xdc, 0xde, 0x0d, 0xdb, 0xb2, 0x07, 0xdf, 0x92, 0x4d,
+  0x97, 0x8e, 0xd9, 0xf5, 0xa2, 0x98, 0x4f, 0xae, 0x61, 0xef, 0x06, 0x50, 0xc4, 0x3b, 0x31, 0xcb,
+  0x9e, 0x0e, 0x91, 0xcc, 0xcf, 0xc1, 0x64, 0x7e, 0x2e, 0x67, 0x4a, 0x38, 0x55, 0x55, 0xd4, 0x0b,
+  0x67, 0x1b, 0x6a, 0x57, 0x1e, 0x98, 0x9c, 0x8d, 0xff, 0xfd, 0x34, 0xde, 0x22, 0x39, 0xd4, 0x1f,
+  0x18, 0x18, 0x3c, 0x8f, 0x09, 0xe2, 0x53, 0x2d, 0x59, 0x96, 0xc9, 0x7c, 0x98, 0x58, 0x67, 0x48,
+  0x7e, 0xec, 0xfd, 0x0f, 0x36, 0xa3, 0x36, 0x55, 0x8e, 0x01, 0x00, 0x00,
+};
+static const size_t WEB_CONFIG_CANCELLED_GZ_LEN = 300;
+
+// config_error.html: template, 1777 bytes, keys: ERROR
+static const char WEB_CONFIG_ERROR_TPL[] PROGMEM =
+  "<!DOCTYPE html>\n"
+  "<html>\n"
+  "<head>\n"
+  "<meta charset='UTF-8'>\n"
+  "<meta name='viewport' content='width=device-width,initial-scale=1'>\n"
+  "<title>Configuration Error</title>\n"
+  "<style>\n"
+  "*{box-sizing:border-box;margin:0;padding:0}\n"
+  "body{font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',Roboto,sans-serif;background:linear-gradient(135deg,#f093fb 0%,#f5576c 100%);min-height:100vh;padding:20px;display:flex;align-items:center;justify-content:center}\n"
+  ".container{max-width:500px;background:white;border-radius:12px;box-shadow:0 8px 32px rgba(0,0,0,0.1);overflow:hidden}\n"
+  ".header{background:#dc3545;color:white;padding:32px;text-align:center}\n"
+  ".header h1{font-size:24px;font-weight:600;margin-bottom:8px}\n"
+  ".cross{width:60px;height:60px;border:3px solid white;border-radius:50%;margin:0 auto 16px;position:relative}\n"
+  ".cross:before,.cross:after{content:'';position:absolute;width:3px;height:30px;background:white;top:15px;left:28px}\n"
+  ".cross:before{transform:rotate(45deg)}\n"
+  ".cross:after{transform:rotate(-45deg)}\n"
+  ".content{padding:32px;text-align:center}\n"
+  ".error-box{background:#f8d7da;padding:20px;border-radius:8px;margin-bottom:24px;border-left:4px solid #dc3545}\n"
+  ".error-message{color:#721c24;font-size:14px;line-height:1.6}\n"
+  ".retry-btn{display:inline-block;background:linear-gradient(135deg,#667eea 0%,#764ba2 100%);color:white;padding:12px 32px;border-radius:8px;text-decoration:none;font-weight:600;transition:transform 0.2s}\n"
+  ".retry-btn:hover{transform:translateY(-2px)}\n"
+  "</style>\n"
+  "</head>\n"
+  "<body>\n"
+  "<div class='container'>\n"
+  "<div class='header'>\n"
+  "<div class='cross'></div>\n"
+  "<h1>Configuration Error</h1>\n"
+  "<p>Unable to complete setup</p>\n"
+  "</div>\n"
+  "<div class='content'>\n"
+  "<div class='error-box'>\n"
+  "<div class='error-message'>{{ERROR}}</div>\n"
+  "</div>\n"
+  "<a href='/' class='retry-btn'>Try Again</a>\n"
+  "</div>\n"
+  "</div>\n"
+  "</body>\n"
+  "</html>\n";
+
+// config_server.html: 4108 -> 1670 bytes (gzip)
+static const uint8_t WEB_CONFIG_SERVER_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x57, 0x5b, 0x6f, 0x9b, 0x48,
+  0x14, 0x7e, 0xcf, 0xaf, 0x98, 0x55, 0xd4, 0xe2, 0xec, 0x1a, 0x1b, 0x9c, 0xd8, 0x71, 0xf0, 0x45,
+  0xea, 0xa6, 0xad, 0x5a, 0xa9, 0x97, 0xa8, 0x6e, 0xb4, 0xaa, 0x56, 0xfb, 0x30, 0xc0, 0x60, 0x46,
+  0x85, 0x19, 0xc4, 0x0c, 0xb1, 0x5d, 0x2b, 0xff, 0x7d, 0xcf, 0x5c, 0x20, 0x60, 0x3b, 0x55, 0x57,
+  0x2b, 0x3f, 0x60, 0xe6, 0x72, 0xce, 0x77, 0xbe, 0x73, 0x65, 0xfe, 0xdb, 0xeb, 0xcf, 0xb7, 0x5f,
+  0xbf, 0xdd, 0xbd, 0x41, 0xa9, 0xcc, 0xb3, 0xe5, 0xd9, 0xbc, 0x7e, 0x10, 0x1c, 0xc3, 0x23, 0x27,
+  0x12, 0xa3, 0x28, 0xc5, 0xa5, 0x20, 0x72, 0xe1, 0xdc, 0x7f, 0x7d, 0xeb, 0x4e, 0x9d, 0x7a, 0x99,
+  0xe1, 0x9c, 0x2c, 0x9c, 0x07, 0x4a, 0x36, 0x05, 0x2f, 0xa5, 0x83, 0x22, 0xce, 0x24, 0x61, 0x70,
+  0x6c, 0x43, 0x63, 0x99, 0x2e, 0x62, 0xf2, 0x40, 0x23, 0xe2, 0xea, 0x97, 0x3e, 0x65, 0x54, 0x52,
+  0x9c, 0xb9, 0x22, 0xc2, 0x19, 0x59, 0xf8, 0x4a, 0x86, 0xa4, 0x32, 0x23, 0xcb, 0x37, 0xab, 0xbb,
+  0xe9, 0x68, 0x32, 0x41, 0xb7, 0x9c, 0x25, 0x74, 0x5d, 0x95, 0x58, 0x52, 0xce, 0xe6, 0x43, 0xb3,
+  0x79, 0x36, 0x17, 0x72, 0xa7, 0x9e, 0xbf, 0xef, 0x43, 0xbe, 0x75, 0x05, 0xfd, 0x41, 0xd9, 0x3a,
+  0x08, 0x79, 0x19, 0x93, 0xd2, 0x85, 0x95, 0x59, 0x8e, 0xcb, 0x35, 0x65, 0x81, 0x37, 0x2b, 0x70,
+  0x1c, 0xab, 0x3d, 0xef, 0xf1, 0x2c, 0xe4, 0xf1, 0x6e, 0x9f, 0x00, 0x16, 0x37, 0xc1, 0x39, 0xcd,
+  0x76, 0x81, 0x8b, 0x8b, 0x22, 0x23, 0xae, 0xd8, 0x09, 0x49, 0xf2, 0xfe, 0x9f, 0x19, 0x65, 0xdf,
+  0x3f, 0xe2, 0x68, 0xa5, 0x5f, 0xdf, 0xc2, 0xb9, 0xbe, 0xb3, 0x22, 0x6b, 0x4e, 0xd0, 0xfd, 0x7b,
+  0xa7, 0xff, 0x85, 0x87, 0x5c, 0xf2, 0xbe, 0xc0, 0x4c, 0xb8, 0x82, 0x94, 0x34, 0x99, 0x85, 0x38,
+  0xfa, 0xbe, 0x2e, 0x79, 0xc5, 0xe2, 0x00, 0x6e, 0x12, 0x5c, 0xba, 0xeb, 0x12, 0xc7, 0x14, 0x0c,
+  0xed, 0xf9, 0x97, 0xe3, 0x98, 0xac, 0xfb, 0xe7, 0x93, 0xc9, 0x35, 0x21, 0x18, 0x79, 0x2f, 0xfa,
+  0xe7, 0xd7, 0x93, 0xab, 0x10, 0x8f, 0x90, 0xef, 0x79, 0x2f, 0x2e, 0x66, 0x39, 0x65, 0x6e, 0x4a,
+  0xe8, 0x3a, 0x95, 0x01, 0x2c, 0x3c, 0xa4, 0x0d, 0xca, 0x91, 0x57, 0x6c, 0x1f, 0xcf, 0x06, 0x8a,
+  0x30, 0x0c, 0x32, 0xcb, 0x7d, 0x8e, 0xb7, 0x86, 0xa8, 0x60, 0xe2, 0xc1, 0x5e, 0x6d, 0xd7, 0x15,
+  0xfc, 0x47, 0xb8, 0x92, 0xbc, 0x8d, 0x62, 0x93, 0x52, 0x49, 0x66, 0x96, 0x04, 0x05, 0xa5, 0x12,
+  0x81, 0x3f, 0x82, 0x4b, 0x9a, 0xa2, 0x14, 0xc7, 0x7c, 0x13, 0x78, 0x68, 0x0a, 0x37, 0x2f, 0x61,
+  0x15, 0x95, 0xeb, 0x10, 0xf7, 0xbc, 0xbe, 0xfe, 0x0d, 0xfc, 0x8b, 0x19, 0x7f, 0x20, 0x65, 0x92,
+  0xc1, 0x99, 0x94, 0xc6, 0x31, 0x61, 0x00, 0x43, 0xb9, 0x1a, 0x30, 0xb4, 0x54, 0x9c, 0x8f, 0xa2,
+  0x4b, 0x32, 0xf6, 0x66, 0x11, 0xcf, 0x78, 0x69, 0x15, 0x36, 0xd8, 0xaf, 0x40, 0x95, 0x24, 0x5b,
+  0xe9, 0xe2, 0x8c, 0xae, 0x59, 0x10, 0x01, 0x13, 0xa4, 0x6c, 0xc4, 0xa0, 0xd4, 0x37, 0xe4, 0x83,
+  0xb3, 0x88, 0x39, 0xac, 0x5f, 0x37, 0x86, 0x07, 0x30, 0xcf, 0x1a, 0x07, 0xfe, 0x93, 0x92, 0xe7,
+  0xc1, 0x54, 0x53, 0x61, 0x2f, 0x17, 0xad, 0xbb, 0xbe, 0xba, 0xcb, 0x0b, 0x1c, 0x51, 0xb9, 0x0b,
+  0xbc, 0xc1, 0x8d, 0x25, 0x0c, 0xd4, 0xed, 0x6b, 0x2c, 0xca, 0x40, 0x58, 0x06, 0x47, 0x16, 0x2e,
+  0x65, 0x31, 0x8d, 0xb0, 0xe4, 0x5d, 0x43, 0x92, 0x69, 0x72, 0x93, 0xe0, 0x06, 0xbc, 0xe2, 0x09,
+  0xf9, 0x13, 0x4d, 0x56, 0x9b, 0xbf, 0x69, 0xc3, 0x79, 0x0d, 0x4b, 0x23, 0xb7, 0x87, 0x32, 0x92,
+  0xc8, 0x00, 0xde, 0x91, 0xe0, 0x19, 0x8d, 0x91, 0xf5, 0xf7, 0x91, 0x62, 0x24, 0x64, 0xc9, 0xd9,
+  0x7a, 0x1f, 0x53, 0x51, 0x64, 0x78, 0x17, 0x84, 0x19, 0x8f, 0xbe, 0x5b, 0x0e, 0x6b, 0x46, 0xbb,
+  0x4a, 0xae, 0x4e, 0xc0, 0x47, 0xa2, 0xc0, 0xac, 0x4d, 0xc3, 0x25, 0x00, 0xb1, 0x42, 0x26, 0xd1,
+  0xf5, 0xf8, 0x3a, 0x86, 0x2b, 0xeb, 0x8a, 0xc6, 0xe4, 0x67, 0x86, 0xaa, 0x08, 0xfb, 0x25, 0x1b,
+  0x6b, 0x61, 0xae, 0xce, 0xb8, 0xfd, 0xa1, 0xaf, 0x7e, 0x86, 0x5e, 0x07, 0x5d, 0x0b, 0xe8, 0xb8,
+  0x25, 0x4d, 0xd9, 0x24, 0x0e, 0xad, 0x50, 0xf9, 0xd3, 0x24, 0xc4, 0x60, 0x5a, 0x0b, 0xbf, 0xba,
+  0x19, 0x7b, 0xe3, 0xeb, 0xee, 0x55, 0xc4, 0xb3, 0xbd, 0xd5, 0xa6, 0xd9, 0xb7, 0x19, 0xd3, 0x3e,
+  0x91, 0xd1, 0xfd, 0xa9, 0x48, 0x6a, 0x1f, 0x89, 0xf8, 0x01, 0x4b, 0xe4, 0x86, 0x44, 0x24, 0x79,
+  0x62, 0x09, 0x7c, 0x3a, 0x3d, 0x22, 0xaa, 0x89, 0x59, 0x5b, 0x3f, 0x72, 0xce, 0x38, 0x38, 0x25,
+  0x22, 0x6d, 0x63, 0x4d, 0xe4, 0x25, 0xbc, 0xcc, 0x5d, 0x25, 0xbc, 0x38, 0xc0, 0x62, 0xf0, 0x66,
+  0x38, 0x24, 0xd9, 0x41, 0x3c, 0x1c, 0x61, 0x3e, 0xe0, 0xb8, 0xed, 0x81, 0xb1, 0xe7, 0xcd, 0xba,
+  0x09, 0xf1, 0x78, 0x46, 0x59, 0x51, 0xc9, 0xbe, 0x4a, 0x40, 0x5c, 0x12, 0xbc, 0x37, 0x55, 0x43,
+  0xd5, 0x9b, 0x67, 0x83, 0x5c, 0x9b, 0x69, 0x43, 0xd7, 0x12, 0x70, 0x1c, 0x19, 0x07, 0x79, 0x27,
+  0x4b, 0xa8, 0x80, 0x54, 0xd5, 0x62, 0x5b, 0x6e, 0x91, 0x37, 0xb8, 0x14, 0x8f, 0x67, 0x8d, 0xde,
+  0xd3, 0x04, 0x95, 0x44, 0x8b, 0x80, 0x12, 0x23, 0x21, 0x9a, 0x33, 0x8b, 0x36, 0x48, 0x78, 0x54,
+  0x89, 0x06, 0xb3, 0x79, 0xdd, 0xf3, 0x4a, 0xaa, 0x80, 0x08, 0x18, 0x67, 0x4d, 0x39, 0xab, 0xe3,
+  0xbc, 0x4e, 0x30, 0xb2, 0xc5, 0x79, 0x51, 0x87, 0x65, 0x43, 0x7c, 0x37, 0x1d, 0x6a, 0x46, 0x25,
+  0x2f, 0x4c, 0x42, 0x85, 0x15, 0x50, 0xcb, 0xf6, 0xff, 0xa3, 0x70, 0x9f, 0xaa, 0x7b, 0xfe, 0x53,
+  0x41, 0xe8, 0x40, 0x6e, 0x71, 0x18, 0x55, 0xa5, 0x80, 0x7b, 0x05, 0xa7, 0xaa, 0x24, 0xce, 0x5a,
+  0xae, 0xe9, 0x66, 0xc9, 0x73, 0x15, 0x51, 0x59, 0x30, 0xed, 0x92, 0xaf, 0xff, 0xaa, 0x28, 0x03,
+  0xfe, 0x47, 0xa2, 0xb6, 0x2d, 0x48, 0x55, 0x15, 0xdf, 0x37, 0x9b, 0xe6, 0x58, 0x86, 0x25, 0xf9,
+  0xd6, 0x73, 0x81, 0xa0, 0x8b, 0xc7, 0xb3, 0xf9, 0xd0, 0xb6, 0xce, 0xf9, 0xd0, 0xb6, 0x72, 0xd5,
+  0x17, 0xe1, 0x11, 0xd3, 0x07, 0x14, 0x65, 0x58, 0x88, 0x85, 0xd3, 0xf4, 0x1f, 0xa7, 0xbb, 0x6e,
+  0x8a, 0xb1, 0x5a, 0x4c, 0xfd, 0xa6, 0x41, 0x9b, 0x7e, 0x89, 0x3e, 0x72, 0xe8, 0xe4, 0xbc, 0x04,
+  0xa9, 0x3e, 0xec, 0x17, 0xcb, 0x15, 0x29, 0x01, 0x4a, 0xb7, 0x7d, 0xa3, 0x15, 0x91, 0x55, 0x31,
+  0x1f, 0x16, 0x4a, 0x3b, 0xc8, 0x3d, 0xd6, 0x0a, 0x4e, 0x38, 0xd0, 0xd9, 0x2d, 0x82, 0x8e, 0x6e,
+  0xfd, 0xaa, 0x9a, 0x2e, 0x57, 0xb0, 0x81, 0x7c, 0xc4, 0x13, 0x34, 0x52, 0x36, 0xe9, 0x35, 0xd8,
+  0x84, 0x22, 0xb9, 0xac, 0x95, 0x12, 0x74, 0xb7, 0x93, 0x29, 0xe8, 0x15, 0x06, 0x0c, 0x68, 0x60,
+  0x24, 0x32, 0x83, 0x84, 0x3e, 0x78, 0x0a, 0x86, 0xae, 0x13, 0xce, 0x89, 0x35, 0x53, 0x09, 0x9d,
+  0xe5, 0x3b, 0xbe, 0x41, 0x92, 0x2b, 0x61, 0x56, 0xc9, 0x93, 0xa9, 0x56, 0x7a, 0xf0, 0x9c, 0x58,
+  0x53, 0x7e, 0x94, 0x70, 0xae, 0x66, 0xa9, 0x8c, 0x2e, 0x6b, 0x6b, 0x3e, 0x70, 0x48, 0x0b, 0xf4,
+  0x89, 0xc8, 0x0d, 0x2f, 0xbf, 0x07, 0x8d, 0x41, 0xe8, 0x5e, 0x10, 0xf4, 0xfe, 0x0e, 0x41, 0xac,
+  0x41, 0x0a, 0x09, 0xf4, 0x07, 0xba, 0x83, 0x91, 0x6a, 0x1e, 0x96, 0xcb, 0xb9, 0xaa, 0x61, 0x4b,
+  0xff, 0x66, 0x34, 0xf0, 0x27, 0xd3, 0x81, 0x3f, 0x80, 0x70, 0x9a, 0x0f, 0xf5, 0x1a, 0xda, 0x50,
+  0x99, 0x22, 0x35, 0x7a, 0x21, 0x73, 0x68, 0xea, 0x4d, 0xeb, 0xbd, 0xf9, 0x10, 0x74, 0x76, 0x14,
+  0xdf, 0x55, 0x61, 0x46, 0x23, 0xf4, 0x9a, 0xe7, 0xe0, 0xf1, 0x03, 0xc5, 0xf7, 0x5f, 0x3e, 0x20,
+  0xce, 0xb2, 0xdd, 0x93, 0x3e, 0x9b, 0x77, 0xd0, 0x70, 0xf3, 0x5a, 0x5b, 0x2f, 0x23, 0xf8, 0x81,
+  0x18, 0x7d, 0x24, 0x2f, 0xe4, 0x0e, 0x41, 0xe4, 0xa1, 0x60, 0xea, 0x5d, 0x1c, 0x2b, 0xbb, 0xad,
+  0x04, 0x14, 0x37, 0x6d, 0xc3, 0x81, 0xaa, 0x58, 0xeb, 0x3f, 0xb2, 0xef, 0x84, 0xbe, 0x5f, 0xb2,
+  0x4e, 0x49, 0x41, 0x14, 0xba, 0x45, 0xa1, 0xfc, 0x01, 0xcc, 0xba, 0x28, 0x26, 0x09, 0xae, 0x32,
+  0x29, 0x94, 0xef, 0xea, 0x9b, 0xb5, 0x4c, 0x9a, 0x18, 0xe8, 0xc7, 0x88, 0x5f, 0xc1, 0x90, 0xd5,
+  0x82, 0x6a, 0x6c, 0x95, 0x29, 0x69, 0x3c, 0x62, 0x4c, 0x76, 0xf5, 0x5a, 0x58, 0xd2, 0x78, 0x4d,
+  0x94, 0xde, 0x44, 0x95, 0x17, 0xe0, 0x4e, 0x2f, 0x67, 0xda, 0xb7, 0xcc, 0xf8, 0x16, 0x61, 0xd8,
+  0x30, 0xdb, 0x78, 0xad, 0x4c, 0x06, 0xdd, 0x14, 0x50, 0x81, 0x93, 0x61, 0x9c, 0x66, 0x6b, 0x22,
+  0x2c, 0x88, 0xa1, 0x0e, 0x11, 0x1b, 0x48, 0xf6, 0xa1, 0x13, 0x1e, 0xeb, 0x18, 0x5b, 0x38, 0x43,
+  0x13, 0xd5, 0x0e, 0x82, 0xa1, 0x3b, 0xe5, 0xf1, 0xc2, 0xb9, 0xfb, 0xbc, 0xfa, 0x7a, 0x10, 0xb8,
+  0x4f, 0x7d, 0x48, 0x6d, 0xe8, 0xb6, 0x53, 0x67, 0xe6, 0x2b, 0x6b, 0x40, 0x0f, 0x34, 0x83, 0xc3,
+  0x4c, 0x00, 0x28, 0x9f, 0xe9, 0x43, 0x67, 0x73, 0x5d, 0xa1, 0x91, 0xdc, 0x15, 0x30, 0xcb, 0xab,
+  0x0a, 0xed, 0xd8, 0xb9, 0x9e, 0x16, 0x0e, 0x82, 0xb6, 0x15, 0x91, 0x94, 0x67, 0x50, 0x0d, 0x16,
+  0x4e, 0x27, 0x06, 0x95, 0xa8, 0x96, 0xd3, 0x0e, 0xe0, 0xd8, 0x1d, 0x67, 0xf9, 0xc6, 0xfc, 0x11,
+  0x01, 0xea, 0xdc, 0xee, 0x23, 0x1c, 0x46, 0xf1, 0x60, 0xbb, 0xfb, 0xd1, 0xb7, 0x39, 0x3b, 0xd0,
+  0xe4, 0x0d, 0xd0, 0x07, 0x4d, 0xbc, 0x21, 0x1b, 0x1c, 0x98, 0x40, 0x45, 0x68, 0x53, 0xae, 0x66,
+  0xe1, 0x1c, 0xeb, 0xde, 0x92, 0xed, 0x50, 0x2f, 0x7f, 0xfd, 0x69, 0x05, 0x12, 0x00, 0x6f, 0x43,
+  0xbb, 0x8a, 0xe3, 0x8b, 0xc1, 0x01, 0x9f, 0xbf, 0xc6, 0x94, 0x0e, 0xa6, 0x5e, 0x1d, 0x4a, 0xcf,
+  0x50, 0xc4, 0xaa, 0x3c, 0x54, 0xce, 0x30, 0x24, 0x99, 0x0f, 0x9f, 0x0e, 0x4d, 0x53, 0x0f, 0xf5,
+  0x6c, 0x0c, 0x5e, 0x38, 0xe8, 0x01, 0x67, 0x15, 0x9c, 0x03, 0xe7, 0x51, 0x70, 0xa5, 0x0f, 0x4f,
+  0xbc, 0x5d, 0x38, 0x93, 0xf1, 0xf8, 0x72, 0xfc, 0x1c, 0x67, 0x6d, 0x0a, 0x54, 0x8a, 0xe9, 0x1c,
+  0x98, 0x02, 0x67, 0x8a, 0x72, 0xd5, 0x58, 0x50, 0x64, 0xd2, 0x4b, 0x6f, 0xf4, 0xc8, 0x60, 0x3d,
+  0x40, 0x2a, 0x39, 0x2e, 0xfe, 0x9b, 0xd1, 0x10, 0x17, 0xd4, 0x26, 0xcd, 0x3b, 0x2e, 0x20, 0x32,
+  0x4f, 0x59, 0x5e, 0xb7, 0x6c, 0x6b, 0x6e, 0xaa, 0x0e, 0x3a, 0xa8, 0xe4, 0x1b, 0x10, 0x7a, 0xf9,
+  0x93, 0xf8, 0xf0, 0x03, 0x85, 0xe8, 0xe5, 0xb9, 0xef, 0xcd, 0xc2, 0x8a, 0x66, 0x31, 0x7c, 0x9a,
+  0x18, 0x0f, 0x3b, 0x90, 0xbc, 0xb5, 0xd0, 0x67, 0xec, 0xff, 0x0c, 0xfe, 0x06, 0x67, 0xdc, 0x0a,
+  0x54, 0x56, 0x8c, 0x41, 0xeb, 0x6d, 0x05, 0x00, 0x90, 0xc0, 0x88, 0x4d, 0x6b, 0x05, 0xe6, 0xef,
+  0x40, 0x91, 0xf0, 0x4f, 0x9d, 0xdf, 0x05, 0x5c, 0x54, 0xbd, 0x1e, 0xf5, 0x34, 0x37, 0xed, 0x52,
+  0xa0, 0x19, 0x1a, 0xa0, 0x55, 0xca, 0x37, 0x0c, 0x61, 0xc8, 0xe7, 0x2d, 0xf4, 0x4c, 0x14, 0x63,
+  0x91, 0x86, 0x1c, 0x97, 0x31, 0x2a, 0x30, 0xa4, 0xe4, 0x61, 0xdc, 0x98, 0x6e, 0x6b, 0x3d, 0x2f,
+  0xaa, 0x30, 0xa7, 0xd0, 0xb6, 0xa0, 0xfe, 0x4b, 0xca, 0x2a, 0xa2, 0xa4, 0xfe, 0x45, 0xdf, 0xd2,
+  0xba, 0xdb, 0x99, 0xc3, 0xea, 0xb2, 0xa2, 0xfb, 0x28, 0x8b, 0x23, 0xcc, 0x22, 0x92, 0x1d, 0x64,
+  0x31, 0xd2, 0x4d, 0x7a, 0xe1, 0xb4, 0x06, 0x00, 0x35, 0xe0, 0x38, 0xcf, 0xe8, 0xae, 0x8f, 0xb7,
+  0x47, 0x5a, 0x33, 0x04, 0x01, 0x2c, 0x2d, 0x1f, 0xbd, 0x04, 0x16, 0x67, 0xe8, 0x0b, 0x11, 0x40,
+  0xb1, 0x3c, 0x01, 0xaa, 0x6b, 0xe0, 0xd0, 0x0e, 0x05, 0x43, 0xfd, 0xd5, 0xff, 0x2f, 0x9a, 0xcf,
+  0xec, 0x59, 0x0c, 0x10, 0x00, 0x00,
+};
+static const size_t WEB_CONFIG_SERVER_GZ_LEN = 1670;
+
+// config_success.html: template, 2342 bytes, keys: AP_SSID, SERVER
+static const char WEB_CONFIG_SUCCESS_TPL[] PROGMEM =
+  "<!DOCTYPE html>\n"
+  "<html>\n"
+  "<head>\n"
+  "<meta charset='UTF-8'>\n"
+  "<meta name='viewport' content='width=device-width,initial-scale=1'>\n"
+  "<title>Configuration Saved</title>\n"
+  "<style>\n"
+  "*{box-sizing:border-box;margin:0;padding:0}\n"
+  "body{font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',Roboto,sans-serif;background:linear-gradient(135deg,#11998e 0%,#38ef7d 100%);min-height:100vh;padding:20px;display:flex;align-items:center;justify-content:center}\n"
+  ".container{max-width:500px;background:white;border-radius:12px;box-shadow:0 8px 32px rgba(0,0,0,0.1);overflow:hidden}\n"
+  ".header{background:#28a745;color:white;padding:32px;text-align:center}\n"
+  ".header h1{font-size:24px;font-weight:600;margin-bottom:8px}\n"
+  ".check{width:60px;height:60px;border:3px solid white;border-radius:50%;margin:0 auto 16px;position:relative}\n"
+  ".check:after{content:'';position:absolute;width:12px;height:24px;border:solid white;border-width:0 3px 3px 0;top:12px;left:20px;transform:rotate(45deg)}\n"
+  ".content{padding:32px;text-align:center}\n"
+  ".config-box{background:#f8f9fa;padding:16px;border-radius:8px;margin-bottom:24px}\n"
+  ".config-label{font-size:12px;color:#6c757d;text-transform:uppercase;letter-spacing:0.5px;margin-bottom:4px}\n"
+  ".config-value{font-size:18px;color:#2c3e50;font-weight:600}\n"
+  ".next-steps{background:#fff3cd;padding:20px;border-radius:8px;text-align:left}\n"
+  ".next-steps-title{font-weight:600;color:#856404;margin-bottom:12px}\n"
+  ".next-steps ol{margin-left:20px;color:#856404}\n"
+  ".next-steps li{margin-bottom:8px;line-height:1.6}\n"
+  ".next-steps strong{color:#2c3e50}\n"
+  ".status{color:#6c757d;font-size:14px;margin-top:20px}\n"
+  "</style>\n"
+  "</head>\n"
+  "<body>\n"
+  "<div class='container'>\n"
+  "<div class='header'>\n"
+  "<div class='check'></div>\n"
+  "<h1>Configuration Saved</h1>\n"
+  "<p>Step 1 completed successfully</p>\n"
+  "</div>\n"
+  "<div class='content'>\n"
+  "<div class='config-box'>\n"
+  "<div class='config-label'>Server Connection</div>\n"
+  "<div class='config-value'>{{SERVER}}</div>\n"
+  "</div>\n"
+  "<div class='next-steps'>\n"
+  "<div class='next-steps-title'>Next: WiFi Configuration</div>\n"
+  "<ol>\n"
+  "<li>Device will reboot to WiFi setup mode</li>\n"
+  "<li>Reconnect to access point: <strong>{{AP_SSID}}</strong></li>\n"
+  "<li>Select your WiFi network</li>\n"
+  "<li>Enter WiFi password</li>\n"
+  "<li>Configuration complete</li>\n"
+  "</ol>\n"
+  "</div>\n"
+  "<div class='status'>Switching to WiFi setup mode...</div>\n"
+  "</div>\n"
+  "</div>\n"
+  "<script>setTimeout(function(){window.close()},6000);</script>\n"
+  "</body>\n"
+  "</html>\n";
+
+// config_testing.html: 930 -> 600 bytes (gzip)
+static const uint8_t WEB_CONFIG_TESTING_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x55, 0x53, 0xdb, 0x6e, 0xdb, 0x30,
+  0x0c, 0x7d, 0xcf, 0x57, 0x68, 0x28, 0x0a, 0xb7, 0x83, 0x95, 0xd8, 0x6d, 0x93, 0x76, 0xb2, 0x13,
+  0x0c, 0xbb, 0x14, 0xd8, 0xc3, 0xb0, 0x62, 0x6d, 0x07, 0xec, 0x51, 0xb6, 0x69, 0x5b, 0xab, 0x2d,
+  0x19, 0x12, 0x73, 0xf1, 0x82, 0xfc, 0xfb, 0x28, 0xc7, 0x29, 0xba, 0x07, 0x83, 0xd6, 0x11, 0x79,
+  0x48, 0x1e, 0x52, 0xe9, 0xbb, 0x2f, 0x3f, 0x3e, 0x3f, 0xfd, 0x7e, 0xf8, 0xca, 0x6a, 0x6c, 0x9b,
+  0xd5, 0x24, 0x3d, 0x19, 0x90, 0x05, 0x99, 0x16, 0x50, 0xb2, 0xbc, 0x96, 0xd6, 0x01, 0x2e, 0x83,
+  0xe7, 0xa7, 0x7b, 0x7e, 0x17, 0x9c, 0x60, 0x2d, 0x5b, 0x58, 0x06, 0x1b, 0x05, 0xdb, 0xce, 0x58,
+  0x0c, 0x58, 0x6e, 0x34, 0x82, 0x26, 0xb7, 0xad, 0x2a, 0xb0, 0x5e, 0x16, 0xb0, 0x51, 0x39, 0xf0,
+  0xe1, 0x10, 0x2a, 0xad, 0x50, 0xc9, 0x86, 0xbb, 0x5c, 0x36, 0xb0, 0x8c, 0x3d, 0x07, 0x2a, 0x6c,
+  0x60, 0xf5, 0x4b, 0x36, 0xaa, 0x90, 0xa8, 0x74, 0x95, 0xce, 0x8e, 0xc8, 0x24, 0x75, 0xd8, 0x7b,
+  0xfb, 0x7e, 0x9f, 0x99, 0x1d, 0x77, 0xea, 0x2f, 0x5d, 0x8a, 0xcc, 0xd8, 0x02, 0x2c, 0x27, 0x24,
+  0x69, 0xa5, 0xad, 0x94, 0x16, 0x51, 0xd2, 0xc9, 0xa2, 0xf0, 0x77, 0xd1, 0x61, 0x92, 0x99, 0xa2,
+  0xdf, 0x97, 0x54, 0x00, 0x2f, 0x65, 0xab, 0x9a, 0x5e, 0x70, 0xd9, 0x75, 0x0d, 0x70, 0xd7, 0x3b,
+  0x84, 0x36, 0xfc, 0xd4, 0x28, 0xfd, 0xf2, 0x5d, 0xe6, 0x8f, 0xc3, 0xf1, 0x9e, 0xfc, 0xc2, 0xe0,
+  0x11, 0x2a, 0x03, 0xec, 0xf9, 0x5b, 0x10, 0xfe, 0x34, 0x99, 0x41, 0x13, 0x3a, 0xa9, 0x1d, 0x77,
+  0x60, 0x55, 0x99, 0x64, 0x32, 0x7f, 0xa9, 0xac, 0x59, 0xeb, 0x42, 0x50, 0x24, 0x48, 0xcb, 0x2b,
+  0x2b, 0x0b, 0x45, 0xdd, 0x5d, 0xc4, 0xd7, 0xf3, 0x02, 0xaa, 0xf0, 0x6c, 0xb1, 0xb8, 0x05, 0x90,
+  0x2c, 0x3a, 0x0f, 0xcf, 0x6e, 0x17, 0x37, 0x99, 0xbc, 0x62, 0x71, 0x14, 0x9d, 0x5f, 0x26, 0xad,
+  0xd2, 0xbc, 0x06, 0x55, 0xd5, 0x28, 0x08, 0xd8, 0xd4, 0x49, 0xa1, 0x5c, 0xd7, 0xc8, 0x5e, 0x94,
+  0x0d, 0xec, 0x12, 0xea, 0xb6, 0xd2, 0x5c, 0x51, 0x11, 0x4e, 0xe4, 0x44, 0x07, 0x36, 0xf9, 0xb3,
+  0x76, 0xa8, 0xca, 0x9e, 0x8f, 0xf2, 0x8d, 0xf0, 0x61, 0x32, 0xf5, 0x80, 0xa4, 0xec, 0x76, 0x8f,
+  0xb0, 0x43, 0x3e, 0x84, 0x9e, 0x82, 0x72, 0xd3, 0x18, 0x2b, 0xb6, 0x35, 0x31, 0x91, 0xa7, 0xeb,
+  0x94, 0xf6, 0x7e, 0x83, 0xd6, 0x62, 0x11, 0x75, 0xbb, 0x64, 0x2c, 0x61, 0xf8, 0x3f, 0x6a, 0x27,
+  0x6e, 0xba, 0x1d, 0x73, 0x86, 0xe4, 0x66, 0xb6, 0xca, 0xe4, 0xc5, 0xd5, 0x7c, 0x1e, 0x9e, 0xbe,
+  0x68, 0x7a, 0x7d, 0x39, 0xba, 0x71, 0x34, 0x1d, 0x7f, 0x43, 0x7f, 0x82, 0x7d, 0xff, 0x6b, 0x27,
+  0xe6, 0xd1, 0x79, 0x22, 0xb5, 0x6a, 0x69, 0x64, 0x46, 0x0b, 0x9f, 0x98, 0xc5, 0x8e, 0x1d, 0x45,
+  0x62, 0x4a, 0x97, 0x7e, 0xd0, 0xf0, 0x3a, 0x22, 0x26, 0xd7, 0x68, 0xd8, 0x15, 0x65, 0x3e, 0x4c,
+  0x3e, 0xbe, 0x40, 0x5f, 0x5a, 0xda, 0x19, 0xc7, 0x7c, 0xd8, 0x1e, 0xcd, 0x1e, 0x2d, 0x49, 0x5e,
+  0x1a, 0xdb, 0x0a, 0x6b, 0x50, 0x22, 0x5c, 0x5c, 0x2f, 0x22, 0x12, 0xf7, 0xf2, 0x70, 0x98, 0xd4,
+  0xf1, 0x71, 0x9c, 0x34, 0x7e, 0x10, 0x9e, 0x20, 0x19, 0x8e, 0xdb, 0x53, 0x5b, 0xd1, 0x98, 0x83,
+  0x36, 0x02, 0xd1, 0xb4, 0xe2, 0xce, 0xa7, 0xe8, 0xde, 0xc4, 0xc4, 0x3e, 0xc6, 0x74, 0x32, 0x57,
+  0xd8, 0x8b, 0x68, 0xfa, 0xe1, 0x30, 0x49, 0x67, 0xe3, 0x62, 0xa5, 0xb3, 0x71, 0xbb, 0xfd, 0xd6,
+  0x90, 0x29, 0xd4, 0x86, 0xe5, 0x8d, 0x74, 0x6e, 0x19, 0xbc, 0x6a, 0x1e, 0xfc, 0x8f, 0x8f, 0x0a,
+  0x07, 0xab, 0x74, 0x46, 0xa8, 0x7f, 0x1f, 0xf1, 0x9b, 0xd5, 0x65, 0x9f, 0x0d, 0x75, 0x5e, 0xad,
+  0xed, 0xa0, 0x0a, 0xd1, 0xc7, 0xe4, 0xd1, 0xad, 0x1e, 0x1a, 0x90, 0x0e, 0xd8, 0x56, 0x2a, 0x64,
+  0xa4, 0x65, 0x43, 0xbf, 0xc0, 0x10, 0x1c, 0x32, 0xac, 0xc1, 0x3f, 0x17, 0x0d, 0xb9, 0x0f, 0x98,
+  0x4e, 0xa7, 0xe9, 0xac, 0xf3, 0x75, 0x1d, 0xb9, 0x67, 0x63, 0x5d, 0xb3, 0xe1, 0x2d, 0xfe, 0x03,
+  0xed, 0x9c, 0xe5, 0xdf, 0xa2, 0x03, 0x00, 0x00,
+};
+static const size_t WEB_CONFIG_TESTING_GZ_LEN = 600;
+
+// ota_root.html: template, 1265 bytes, keys: PROJECT, VERSION
+static const char WEB_OTA_ROOT_TPL[] PROGMEM =
+  "<!DOCTYPE html>\n"
+  "<html>\n"
+  "<head>\n"
+  "<meta charset='UTF-8'>\n"
+  "<meta name='viewport' content='width=device-width,initial-scale=1'>\n"
+  "<title>Firmware Update</title>\n"
+  "<style>\n"
+  "*{margin:0;padding:0;box-sizing:border-box}\n"
+  "body{font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',sans-serif;background:linear-gradient(135deg,#667eea 0%,#764ba2 100%);min-height:100vh;display:flex;align-items:center;justify-content:center}\n"
+  ".container{background:white;padding:40px;border-radius:10px;box-shadow:0 10px 40px rgba(0,0,0,0.2);max-width:500px;text-align:center}\n"
+  "h1{color:#333;margin-bottom:10px;font-size:28px}\n"
+  "p{color:#666;margin-bottom:30px;line-height:1.6}\n"
+  ".btn{display:inline-block;padding:15px 40px;background:#667eea;color:white;text-decoration:none;border-radius:5px;font-weight:600;transition:all 0.3s}\n"
+  ".btn:hover{background:#5568d3;transform:translateY(-2px)}\n"
+  ".info{background:#f8f9fa;padding:15px;border-radius:5px;margin-bottom:20px;font-size:14px;color:#555}\n"
+  "</style>\n"
+  "</head>\n"
+  "<body>\n"
+  "<div class='container'>\n"
+  "<h1>Firmware Update</h1>\n"
+  "<p>{{PROJECT}} v{{VERSION}}</p>\n"
+  "<div class='info'>Click the button below to access the firmware update page.\n"
+  "You can upload a new .bin file to update your device.</div>\n"
+  "<a href='/update' class='btn'>Update Firmware</a>\n"
+  "</div>\n"
+  "</body>\n"
+  "</html>\n";
+
+// ota_update.html: 9189 -> 3838 bytes (gzip)
+static const uint8_t WEB_OTA_UPDATE_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x5a, 0xeb, 0x72, 0xdb, 0x46,
+  0x96, 0xfe, 0xcf, 0xa7, 0xe8, 0x54, 0xd6, 0x01, 0x18, 0x93, 0x10, 0x2e, 0x04, 0x78, 0x93, 0x94,
+  0x8a, 0x1d, 0x79, 0xed, 0x4a, 0x32, 0x93, 0x8a, 0xe4, 0x99, 0x9a, 0xf5, 0x68, 0xb7, 0x1a, 0x40,
+  0x83, 0x44, 0x4c, 0x02, 0x2c, 0x00, 0x14, 0xa5, 0x28, 0xde, 0xaa, 0x7d, 0x86, 0x7d, 0x80, 0x7d,
+  0xc5, 0x7d, 0x84, 0xfd, 0xce, 0x69, 0x00, 0x04, 0x29, 0x5a, 0x4e, 0xad, 0xfd, 0x83, 0x8d, 0xc6,
+  0xb9, 0xdf, 0xfa, 0x9c, 0x86, 0xce, 0xbf, 0xfa, 0xe1, 0xaf, 0xaf, 0x6f, 0xfe, 0xf1, 0xcb, 0x95,
+  0x58, 0x56, 0xeb, 0xd5, 0x65, 0xef, 0xbc, 0xf9, 0x51, 0x32, 0xc6, 0xcf, 0x5a, 0x55, 0x52, 0x44,
+  0x4b, 0x59, 0x94, 0xaa, 0xba, 0x30, 0xde, 0xdf, 0xbc, 0x19, 0x4e, 0x8c, 0x66, 0x3b, 0x93, 0x6b,
+  0x75, 0x61, 0xdc, 0xa5, 0x6a, 0xb7, 0xc9, 0x8b, 0xca, 0x10, 0x51, 0x9e, 0x55, 0x2a, 0x03, 0xd8,
+  0x2e, 0x8d, 0xab, 0xe5, 0x45, 0xac, 0xee, 0xd2, 0x48, 0x0d, 0xf9, 0x61, 0x90, 0x66, 0x69, 0x95,
+  0xca, 0xd5, 0xb0, 0x8c, 0xe4, 0x4a, 0x5d, 0x38, 0x44, 0xa3, 0x4a, 0xab, 0x95, 0xba, 0x7c, 0xbf,
+  0x59, 0xe5, 0x32, 0x16, 0x6f, 0xd2, 0x62, 0xbd, 0x93, 0x85, 0x3a, 0x3f, 0xd3, 0xdb, 0xbd, 0xf3,
+  0xb2, 0x7a, 0xa0, 0xdf, 0x6f, 0x1f, 0xd7, 0xb2, 0x58, 0xa4, 0xd9, 0xcc, 0x9e, 0x6f, 0x64, 0x1c,
+  0xa7, 0xd9, 0x02, 0xab, 0x30, 0xbf, 0x1f, 0x96, 0xe9, 0xef, 0xf4, 0x10, 0xe6, 0x45, 0xac, 0x8a,
+  0x21, 0x76, 0x3e, 0xf5, 0xc2, 0x3c, 0x7e, 0x78, 0x4c, 0x20, 0xc5, 0x30, 0x91, 0xeb, 0x74, 0xf5,
+  0x30, 0x1b, 0xca, 0xcd, 0x66, 0xa5, 0x86, 0xe5, 0x43, 0x59, 0xa9, 0xf5, 0xe0, 0xd5, 0x2a, 0xcd,
+  0x3e, 0xfe, 0x2c, 0xa3, 0x6b, 0x7e, 0x7c, 0x03, 0xb8, 0x81, 0x71, 0xad, 0x16, 0xb9, 0x12, 0xef,
+  0xdf, 0x19, 0x83, 0x52, 0x66, 0xe5, 0xb0, 0x54, 0x45, 0x9a, 0xcc, 0x43, 0x19, 0x7d, 0x5c, 0x14,
+  0xf9, 0x36, 0x8b, 0x67, 0x40, 0x51, 0xb2, 0x18, 0x2e, 0x0a, 0x19, 0xa7, 0xd0, 0xcd, 0x74, 0x3c,
+  0x3f, 0x56, 0x8b, 0xc1, 0xd7, 0x41, 0x30, 0x56, 0x4a, 0x0a, 0xfb, 0xc5, 0xe0, 0xeb, 0x71, 0x30,
+  0x0a, 0xa5, 0x2b, 0x1c, 0xdb, 0x7e, 0xd1, 0x9f, 0xaf, 0xd3, 0x6c, 0xb8, 0x54, 0xe9, 0x62, 0x59,
+  0xcd, 0xb0, 0x71, 0xb7, 0x9c, 0xc7, 0x69, 0xb9, 0x59, 0xc9, 0x87, 0x59, 0xb2, 0x52, 0xf7, 0x73,
+  0xb9, 0x4a, 0x17, 0xd9, 0x30, 0x05, 0xf7, 0x72, 0x16, 0x81, 0x9c, 0x2a, 0xe6, 0xbf, 0x6d, 0xcb,
+  0x2a, 0x4d, 0x1e, 0x86, 0xb5, 0xf1, 0x9a, 0xed, 0x46, 0x57, 0xd7, 0xde, 0x40, 0x31, 0x8b, 0xde,
+  0x4a, 0x88, 0x52, 0x3c, 0x76, 0x64, 0xdb, 0x2d, 0x41, 0xa9, 0x85, 0x1c, 0x01, 0x72, 0x5e, 0x5b,
+  0x83, 0xa4, 0xdd, 0x96, 0x90, 0x80, 0xb7, 0x60, 0xab, 0xa5, 0x8c, 0xf3, 0xdd, 0xcc, 0x16, 0xb4,
+  0x23, 0x08, 0x52, 0x14, 0x8b, 0x50, 0x9a, 0xf6, 0x80, 0xff, 0x5b, 0x2e, 0x04, 0x97, 0xf7, 0xda,
+  0x55, 0xb3, 0xc0, 0x26, 0x34, 0xbd, 0x26, 0xa5, 0x3e, 0xf5, 0x96, 0xce, 0x63, 0x94, 0xaf, 0xf2,
+  0x62, 0xf6, 0xb5, 0xe7, 0x79, 0x73, 0xed, 0x0f, 0x58, 0xbc, 0xaa, 0xf2, 0xb5, 0xe6, 0xc1, 0x36,
+  0x87, 0x43, 0xd4, 0xcc, 0x9d, 0xe0, 0xb1, 0x52, 0xf7, 0xd5, 0x90, 0x75, 0xad, 0xd5, 0xf9, 0xd4,
+  0xdb, 0x34, 0x14, 0x82, 0x20, 0x38, 0xa2, 0xe0, 0x11, 0x05, 0xb2, 0x73, 0x6b, 0x38, 0x2b, 0x38,
+  0x45, 0xc2, 0xda, 0x72, 0xa8, 0x0c, 0x11, 0x25, 0xf2, 0x51, 0x2b, 0x3a, 0x73, 0xa1, 0x49, 0x2c,
+  0xcb, 0xa5, 0x8a, 0x45, 0xed, 0x92, 0x23, 0x13, 0x90, 0x38, 0x07, 0x16, 0x7a, 0x42, 0x78, 0x1e,
+  0x6d, 0x8b, 0x12, 0x92, 0x6d, 0xf2, 0x94, 0x1f, 0xab, 0x02, 0x81, 0x80, 0x60, 0xcd, 0xb3, 0x99,
+  0x5c, 0xad, 0x84, 0x6d, 0x79, 0xe5, 0x91, 0xc0, 0xb5, 0x4f, 0x3a, 0xe2, 0xcc, 0x96, 0xf9, 0x1d,
+  0xf9, 0x46, 0xb3, 0xae, 0x35, 0xf5, 0xfd, 0x60, 0x12, 0x7b, 0xdd, 0x60, 0xfa, 0x3a, 0x99, 0x24,
+  0xd3, 0x24, 0x39, 0xc4, 0xb5, 0xe2, 0x42, 0x2e, 0xfe, 0x1c, 0xba, 0x9a, 0x28, 0x49, 0xe8, 0x69,
+  0xb6, 0xd9, 0x56, 0x1f, 0xaa, 0x87, 0x8d, 0xba, 0x48, 0xd2, 0x95, 0xba, 0x7d, 0x6c, 0x82, 0x2c,
+  0xcb, 0x33, 0x05, 0xea, 0xb4, 0x39, 0x4c, 0x11, 0x33, 0x8f, 0x7b, 0xc7, 0x8c, 0xc8, 0x12, 0xad,
+  0x0f, 0xd8, 0x52, 0x47, 0x8e, 0xf4, 0x59, 0x2b, 0xc6, 0xa5, 0xcc, 0xee, 0xba, 0x9c, 0xc9, 0xec,
+  0xb4, 0x77, 0x10, 0x1e, 0x35, 0x26, 0xfb, 0x5e, 0xd8, 0x0d, 0x12, 0xb1, 0x69, 0x90, 0xa6, 0xd3,
+  0x69, 0x27, 0x28, 0x9c, 0x11, 0x93, 0x0e, 0xab, 0xac, 0x95, 0x34, 0x5c, 0xe5, 0xd1, 0xc7, 0x4e,
+  0x90, 0xb5, 0x4e, 0x22, 0x31, 0x0e, 0x94, 0xae, 0x85, 0xd5, 0x84, 0x75, 0xc8, 0xd7, 0xce, 0x27,
+  0x6d, 0x8f, 0xdc, 0xed, 0x37, 0xc1, 0xd8, 0x11, 0xb6, 0x23, 0x47, 0x40, 0x36, 0xf8, 0xd3, 0xee,
+  0xae, 0xf2, 0x4d, 0xe3, 0x6b, 0x88, 0xae, 0x7d, 0x0c, 0xa6, 0x95, 0x39, 0x83, 0x16, 0x32, 0x5c,
+  0xa9, 0xb8, 0xdf, 0x4d, 0xc7, 0xc6, 0x63, 0x4c, 0x31, 0xc9, 0x8b, 0xf5, 0x8c, 0x57, 0x2b, 0x59,
+  0xa9, 0x7f, 0x98, 0x43, 0x44, 0x6a, 0xbf, 0x26, 0xd4, 0x60, 0x1f, 0x20, 0x47, 0x51, 0xd4, 0x88,
+  0x06, 0x16, 0x88, 0xd0, 0x55, 0xbe, 0x53, 0x31, 0x30, 0x36, 0x45, 0xbe, 0x28, 0x54, 0x59, 0x1e,
+  0x38, 0xf9, 0x84, 0x88, 0x0d, 0xdc, 0x30, 0x94, 0xc5, 0x63, 0x9d, 0x49, 0x9c, 0x5a, 0x07, 0x01,
+  0x68, 0xd3, 0xff, 0xe3, 0x32, 0x41, 0x56, 0x23, 0xe5, 0x12, 0xf0, 0x9c, 0x2d, 0xd3, 0x38, 0x56,
+  0x59, 0x97, 0x20, 0xbc, 0xbb, 0x7a, 0xdc, 0x17, 0xb5, 0x17, 0xcf, 0xd5, 0xc7, 0xa9, 0xdd, 0x29,
+  0x8f, 0x4d, 0x6d, 0xec, 0x77, 0xad, 0xcc, 0x3e, 0xd7, 0x76, 0xfe, 0x7f, 0xd6, 0xc6, 0x6e, 0x28,
+  0x1c, 0x39, 0x1b, 0x62, 0x97, 0x95, 0xac, 0xb6, 0xe5, 0xe3, 0xd3, 0x3c, 0xef, 0x98, 0x8c, 0x35,
+  0xee, 0x14, 0xa4, 0x27, 0xa1, 0x5a, 0x6e, 0xa3, 0x88, 0x6c, 0x5e, 0xc3, 0xb8, 0x13, 0x39, 0x1e,
+  0xf9, 0x27, 0x98, 0xa9, 0xa2, 0xc8, 0x8b, 0x06, 0x2a, 0x8e, 0x3c, 0xff, 0x14, 0xd4, 0xf9, 0x59,
+  0x7d, 0x96, 0x9d, 0x9f, 0xd5, 0xa7, 0x2a, 0x1d, 0x54, 0xf8, 0x89, 0xd3, 0x3b, 0x11, 0xad, 0x64,
+  0x59, 0x5e, 0x18, 0x6d, 0x81, 0xa7, 0x93, 0x71, 0xe9, 0x3c, 0x3d, 0x16, 0xb1, 0xd7, 0x3b, 0xdf,
+  0x5c, 0x5e, 0xab, 0x95, 0x8a, 0x2a, 0x21, 0x85, 0x15, 0xa6, 0x99, 0x30, 0xf3, 0x02, 0xa7, 0xee,
+  0x7a, 0x43, 0x6e, 0x42, 0x09, 0xa4, 0x3d, 0x6b, 0xf1, 0x7b, 0x5f, 0x50, 0x3e, 0x8a, 0x2a, 0x17,
+  0xdb, 0x4d, 0x8c, 0xe8, 0x13, 0x0f, 0xf9, 0xb6, 0x10, 0xfa, 0x38, 0x3e, 0x3f, 0xdb, 0x80, 0x0e,
+  0x45, 0xa7, 0x48, 0xe3, 0x0b, 0x43, 0xd7, 0xa1, 0x37, 0x78, 0x34, 0x04, 0xce, 0xf4, 0x65, 0x8e,
+  0xbd, 0x5f, 0xfe, 0x7a, 0x7d, 0x63, 0x08, 0x95, 0x45, 0x5c, 0x60, 0x8c, 0xf5, 0x76, 0x55, 0xa5,
+  0x1b, 0x59, 0x54, 0x67, 0x84, 0x35, 0x04, 0x41, 0x69, 0x1c, 0xca, 0xde, 0x29, 0x66, 0x46, 0x87,
+  0xea, 0xf7, 0xf4, 0x7c, 0x08, 0xd9, 0x16, 0x26, 0xe3, 0xf2, 0x7f, 0xff, 0xe7, 0xbf, 0xff, 0xeb,
+  0xfc, 0x0c, 0xef, 0x6a, 0x08, 0xc2, 0xa3, 0xd7, 0x7f, 0x41, 0xe9, 0x31, 0x2e, 0x5f, 0xaf, 0xd2,
+  0xe8, 0xa3, 0x80, 0x76, 0x54, 0x1c, 0xb5, 0x3a, 0x4b, 0x45, 0x66, 0x78, 0x8a, 0x70, 0x0d, 0xb7,
+  0x19, 0x07, 0x0c, 0xc8, 0x91, 0xc6, 0x65, 0x03, 0xcb, 0xc5, 0x52, 0x68, 0x5d, 0xe8, 0xb5, 0xd1,
+  0x62, 0xbe, 0xa3, 0x37, 0x46, 0xdd, 0xc6, 0x24, 0xb5, 0xa5, 0x0d, 0x21, 0xe1, 0xfa, 0x0d, 0xba,
+  0x18, 0xb2, 0xe6, 0x00, 0xe6, 0x24, 0x1d, 0x6a, 0x5a, 0xe1, 0x16, 0xa5, 0x32, 0xab, 0x89, 0x95,
+  0xdb, 0x70, 0x9d, 0x56, 0x2d, 0x6b, 0x64, 0x76, 0x57, 0xfb, 0x57, 0xf4, 0xd8, 0x64, 0xfa, 0x53,
+  0x77, 0x6a, 0x4a, 0x44, 0x99, 0xac, 0x7a, 0x68, 0xa5, 0x26, 0xf1, 0x34, 0xb9, 0xf6, 0xe9, 0x34,
+  0x10, 0xa5, 0x3b, 0x94, 0x3d, 0xf5, 0x86, 0xf2, 0xf6, 0x90, 0xc6, 0x1b, 0xda, 0xb9, 0xb4, 0x5f,
+  0x68, 0x7d, 0xba, 0xd6, 0xac, 0x71, 0x75, 0xf2, 0x68, 0xa4, 0x7a, 0xdd, 0x82, 0x1d, 0xfe, 0x94,
+  0x51, 0x91, 0x6e, 0xaa, 0xcb, 0xde, 0xd9, 0x99, 0xf8, 0x19, 0xcd, 0xdd, 0x5a, 0xae, 0xc4, 0xf5,
+  0xdb, 0xef, 0x87, 0xae, 0x1f, 0x08, 0x68, 0x24, 0x36, 0x72, 0xa1, 0x4a, 0x81, 0x76, 0xea, 0x0e,
+  0x71, 0x49, 0xb5, 0x45, 0x20, 0xd3, 0x11, 0xb1, 0x6f, 0x6f, 0x6e, 0x7e, 0x11, 0x66, 0x54, 0x3c,
+  0x6c, 0xaa, 0x1c, 0x59, 0x16, 0xa2, 0xd7, 0x13, 0x99, 0x52, 0x71, 0xc9, 0x6f, 0xae, 0xfb, 0x3d,
+  0x04, 0x47, 0x59, 0x11, 0x29, 0x50, 0xfa, 0x8f, 0x1f, 0xc5, 0x05, 0xde, 0xee, 0xc4, 0x7b, 0xd4,
+  0x6a, 0xcf, 0xfd, 0xbe, 0x28, 0xe4, 0x83, 0xf9, 0xa1, 0x67, 0xdf, 0x8f, 0x90, 0x90, 0x6e, 0x32,
+  0x9d, 0x0c, 0x84, 0x7d, 0x3f, 0x76, 0xbc, 0xf1, 0x68, 0x34, 0x75, 0x68, 0x1d, 0xfa, 0x91, 0x9d,
+  0x84, 0x51, 0x42, 0x6b, 0x35, 0x0d, 0xfd, 0x38, 0x94, 0x3e, 0xad, 0xbd, 0xa9, 0x1f, 0x44, 0xae,
+  0x1f, 0xd2, 0xda, 0x9f, 0x26, 0x8e, 0xe3, 0x24, 0x0c, 0x3f, 0x75, 0xbd, 0x64, 0xe2, 0xca, 0x11,
+  0xad, 0x65, 0xe8, 0x44, 0xbe, 0x8a, 0xfd, 0x01, 0xe8, 0xc7, 0x13, 0x7b, 0x2c, 0xa5, 0xa6, 0xef,
+  0xb8, 0x13, 0xcf, 0x0f, 0x6d, 0x86, 0x77, 0x47, 0x9e, 0x33, 0xf1, 0x43, 0xc5, 0x74, 0x7c, 0x3b,
+  0x1a, 0x23, 0xe5, 0x59, 0x06, 0x37, 0x54, 0x7e, 0x3c, 0x66, 0x3a, 0x13, 0x54, 0xc0, 0xd0, 0x49,
+  0x18, 0x66, 0x1a, 0xc6, 0x91, 0x1d, 0xc8, 0x31, 0xad, 0x23, 0x67, 0x1a, 0x26, 0x0e, 0x60, 0x40,
+  0x5f, 0x8d, 0xa6, 0x61, 0x30, 0x8d, 0x98, 0xa6, 0x4a, 0x42, 0x35, 0x1a, 0x4f, 0x02, 0x5a, 0xdb,
+  0x09, 0xa0, 0xe2, 0x28, 0xd0, 0xbc, 0xec, 0x48, 0x3a, 0x51, 0xc4, 0xeb, 0x58, 0x4d, 0xdd, 0x28,
+  0x60, 0xbd, 0x46, 0x28, 0x45, 0x93, 0x91, 0x94, 0x2c, 0x43, 0x14, 0xda, 0x12, 0x08, 0x2c, 0x43,
+  0x00, 0x83, 0x4c, 0x62, 0x49, 0xf4, 0xa7, 0x13, 0x4f, 0xf9, 0x8e, 0xef, 0xb2, 0x5e, 0x13, 0xcf,
+  0x89, 0x82, 0x20, 0x66, 0xfb, 0xd8, 0xb6, 0xe7, 0x8e, 0x23, 0xd6, 0x2b, 0x4c, 0xfc, 0xe9, 0x38,
+  0x89, 0xb4, 0x6c, 0x81, 0xb2, 0xed, 0x30, 0x61, 0x5d, 0x62, 0x5f, 0x8e, 0xa7, 0xce, 0x88, 0xf7,
+  0xed, 0x20, 0x92, 0x81, 0xe7, 0xb3, 0x9c, 0xce, 0xc8, 0x9d, 0xba, 0xd3, 0x60, 0x4c, 0xf4, 0xdd,
+  0x71, 0x38, 0xb6, 0xe5, 0x84, 0x6d, 0xeb, 0x2a, 0x27, 0x74, 0x1d, 0x8f, 0x69, 0x8e, 0x62, 0x48,
+  0x19, 0x27, 0x2c, 0x8f, 0xef, 0x79, 0x30, 0x85, 0xc3, 0x34, 0x03, 0xdf, 0x96, 0x63, 0x14, 0x47,
+  0x2d, 0x67, 0x20, 0x6d, 0x19, 0xb2, 0x2f, 0x26, 0x4e, 0xe4, 0x46, 0x53, 0x57, 0xdb, 0xca, 0x1d,
+  0xbb, 0x6e, 0x34, 0x61, 0xfb, 0x4b, 0x37, 0x4c, 0xd4, 0x44, 0x3a, 0x5a, 0x7e, 0x47, 0x06, 0x38,
+  0x46, 0x58, 0x4e, 0x77, 0x14, 0x4e, 0xc0, 0x9a, 0xd7, 0xe3, 0x20, 0xf2, 0x1d, 0xa9, 0x65, 0x76,
+  0x40, 0x64, 0xe2, 0x4c, 0x79, 0x1d, 0x4c, 0xa7, 0x76, 0xe0, 0x32, 0xaf, 0x64, 0x64, 0x2b, 0xcf,
+  0xd7, 0x72, 0x3a, 0x70, 0x84, 0xb4, 0x81, 0x0b, 0xfa, 0xce, 0x54, 0x8e, 0x22, 0xc7, 0x61, 0x3b,
+  0x3b, 0xca, 0x03, 0x25, 0x9b, 0xe5, 0x77, 0x61, 0xda, 0xf1, 0x78, 0xc4, 0xf2, 0x7b, 0xa3, 0xd0,
+  0x0e, 0xa3, 0xb0, 0x8e, 0x1f, 0x27, 0xb2, 0xa3, 0x90, 0x79, 0x8d, 0x54, 0x3c, 0x91, 0x72, 0xa4,
+  0xed, 0x1f, 0x4e, 0xa3, 0x48, 0x8e, 0xd8, 0x2f, 0xc1, 0xc4, 0x55, 0x41, 0x02, 0x1b, 0x82, 0x3e,
+  0xc8, 0x20, 0xae, 0x14, 0xeb, 0x35, 0x9e, 0x48, 0x3f, 0xf0, 0xb4, 0xef, 0x26, 0xa3, 0x68, 0x32,
+  0x9e, 0x38, 0x3a, 0x4e, 0xa2, 0x68, 0x6c, 0xbb, 0x9a, 0xef, 0xd4, 0x0e, 0x55, 0x92, 0x24, 0x4c,
+  0x53, 0x8e, 0x7c, 0x98, 0x5d, 0xb1, 0xbe, 0xd8, 0x9d, 0x4a, 0x2f, 0xa9, 0x7d, 0x34, 0x76, 0xc6,
+  0x93, 0xc4, 0xed, 0xdd, 0xf6, 0xe7, 0xbd, 0x64, 0x8b, 0xf2, 0x8c, 0xd3, 0x54, 0xa0, 0xb3, 0x47,
+  0xa2, 0xbc, 0x55, 0xf7, 0x66, 0xb8, 0x4d, 0x12, 0x55, 0xf4, 0xc5, 0x63, 0x9d, 0x42, 0x38, 0x98,
+  0x90, 0x3d, 0xe6, 0xfd, 0x40, 0x64, 0x7d, 0x71, 0x71, 0x89, 0x95, 0xb8, 0xbc, 0xbc, 0xa4, 0x87,
+  0x3f, 0x68, 0x7d, 0x7e, 0x2e, 0x4c, 0xcf, 0x15, 0x43, 0x6c, 0x80, 0x9e, 0x46, 0x29, 0x8b, 0xa8,
+  0x93, 0x70, 0x13, 0x9d, 0x6f, 0x35, 0xdd, 0x06, 0x86, 0xfa, 0x34, 0xa4, 0xf4, 0x13, 0x30, 0xd3,
+  0x04, 0xb6, 0xb5, 0x52, 0xd9, 0x02, 0xa7, 0xfb, 0x4b, 0x31, 0x76, 0xfb, 0x60, 0x27, 0x82, 0x3e,
+  0x31, 0x0a, 0x80, 0xad, 0xf1, 0x2c, 0x8c, 0x91, 0x04, 0xd8, 0x6e, 0x7c, 0xd8, 0x63, 0xdd, 0x82,
+  0x28, 0xa5, 0x4f, 0xc3, 0x89, 0x06, 0xcb, 0x9a, 0xcf, 0x0f, 0x38, 0x74, 0xfe, 0x86, 0x47, 0xb3,
+  0xa6, 0xd2, 0xca, 0x44, 0x30, 0x44, 0x53, 0x17, 0x88, 0xe6, 0x75, 0x2d, 0xc5, 0x50, 0xc0, 0xb8,
+  0x3f, 0xcb, 0x6a, 0x69, 0xa1, 0xb1, 0xc9, 0x8b, 0xae, 0x80, 0x67, 0xe4, 0x6c, 0x5b, 0xff, 0xeb,
+  0x7f, 0x99, 0x0e, 0x1c, 0xd6, 0xc5, 0x86, 0x4a, 0x5e, 0x9f, 0xad, 0x69, 0xb7, 0x76, 0x79, 0x7b,
+  0xaa, 0x54, 0x21, 0x2a, 0xa4, 0x3d, 0x55, 0xe8, 0x86, 0xd8, 0x9b, 0x61, 0x30, 0x96, 0x4a, 0x47,
+  0xa3, 0x87, 0x94, 0x4b, 0xbc, 0xb1, 0xce, 0x50, 0x7f, 0x94, 0x24, 0xbe, 0xc7, 0x99, 0xeb, 0x3b,
+  0xb6, 0xf2, 0xdd, 0x71, 0xa2, 0xab, 0x87, 0x8d, 0x8e, 0x72, 0xc2, 0xd1, 0xe8, 0x24, 0x13, 0x2f,
+  0x9e, 0x4a, 0x5d, 0xc1, 0x42, 0x65, 0x47, 0x08, 0xf9, 0xdb, 0x96, 0xf9, 0xdf, 0x4f, 0x30, 0x0f,
+  0x46, 0x14, 0x27, 0x08, 0x02, 0x73, 0xa5, 0x2a, 0x91, 0x27, 0x09, 0x99, 0x77, 0xce, 0x8b, 0x73,
+  0x71, 0xa0, 0xa0, 0xde, 0x7c, 0x79, 0x21, 0x80, 0x82, 0xf0, 0x69, 0x71, 0x52, 0x8d, 0x91, 0x02,
+  0xde, 0x09, 0xf0, 0xfb, 0xf2, 0x65, 0x5f, 0xfc, 0xfd, 0x43, 0x4a, 0x7e, 0x62, 0x7b, 0x2d, 0x5a,
+  0x7b, 0x31, 0x3e, 0x00, 0xbf, 0x15, 0x07, 0x4c, 0x89, 0x00, 0x63, 0x82, 0x42, 0x30, 0xaa, 0x29,
+  0x34, 0xf1, 0x59, 0xda, 0x78, 0x8b, 0x20, 0x35, 0x41, 0x12, 0x26, 0x76, 0xfc, 0xdb, 0x81, 0x18,
+  0xf7, 0xc5, 0xbf, 0x1f, 0xef, 0x39, 0x13, 0xda, 0xdc, 0xef, 0xb0, 0xdd, 0xbd, 0x7d, 0xcc, 0x3a,
+  0x07, 0x64, 0x5c, 0xc2, 0x38, 0x22, 0xc3, 0x7b, 0xd3, 0x0e, 0x15, 0x57, 0x13, 0x71, 0xc8, 0x7b,
+  0xb5, 0x42, 0x35, 0xf9, 0xe0, 0x16, 0x7a, 0x40, 0xb2, 0x97, 0xf5, 0xc6, 0x98, 0x9f, 0x9d, 0x79,
+  0xef, 0x53, 0x8f, 0x14, 0x92, 0x80, 0x7c, 0xfb, 0xc1, 0x06, 0xbd, 0x90, 0x57, 0x0e, 0x56, 0x11,
+  0xaf, 0x88, 0x47, 0xcc, 0x2b, 0x0f, 0x2b, 0xc5, 0xab, 0x11, 0x56, 0x09, 0xaf, 0x48, 0x8f, 0x05,
+  0xaf, 0x02, 0xac, 0x96, 0xbc, 0x1a, 0xdf, 0xce, 0x4f, 0x9a, 0xfa, 0x89, 0xa1, 0x2a, 0xd2, 0xd0,
+  0xa4, 0xa4, 0x32, 0x49, 0x27, 0x14, 0x95, 0xa0, 0xd1, 0x0f, 0x6b, 0xc7, 0xe9, 0x3c, 0xb8, 0x7e,
+  0xbf, 0x4f, 0x70, 0xa6, 0x12, 0xdf, 0x88, 0x84, 0x35, 0xfe, 0x4f, 0x5a, 0x2e, 0x78, 0xbb, 0x39,
+  0x54, 0x49, 0x63, 0x56, 0xf0, 0x96, 0x6a, 0x41, 0x9b, 0x6f, 0x95, 0x4b, 0x7c, 0x98, 0x07, 0x0a,
+  0x91, 0xdb, 0x90, 0xc5, 0xda, 0xf1, 0x3a, 0x0f, 0xae, 0x5b, 0xf3, 0x90, 0x20, 0x1c, 0x32, 0x0f,
+  0x5a, 0x45, 0xbc, 0x0a, 0x79, 0xd5, 0xaf, 0xe9, 0x92, 0xa2, 0x8b, 0x39, 0x6b, 0x9e, 0xcc, 0xd9,
+  0x14, 0x6a, 0xce, 0xb6, 0x31, 0x63, 0x50, 0xa8, 0x9c, 0x1a, 0x8c, 0xec, 0x16, 0xcd, 0xd9, 0x90,
+  0xe1, 0x9c, 0x2d, 0x2b, 0xe7, 0x6c, 0x6a, 0x13, 0xaa, 0x03, 0xce, 0xad, 0xe1, 0x3e, 0xf5, 0xc8,
+  0xf6, 0x14, 0xa8, 0x78, 0x4f, 0xc6, 0xa7, 0x65, 0x38, 0x67, 0xeb, 0xd3, 0x32, 0x9a, 0xb3, 0xf9,
+  0x69, 0x19, 0xcf, 0x7b, 0x64, 0x7f, 0x5a, 0xaa, 0x39, 0x3b, 0x80, 0x96, 0xc9, 0x9c, 0x3d, 0x40,
+  0xcb, 0xc5, 0x9c, 0x5d, 0x40, 0xcb, 0x25, 0x51, 0x2e, 0x54, 0xb5, 0x2d, 0x32, 0xc1, 0xa9, 0x63,
+  0x25, 0x45, 0xbe, 0x36, 0xdf, 0x0e, 0xc4, 0x3d, 0xd5, 0xcd, 0x7b, 0xab, 0xca, 0xaf, 0xab, 0x02,
+  0xb3, 0xa9, 0xe9, 0x04, 0x7d, 0x0b, 0x99, 0x73, 0x5d, 0xa1, 0x1b, 0x36, 0x51, 0x5b, 0x0c, 0xdb,
+  0xe8, 0xf7, 0xad, 0xdf, 0x30, 0x49, 0x9a, 0x86, 0xd1, 0x27, 0x32, 0xb2, 0x7c, 0xc8, 0x22, 0xd1,
+  0x56, 0xe7, 0x38, 0x45, 0x17, 0x54, 0x1d, 0x56, 0xe7, 0x34, 0x11, 0xe6, 0x2e, 0xcd, 0xe2, 0x7c,
+  0x67, 0xe9, 0x36, 0x48, 0x7c, 0x03, 0x9b, 0x75, 0x1b, 0xa2, 0xbd, 0xeb, 0xc9, 0x32, 0x72, 0x27,
+  0xd3, 0xea, 0x10, 0xc0, 0xd2, 0x74, 0x4d, 0xa3, 0xee, 0xb8, 0x0c, 0xc4, 0x63, 0x53, 0x11, 0x9f,
+  0x2a, 0x72, 0x54, 0xa8, 0xe3, 0xfe, 0x17, 0x14, 0x73, 0x4f, 0x29, 0x56, 0x93, 0x7d, 0x72, 0xdc,
+  0xd0, 0x3b, 0xcc, 0x37, 0x75, 0x33, 0xd8, 0x76, 0x85, 0x5a, 0x7c, 0x9a, 0x08, 0xa0, 0x41, 0x9c,
+  0x47, 0xdb, 0x35, 0x66, 0x30, 0x2a, 0x18, 0x57, 0x2b, 0x45, 0xcb, 0x57, 0x0f, 0xef, 0x62, 0xb3,
+  0x3b, 0x27, 0xb4, 0xf9, 0xac, 0xdb, 0xf5, 0x67, 0x90, 0xf6, 0x9d, 0x7b, 0x8b, 0x83, 0xd6, 0xfb,
+  0xcb, 0x6c, 0xa8, 0x21, 0x6f, 0x31, 0x78, 0x00, 0xfa, 0x22, 0x0a, 0xcf, 0x45, 0x7b, 0x9c, 0x7a,
+  0x3a, 0xf9, 0x92, 0x70, 0x3c, 0xc1, 0x1c, 0x60, 0xd1, 0x88, 0xf2, 0x25, 0x2c, 0x1e, 0x63, 0xf6,
+  0xa7, 0x6c, 0xdd, 0xb0, 0x3f, 0x87, 0xd5, 0x0e, 0x06, 0x4f, 0xb0, 0xa8, 0xcd, 0xff, 0x33, 0x98,
+  0x3c, 0x0e, 0xec, 0x2b, 0x29, 0xf7, 0xfb, 0xcf, 0xe1, 0xd5, 0x13, 0x41, 0xb7, 0xff, 0xd8, 0x60,
+  0x4e, 0x33, 0x13, 0x3e, 0x36, 0x6a, 0xd5, 0x2d, 0x9a, 0xbc, 0x5f, 0xeb, 0x89, 0x9d, 0x12, 0xdf,
+  0xa2, 0xf9, 0x6a, 0xde, 0x6b, 0x74, 0x3c, 0x7a, 0x6d, 0x26, 0x16, 0x8d, 0x6b, 0x38, 0x90, 0x1d,
+  0xdb, 0x1d, 0xf5, 0x11, 0x92, 0x6f, 0xd2, 0x7b, 0x15, 0x9b, 0x0e, 0xd5, 0x18, 0xe3, 0xc7, 0x57,
+  0xc6, 0xbc, 0x07, 0xef, 0x5a, 0xcd, 0x20, 0x45, 0x04, 0xe5, 0xaa, 0x54, 0x9c, 0x6b, 0x74, 0x79,
+  0x96, 0x67, 0x11, 0x8f, 0x8a, 0xa0, 0xc4, 0x5d, 0x0e, 0x87, 0x8f, 0xc5, 0x7b, 0x26, 0xe4, 0xd4,
+  0x8f, 0x00, 0x5a, 0xca, 0x6c, 0x41, 0x3e, 0x50, 0x04, 0xd4, 0xa4, 0x17, 0x57, 0x24, 0x0b, 0x41,
+  0x0f, 0x45, 0xf9, 0x0e, 0xab, 0x44, 0x7d, 0x99, 0x73, 0x86, 0x42, 0xa5, 0x5a, 0x35, 0xb0, 0x9a,
+  0xf7, 0x3e, 0x18, 0xcd, 0x2d, 0x1d, 0x72, 0x8d, 0xd7, 0x7c, 0xa7, 0x60, 0xdc, 0x5a, 0x88, 0xa4,
+  0x2b, 0x19, 0x2d, 0x4d, 0x26, 0xcc, 0x22, 0xe1, 0x68, 0xbd, 0xba, 0xc3, 0xeb, 0x9f, 0xd2, 0x12,
+  0x4a, 0x2a, 0x2e, 0xcc, 0xea, 0x4e, 0xf3, 0x55, 0x77, 0x16, 0x86, 0x75, 0x7a, 0xfb, 0x83, 0x4a,
+  0x24, 0x26, 0x6b, 0x12, 0x92, 0xb1, 0x78, 0x00, 0x23, 0x14, 0xc2, 0x37, 0xf7, 0xec, 0x88, 0x3f,
+  0x75, 0x28, 0x5a, 0x82, 0x95, 0x92, 0x77, 0x4a, 0x8b, 0x90, 0x6f, 0xfe, 0x34, 0x77, 0x6d, 0x9a,
+  0x23, 0x36, 0x85, 0x5a, 0x83, 0x41, 0x97, 0x53, 0xbf, 0x91, 0xe5, 0x09, 0x0d, 0xcd, 0x6e, 0xd0,
+  0x58, 0x4f, 0x9d, 0x50, 0xa2, 0x6b, 0x51, 0xba, 0x23, 0xb8, 0xe1, 0x5b, 0x30, 0x55, 0x1c, 0xdb,
+  0x95, 0xaa, 0xdd, 0xd9, 0x3f, 0x69, 0xb6, 0x36, 0xff, 0x49, 0x77, 0x15, 0xdf, 0xfd, 0xcb, 0x19,
+  0x42, 0x02, 0xc5, 0x4c, 0x07, 0x4a, 0x9f, 0x4b, 0x24, 0x7b, 0x8d, 0x11, 0x3f, 0x43, 0x0f, 0xed,
+  0x63, 0xeb, 0x1d, 0xd8, 0xa7, 0x61, 0xff, 0xfa, 0xed, 0xfb, 0xbf, 0xfc, 0xc8, 0x4d, 0x87, 0x37,
+  0xc1, 0x31, 0xca, 0xff, 0x30, 0xa0, 0xbe, 0x7a, 0x00, 0x07, 0xb1, 0xc1, 0x10, 0x4a, 0x77, 0x1b,
+  0x35, 0xec, 0xaf, 0x57, 0x37, 0xbf, 0xbe, 0xbb, 0xba, 0x06, 0xb4, 0x5f, 0x43, 0x12, 0xe8, 0xf7,
+  0x55, 0xa5, 0xd6, 0x9b, 0x4a, 0x43, 0x47, 0xcb, 0x6d, 0xf6, 0x51, 0xa0, 0x09, 0xcf, 0x0b, 0x25,
+  0x16, 0xe9, 0x1d, 0x4a, 0xa5, 0xd8, 0x6e, 0xf6, 0xc1, 0x9f, 0xc8, 0x74, 0x65, 0xae, 0xcb, 0x05,
+  0xc9, 0xac, 0x73, 0xe3, 0x28, 0xba, 0xf1, 0x6e, 0xde, 0xbc, 0x61, 0xcb, 0xd7, 0xf5, 0xa3, 0xce,
+  0x24, 0xc1, 0xd7, 0x47, 0xcf, 0x84, 0x78, 0xcb, 0xa9, 0x90, 0x95, 0xba, 0x01, 0x69, 0x33, 0xcd,
+  0x92, 0x9c, 0xd8, 0x51, 0xd3, 0x40, 0xbc, 0x00, 0x4d, 0x5b, 0x16, 0x01, 0x1c, 0x25, 0x8f, 0xf8,
+  0xf1, 0xd5, 0x59, 0x69, 0x68, 0xb3, 0x33, 0x0c, 0x46, 0x0c, 0x05, 0x72, 0x77, 0x4a, 0x5c, 0xee,
+  0x91, 0xfa, 0x9a, 0x0c, 0xce, 0x41, 0x43, 0x98, 0x7b, 0x08, 0x83, 0xfa, 0xb9, 0x03, 0xa4, 0x53,
+  0xd4, 0xfb, 0x46, 0x7b, 0xe0, 0x10, 0x95, 0x03, 0x91, 0xcb, 0x65, 0xbe, 0xfb, 0xa5, 0x2e, 0x34,
+  0xd4, 0x20, 0xa2, 0xbb, 0x1e, 0x08, 0xca, 0xf5, 0x81, 0x68, 0x94, 0xa8, 0xab, 0x16, 0x74, 0xe8,
+  0x74, 0xe9, 0x1a, 0x14, 0x05, 0x81, 0xeb, 0xc2, 0xb7, 0xf4, 0x5d, 0x85, 0xa6, 0x85, 0x4e, 0xc9,
+  0xb2, 0xf8, 0x3a, 0xcd, 0xd2, 0x17, 0x89, 0x17, 0xc0, 0x87, 0x38, 0x2f, 0x8c, 0x23, 0x98, 0x43,
+  0x47, 0xb4, 0x30, 0x27, 0xdd, 0x64, 0xe8, 0xeb, 0x19, 0xb8, 0xd7, 0xb2, 0x2c, 0x56, 0xfd, 0xd0,
+  0xde, 0xa4, 0x17, 0x62, 0xa3, 0xbe, 0x5e, 0x9b, 0x09, 0xa8, 0xb8, 0xbf, 0x74, 0x63, 0x31, 0xd3,
+  0x52, 0x54, 0x4b, 0xc4, 0xc8, 0xef, 0xe9, 0x46, 0xbc, 0xbb, 0x7e, 0xf7, 0x6f, 0x57, 0xa2, 0x2a,
+  0x10, 0x1c, 0x8a, 0xda, 0x3b, 0x09, 0x1d, 0x47, 0x22, 0xa4, 0x18, 0x1c, 0x88, 0x9f, 0xae, 0xfa,
+  0x5d, 0xaf, 0xee, 0xa8, 0x24, 0x9a, 0x14, 0xdf, 0x7b, 0x7b, 0x30, 0xe4, 0xd3, 0x01, 0x8b, 0x81,
+  0xb4, 0x37, 0x19, 0xa2, 0x1d, 0x46, 0xd0, 0x21, 0x8b, 0x3f, 0xfe, 0xd0, 0x68, 0xd4, 0x1f, 0x7d,
+  0x75, 0x71, 0xc1, 0x03, 0xc3, 0x7e, 0xd3, 0x69, 0x36, 0x27, 0xe8, 0xd7, 0x6a, 0x7f, 0xd9, 0xad,
+  0xe7, 0x0e, 0x06, 0x2c, 0xe6, 0xd2, 0xe9, 0xec, 0xe9, 0xd9, 0x22, 0x2a, 0x3f, 0x75, 0x66, 0xa1,
+  0xaa, 0xd8, 0xaa, 0x53, 0xed, 0x8e, 0xdc, 0xa4, 0x18, 0x9d, 0xaa, 0x25, 0xda, 0x91, 0x3c, 0x7e,
+  0xe8, 0x8c, 0xa2, 0xac, 0x8f, 0x6e, 0x64, 0x12, 0x55, 0xa1, 0x5e, 0x69, 0xa8, 0x47, 0x7d, 0xe5,
+  0x38, 0x63, 0x70, 0x71, 0x01, 0x11, 0xb7, 0x59, 0xac, 0x92, 0x34, 0x83, 0x59, 0xbf, 0x13, 0xc6,
+  0xbf, 0x5e, 0xdd, 0x18, 0x62, 0x26, 0xf4, 0x85, 0xa4, 0xa6, 0xa9, 0x41, 0x3f, 0x75, 0xba, 0x85,
+  0x24, 0x6f, 0x49, 0x83, 0x8d, 0xf5, 0x5b, 0x99, 0x67, 0xba, 0xf0, 0x23, 0x76, 0x97, 0x55, 0xb5,
+  0xb9, 0x6e, 0x4e, 0x35, 0x7a, 0xab, 0xbd, 0xdf, 0x6a, 0x4e, 0x40, 0xb5, 0x6f, 0xaf, 0x55, 0x16,
+  0x8b, 0x0f, 0x4d, 0x98, 0xea, 0xdf, 0x97, 0x5c, 0x4e, 0xfa, 0xf3, 0xfa, 0xea, 0x54, 0xa0, 0x00,
+  0xed, 0x54, 0x51, 0x8a, 0x5d, 0x0a, 0x43, 0x90, 0xbb, 0xeb, 0x50, 0x05, 0xeb, 0x9d, 0xcc, 0x50,
+  0x33, 0x32, 0x44, 0xcc, 0xb1, 0x4d, 0x4a, 0x10, 0x7e, 0x4d, 0x75, 0x84, 0x4d, 0xd9, 0x90, 0xde,
+  0xdb, 0x26, 0x69, 0x66, 0x69, 0x6a, 0x36, 0xc8, 0x0d, 0x24, 0x7d, 0x12, 0x5b, 0x72, 0xb3, 0x01,
+  0xa6, 0xb9, 0xbf, 0x97, 0x1c, 0x30, 0xd4, 0xab, 0x55, 0x1e, 0x9a, 0x1f, 0xd8, 0x2b, 0x25, 0x0e,
+  0x39, 0x65, 0x1e, 0x8a, 0x8c, 0xd0, 0xd5, 0x42, 0xdf, 0xa2, 0xcb, 0x33, 0xb8, 0x7e, 0x51, 0xd4,
+  0x1a, 0xfb, 0xc6, 0x90, 0x7c, 0x64, 0x9c, 0xe5, 0x95, 0x3c, 0xe3, 0xb7, 0xdf, 0x69, 0xbc, 0x0b,
+  0x0a, 0xfa, 0x86, 0x54, 0x12, 0x9f, 0x72, 0xae, 0x6e, 0x89, 0xf4, 0x59, 0xff, 0xf9, 0x92, 0xf6,
+  0xd9, 0x14, 0x7b, 0x2b, 0xcb, 0xa5, 0x4e, 0x30, 0xa3, 0x71, 0x1e, 0x69, 0xb1, 0x8f, 0x0b, 0x4b,
+  0x52, 0x98, 0xbf, 0xe2, 0xb6, 0x72, 0x7f, 0xa0, 0xa0, 0xe1, 0x6c, 0x41, 0xf6, 0xdd, 0x74, 0x9d,
+  0x0b, 0xe4, 0x37, 0x6a, 0x59, 0x4b, 0x4c, 0x0b, 0x64, 0x9c, 0x12, 0x19, 0x09, 0x51, 0x07, 0x74,
+  0x71, 0x0c, 0x77, 0xa3, 0x89, 0xd1, 0x69, 0x59, 0x92, 0x88, 0xe9, 0x1a, 0x87, 0xb6, 0x90, 0x09,
+  0x8e, 0x6d, 0x80, 0xd3, 0x81, 0x96, 0x6f, 0x2b, 0xae, 0xa3, 0x07, 0x41, 0xb4, 0xb7, 0x4f, 0xa8,
+  0x16, 0x69, 0xf6, 0x1d, 0xa5, 0x37, 0x5b, 0xe7, 0x38, 0x13, 0x50, 0x50, 0xbe, 0xd1, 0xed, 0x30,
+  0xbf, 0x26, 0x41, 0x69, 0x0b, 0x39, 0x7d, 0xa1, 0x2b, 0x48, 0x27, 0xb7, 0xe1, 0x0b, 0xa3, 0xdf,
+  0xa9, 0xc4, 0x9d, 0xc0, 0xa4, 0xc4, 0x74, 0x51, 0xe2, 0x9a, 0xbc, 0xe4, 0x33, 0xc5, 0xf8, 0x55,
+  0xfd, 0x86, 0xaa, 0xab, 0x90, 0x1a, 0xfb, 0x42, 0x4c, 0x67, 0x05, 0x88, 0xd4, 0xd3, 0x3c, 0x39,
+  0xbb, 0xae, 0xfd, 0xfa, 0x49, 0xbf, 0x41, 0x3f, 0xcf, 0xc9, 0x86, 0xf4, 0xde, 0x2d, 0xe9, 0xda,
+  0x5c, 0x33, 0x24, 0x9f, 0x28, 0xce, 0x30, 0xa3, 0x50, 0x91, 0xe2, 0xa3, 0xcc, 0x20, 0x4f, 0x56,
+  0xc5, 0x03, 0x1f, 0xb8, 0x1d, 0x0b, 0x7c, 0x26, 0x62, 0xe7, 0xbd, 0x0e, 0xed, 0x4f, 0x22, 0x92,
+  0xc8, 0x63, 0x9c, 0x18, 0x44, 0x04, 0x7e, 0x80, 0xa7, 0x33, 0x55, 0x0f, 0x3d, 0x30, 0xed, 0x06,
+  0x19, 0x3c, 0x14, 0xb2, 0xfc, 0x28, 0x76, 0x74, 0x6f, 0xcf, 0x5e, 0xa8, 0xb3, 0x68, 0x91, 0x43,
+  0xca, 0x7c, 0x40, 0x5b, 0x59, 0xed, 0x25, 0x36, 0xcc, 0xcb, 0x97, 0x9a, 0xfe, 0x65, 0x73, 0x32,
+  0x1f, 0x99, 0xa4, 0xbe, 0x42, 0xe7, 0xaf, 0x76, 0xc5, 0x76, 0x03, 0xe3, 0x08, 0x59, 0x89, 0x7d,
+  0xdc, 0xf2, 0xa1, 0xc4, 0xf5, 0x8e, 0x4c, 0xad, 0x55, 0xa1, 0xa0, 0xc0, 0x19, 0xb4, 0x4e, 0x4b,
+  0x65, 0x16, 0xd4, 0xbb, 0x00, 0xee, 0x26, 0x5d, 0x2b, 0x78, 0xde, 0x2c, 0x06, 0x74, 0xb4, 0xd8,
+  0x38, 0x61, 0x98, 0x6f, 0x9f, 0x15, 0x84, 0x31, 0x3e, 0x17, 0x0e, 0x6d, 0xf3, 0x2b, 0xf6, 0xca,
+  0x63, 0x32, 0x7d, 0xe4, 0x3f, 0x7b, 0x48, 0xb3, 0x2d, 0xe6, 0x4c, 0xb4, 0x22, 0x7b, 0x1f, 0x77,
+  0x4c, 0x4e, 0x0a, 0xa8, 0xd8, 0x38, 0xad, 0x90, 0x7e, 0x79, 0xc2, 0xd1, 0xa7, 0x9d, 0x7c, 0xf2,
+  0x58, 0x3d, 0x8a, 0xcd, 0xfa, 0x84, 0x9d, 0x3f, 0x15, 0x87, 0xa2, 0xcd, 0xb8, 0xa3, 0x3f, 0x72,
+  0x48, 0xbf, 0x20, 0xd0, 0x57, 0xc6, 0xf3, 0xa7, 0xae, 0x41, 0x5f, 0x02, 0x9f, 0x3f, 0x74, 0x1b,
+  0x90, 0xd3, 0x05, 0xe1, 0x6f, 0xb5, 0x14, 0xc2, 0x7c, 0x7a, 0xe0, 0x92, 0x2f, 0xfb, 0x96, 0xf8,
+  0x55, 0x85, 0x79, 0x5e, 0xb5, 0x55, 0xe3, 0x99, 0x46, 0xaa, 0xfe, 0x5e, 0x47, 0x40, 0x7b, 0x0f,
+  0xeb, 0xb6, 0x77, 0x95, 0xc3, 0x5b, 0x88, 0x4b, 0x6b, 0x59, 0x28, 0x6a, 0x4f, 0x8d, 0x33, 0x94,
+  0x52, 0xdf, 0xe6, 0xae, 0xe2, 0x13, 0xdd, 0xc0, 0xac, 0x31, 0x1f, 0xe8, 0x6f, 0x39, 0xfb, 0xf9,
+  0xe0, 0xf9, 0x0e, 0xb7, 0xd3, 0x9f, 0xb6, 0x8d, 0xed, 0x57, 0x49, 0x63, 0xcd, 0x27, 0xed, 0x1c,
+  0x1d, 0x97, 0x7b, 0x43, 0xd5, 0x76, 0xac, 0xbf, 0x7d, 0x92, 0x40, 0xfc, 0x2d, 0x1c, 0xa2, 0xb7,
+  0x15, 0xd6, 0xe2, 0xf8, 0x32, 0x11, 0x08, 0x24, 0xcd, 0x81, 0x73, 0x38, 0x38, 0x74, 0xb0, 0x60,
+  0x69, 0xa1, 0xc2, 0x95, 0x28, 0x6b, 0x7d, 0x3d, 0xa5, 0x74, 0x06, 0xf1, 0xb3, 0xfa, 0x13, 0xe3,
+  0x19, 0xff, 0x39, 0xcf, 0xff, 0x01, 0xd2, 0x00, 0x76, 0xfd, 0xe5, 0x23, 0x00, 0x00,
+};
+static const size_t WEB_OTA_UPDATE_GZ_LEN = 3838;
+
+#endif // WEB_ASSETS_H
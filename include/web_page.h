@@ -0,0 +1,40 @@
+/*
+ * Web Page Module
+ * Phục vụ trang HTML nhúng trong PROGMEM (xem web/ và web_assets.h)
+ *
+ * - Trang tĩnh: gzip sẵn lúc build, gửi thẳng từ flash bằng send_P
+ * - Trang có {{KEY}}: stream theo chunk, thay placeholder khi đi qua
+ * Không trang nào dựng String trên heap.
+ */
+
+#ifndef WEB_PAGE_H
+#define WEB_PAGE_H
+
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+#include <functional>
+
+class WebPage {
+public:
+  static constexpr size_t CHUNK_SIZE = 256;   // Stack buffer per chunk
+  static constexpr size_t MAX_KEY = 24;       // Longest {{KEY}}
+  static constexpr size_t MAX_VALUE = 128;    // Longest substituted value
+
+  // Writes the value for `key` into out (leave empty for a blank)
+  typedef std::function<void(const char* key, char* out, size_t outLen)> Resolver;
+
+  // Serve a pre-compressed PROGMEM blob with Content-Encoding: gzip
+  static void sendGzip(ESP8266WebServer& server, const char* contentType,
+                       const uint8_t* data, size_t length, int code = 200);
+
+  // Stream a PROGMEM template (chunked), replacing {{KEY}} via resolve().
+  // Values are HTML-escaped.
+  static void sendTemplate(ESP8266WebServer& server, const char* contentType,
+                           PGM_P tmpl, const Resolver& resolve, int code = 200);
+
+private:
+  static void sendEscaped(ESP8266WebServer& server, const char* value,
+                          char* buf, size_t& used);
+};
+
+#endif // WEB_PAGE_H
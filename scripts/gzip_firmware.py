@@ -0,0 +1,33 @@
+"""
+Firmware Compressor (PlatformIO post-build)
+Writes firmware.bin.gz next to firmware.bin after every build
+
+eboot (ESP8266 core >= 2.7) recognises the gzip magic and inflates the image
+in place on reboot, so the .bin.gz can be sent through any OTA path as-is
+(web upload, pull from the bridge). Firmware images compress well, so the
+upload is noticeably shorter over weak links.
+"""
+
+import gzip
+import os
+
+Import('env')  # noqa: F821 - provided by PlatformIO/SCons
+
+
+def gzip_firmware(source, target, env):
+    firmware = target[0].get_abspath()
+    packed_path = firmware + '.gz'
+
+    with open(firmware, 'rb') as f:
+        raw = f.read()
+
+    # mtime=0 keeps the output (and its sha256) reproducible
+    packed = gzip.compress(raw, compresslevel=9, mtime=0)
+    with open(packed_path, 'wb') as f:
+        f.write(packed)
+
+    print('✓ %s: %d -> %d bytes (%d%%)' % (os.path.basename(packed_path), len(raw),
+                                          len(packed), len(packed) * 100 // len(raw)))
+
+
+env.AddPostAction('$BUILD_DIR/${PROGNAME}.bin', gzip_firmware)  # noqa: F821
@@ -0,0 +1,45 @@
+"""
+Collectors - Nguồn dữ liệu cho /system-info
+Mỗi backend trả về cùng một schema JSON (empty_result) nên firmware không cần biết nguồn
+  - lhm:   Libre Hardware Monitor (Windows), trong system_monitor_server.py
+  - linux: /proc + /sys, trong linux_collector.py
+"""
+
+
+def empty_result(host):
+    """The /system-info schema with every metric zeroed (key order is part of the contract)"""
+    return {
+        "host": host[:20],  # Nhãn trang carousel khi ESP theo dõi nhiều máy
+        "cpu": {"name": "", "temp": 0, "load": 0, "power": 0},
+        "ram": {"used": 0, "total": 0, "percent": 0},
+        "gpu_discrete": {"name": "", "temp": 0, "load": 0, "power": 0, "mem_used": 0, "mem_total": 0},
+        "gpu_integrated": {"name": "", "temp": 0, "load": 0},
+        "disk": [],
+        "network": {"name": "", "upload": 0, "download": 0},  # Busiest NIC (firmware cũ chỉ đọc key này)
+        "networks": [],  # Mọi NIC, thứ tự cố định: [{"name", "upload", "download"}]
+        "cores": {"load": "", "clock": ""}  # Từng CPU logic, xem pack_cores()
+    }
+
+
+def pack_cores(loads, clocks_mhz):
+    """Per-core load (%) and clock (MHz) as hex strings, one byte per core.
+
+    Packed so the device parses 128 cores as two strings instead of 256 JSON
+    values. Clock is in 100 MHz steps (0 = unknown).
+    """
+    load = "".join(f"{min(100, max(0, round(v))):02x}" for v in loads)
+    clock = "".join(f"{min(255, max(0, round(v / 100))):02x}" for v in clocks_mhz)
+    return {"load": load, "clock": clock}
+
+
+class Collector:
+    """Backend interface: start() once, then collect() per request"""
+
+    name = "base"
+
+    def start(self):
+        """Begin sampling (backends that poll on request do nothing)"""
+
+    def collect(self):
+        """Latest metrics as an empty_result()-shaped dict (or {"error", "message"})"""
+        raise NotImplementedError
@@ -0,0 +1,139 @@
+"""
+Layout Compiler - Biên dịch layout dashboard (JSON) thành descriptor nhị phân cho panel
+Bridge dùng khi có LAYOUT_FILE; cũng chạy tay để kiểm tra hoặc đẩy thẳng lên panel
+
+Usage:
+  python layout_compiler.py layout.json [-o layout.bin]
+  python layout_compiler.py layout.json --push DEVICE_IP     # POST /layout (port 9100)
+  python layout_compiler.py --reset DEVICE_IP                # Back to the built-in layout
+  ... --push/--reset DEVICE_IP --token SECRET                # Panel built with PUSH_TOKEN
+
+layout.json:
+  {"grid": [3, 2], "tiles": [
+     {"tile": "cpu", "at": [0, 0]},
+     {"tile": "push", "metric": "farm.queue", "at": [1, 0], "span": [2, 1], "color": "net"},
+     ...]}
+"""
+
+import argparse
+import json
+import zlib
+
+# Must match TileKind (include/dashboard_layout.h) and PALETTE (src/layout_store.cpp)
+TILE_KINDS = ["cpu", "ram", "gpu", "vram", "storage", "net", "net_up", "net_down", "cores", "push"]
+COLORS = ["default", "cpu", "ram", "gpu", "disk", "net", "vram", "header", "text", "alert"]
+
+VERSION = 1
+GRID_MAX = 8
+TILE_MAX = 12      # LAYOUT_TILE_MAX
+DESC_MAX = 256     # LAYOUT_DESC_MAX
+NAME_MAX = 15      # PUSH_NAME_LEN - 1
+
+
+def compile_layout(layout):
+    """layout dict -> descriptor bytes (raises ValueError with a readable reason)"""
+    cols, rows = layout.get("grid", (0, 0))
+    if not (1 <= cols <= GRID_MAX and 1 <= rows <= GRID_MAX):
+        raise ValueError(f"grid must be 1..{GRID_MAX} x 1..{GRID_MAX}")
+    tiles = layout.get("tiles", [])
+    if not 1 <= len(tiles) <= TILE_MAX:
+        raise ValueError(f"1..{TILE_MAX} tiles allowed")
+
+    out = bytearray(b"HL" + bytes([VERSION, cols, rows, len(tiles)]))
+    used = set()
+    for n, tile in enumerate(tiles):
+        kind = tile.get("tile")
+        if kind not in TILE_KINDS:
+            raise ValueError(f"tile {n}: unknown tile {kind!r} (one of {', '.join(TILE_KINDS)})")
+        col, row = tile.get("at", (0, 0))
+        span_cols, span_rows = tile.get("span", (1, 1))
+        if span_cols < 1 or span_rows < 1 or col < 0 or row < 0 or col + span_cols > cols or row + span_rows > rows:
+            raise ValueError(f"tile {n}: off the {cols}x{rows} grid")
+        cells = {(c, r) for c in range(col, col + span_cols) for r in range(row, row + span_rows)}
+        if cells & used:
+            raise ValueError(f"tile {n}: overlaps another tile")
+        used |= cells
+
+        color = tile.get("color", "default")
+        if color not in COLORS:
+            raise ValueError(f"tile {n}: unknown color {color!r} (one of {', '.join(COLORS)})")
+
+        metric = tile.get("metric", "") if kind == "push" else ""
+        name = metric.encode("ascii")
+        if kind == "push" and not 1 <= len(name) <= NAME_MAX:
+            raise ValueError(f"tile {n}: push tiles need a metric name of 1..{NAME_MAX} characters")
+
+        out += bytes([TILE_KINDS.index(kind), col, row, span_cols, span_rows, COLORS.index(color), len(name)])
+        if name:
+            out += name + b"\0"
+
+    if len(out) > DESC_MAX:
+        raise ValueError(f"descriptor is {len(out)} bytes, the panel takes {DESC_MAX}")
+    return bytes(out)
+
+
+def layout_id(descriptor):
+    """CRC32 the panel computes for the same bytes (announced as "layout" in /system-info)"""
+    return zlib.crc32(descriptor) or 1
+
+
+class LayoutFile:
+    """LAYOUT_FILE for the bridge: recompiled when the file changes, no restart needed"""
+
+    def __init__(self, path):
+        self.path = path
+        self.mtime = None
+        self.descriptor = None
+        self.id = 0
+
+    def get(self):
+        """(descriptor, id), or (None, 0) if the file is missing or invalid"""
+        import os
+        try:
+            mtime = os.path.getmtime(self.path)
+        except OSError:
+            return None, 0
+        if mtime != self.mtime:
+            self.mtime = mtime
+            try:
+                with open(self.path, "r", encoding="utf-8") as f:
+                    self.descriptor = compile_layout(json.load(f))
+                self.id = layout_id(self.descriptor)
+                print(f"[LAYOUT] {self.path}: {len(self.descriptor)} bytes, id {self.id:08x}")
+            except (OSError, ValueError) as e:
+                print(f"[LAYOUT] {self.path}: {e}")
+                self.descriptor, self.id = None, 0
+        return self.descriptor, self.id
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Compile a dashboard layout for the panel")
+    parser.add_argument("layout", nargs="?", help="layout.json")
+    parser.add_argument("-o", "--output", help="Write the descriptor to this file")
+    parser.add_argument("--push", metavar="DEVICE", help="Send it to the panel (host or host:port)")
+    parser.add_argument("--reset", metavar="DEVICE", help="Restore the panel's built-in layout")
+    parser.add_argument("--token", help="PUSH_TOKEN of the panel, if it has one")
+    args = parser.parse_args()
+
+    def device_url(device):
+        return f"http://{device if ':' in device else device + ':9100'}/layout"
+
+    auth = {"token": args.token} if args.token else {}
+
+    if args.reset:
+        import requests
+        print(requests.post(device_url(args.reset), params={"reset": "1", **auth}, timeout=5).text)
+    elif not args.layout:
+        parser.error("layout.json required")
+    else:
+        with open(args.layout, "r", encoding="utf-8") as f:
+            descriptor = compile_layout(json.load(f))
+        print(f"{len(descriptor)} bytes, id {layout_id(descriptor):08x}")
+        if args.output:
+            with open(args.output, "wb") as f:
+                f.write(descriptor)
+        if args.push:
+            import requests
+            r = requests.post(device_url(args.push), data=descriptor, params=auth,
+                              headers={"Content-Type": "application/octet-stream"}, timeout=5)
+            print(r.status_code, r.text)
@@ -0,0 +1,306 @@
+"""
+LHM Simulator - Giả lập Libre Hardware Monitor (/data.json) để test end-to-end không cần Windows
+Phần cứng cấu hình được (CPU, GPU rời/iGPU, nhiều disk/NIC), giá trị sensor chạy theo kịch bản tải
+
+Usage:
+  python lhm_simulator.py [--cpus 1] [--cores 8] [--gpus 1] [--no-igpu] [--disks 2] [--nics 1]
+                          [--pattern gaming | --scenario scenario.json] [--speed 1] [--seed 1]
+  Bridge: LIBRE_HW_MONITOR_URL=http://127.0.0.1:8085/data.json python system_monitor_server.py
+
+Kịch bản (scenario.json), các phase chạy lần lượt rồi lặp lại:
+  {"phases": [{"seconds": 30, "pattern": "idle"},
+              {"seconds": 60, "cpu": 95, "gpu": 20, "net": 5},
+              {"seconds": 60, "pattern": "gaming"}]}
+"""
+
+import argparse
+import json
+import math
+import random
+import threading
+import time
+
+from flask import Flask, jsonify
+
+app = Flask(__name__)
+app.config['JSON_SORT_KEYS'] = False
+
+STEP = 0.25        # Simulated seconds per step (same trajectory whatever the poll rate)
+RAM_TOTAL = 32.0   # GB
+
+
+# ===== Load patterns =====
+# Each returns target loads 0..100 for t seconds into the phase
+
+def pattern_idle(t):
+    return {"cpu": 3, "gpu": 1, "igpu": 2, "disk": 1, "net": 0.2, "ram": 25}
+
+def pattern_office(t):
+    wave = (math.sin(t / 20) + 1) / 2
+    return {"cpu": 8 + 20 * wave, "gpu": 3, "igpu": 10 + 15 * wave, "disk": 3, "net": 2 + 8 * wave, "ram": 45}
+
+def pattern_gaming(t):
+    scene = (math.sin(t / 7) + 1) / 2   # Heavier scenes every ~45s
+    return {"cpu": 45 + 25 * scene, "gpu": 85 + 14 * scene, "igpu": 2, "disk": 5, "net": 3, "ram": 60}
+
+def pattern_build(t):
+    link = (t % 40) > 32                # Single-threaded link step at the end of each cycle
+    return {"cpu": 20 if link else 98, "gpu": 2, "igpu": 2, "disk": 60 if link else 25, "net": 0.5, "ram": 70}
+
+def pattern_sawtooth(t):
+    ramp = (t % 60) / 60 * 100
+    return {"cpu": ramp, "gpu": ramp, "igpu": ramp / 2, "disk": ramp / 2, "net": ramp, "ram": 30 + ramp / 2}
+
+def pattern_burst(t):
+    on = (t % 20) < 5
+    return {"cpu": 100 if on else 5, "gpu": 100 if on else 2, "igpu": 5, "disk": 80 if on else 2,
+            "net": 90 if on else 1, "ram": 50}
+
+PATTERNS = {
+    "idle": pattern_idle,
+    "office": pattern_office,
+    "gaming": pattern_gaming,
+    "build": pattern_build,
+    "sawtooth": pattern_sawtooth,
+    "burst": pattern_burst,
+}
+
+
+class Scenario:
+    """Phases played in order, then looped"""
+
+    def __init__(self, phases):
+        self.phases = phases
+        self.duration = sum(p["seconds"] for p in phases)
+
+    @classmethod
+    def load(cls, path):
+        with open(path, 'r', encoding='utf-8') as f:
+            phases = json.load(f)["phases"]
+        for p in phases:
+            if p.get("seconds", 0) <= 0:
+                raise ValueError(f"{path}: every phase needs seconds > 0")
+            if "pattern" in p and p["pattern"] not in PATTERNS:
+                raise ValueError(f"{path}: unknown pattern {p['pattern']}")
+        return cls(phases)
+
+    def targets(self, t):
+        t %= self.duration
+        for phase in self.phases:
+            if t < phase["seconds"]:
+                break
+            t -= phase["seconds"]
+        base = PATTERNS[phase.get("pattern", "idle")](t)
+        base.update({k: v for k, v in phase.items() if k in base})  # Fixed targets override
+        return base
+
+
+# ===== Hardware model =====
+
+class Device:
+    """One sensor source: load follows its target, temperature lags behind the load"""
+
+    def __init__(self, kind, name, idle_temp, max_temp, tdp, tau):
+        self.kind = kind
+        self.name = name
+        self.idle_temp = idle_temp
+        self.max_temp = max_temp
+        self.tdp = tdp
+        self.tau = tau          # Thermal time constant (s)
+        self.load = 0.0
+        self.temp = idle_temp
+
+    def step(self, target, noise):
+        self.load = min(100.0, max(0.0, self.load + (target - self.load) * 0.5 + noise))
+        goal = self.idle_temp + (self.max_temp - self.idle_temp) * self.load / 100
+        self.temp += (goal - self.temp) * min(1.0, STEP / self.tau)
+
+    @property
+    def power(self):
+        return self.tdp * (0.1 + 0.9 * self.load / 100)
+
+
+class Machine:
+    def __init__(self, args):
+        self.name = args.name
+        self.cores = args.cores
+        self.rng = random.Random(args.seed)
+        self.cpus = [Device("cpu", f"AMD Ryzen 7 5800X #{i + 1}" if args.cpus > 1 else "AMD Ryzen 7 5800X",
+                            38, 88, 105, 6) for i in range(args.cpus)]
+        self.core_loads = [[0.0] * args.cores for _ in self.cpus]
+        self.gpus = [Device("gpu", "NVIDIA GeForce RTX 3070" + (f" #{i + 1}" if args.gpus > 1 else ""),
+                            34, 78, 220, 12) for i in range(args.gpus)]
+        self.igpu = Device("igpu", "AMD Radeon(TM) Graphics", 40, 70, 15, 6) if args.igpu else None
+        self.disks = [Device("disk", f"Samsung SSD 980 PRO {i + 1}TB", 32, 58, 7, 30) for i in range(args.disks)]
+        self.disk_used = [40.0 + 10 * i for i in range(args.disks)]
+        self.nics = [{"name": "Ethernet" if i == 0 else f"Ethernet {i + 1}", "down": 0.0, "up": 0.0}
+                     for i in range(args.nics)]
+        self.ram = 25.0
+        self.scenario = Scenario.load(args.scenario) if args.scenario else \
+            Scenario([{"seconds": 3600, "pattern": args.pattern}])
+        self.speed = args.speed
+        self.sim_time = 0.0
+        self.start = time.monotonic()
+        self.lock = threading.Lock()
+
+    def noise(self, scale):
+        return self.rng.uniform(-scale, scale)
+
+    def step(self):
+        target = self.scenario.targets(self.sim_time)
+        for i, cpu in enumerate(self.cpus):
+            cpu.step(target["cpu"], self.noise(3))
+            # Cores scatter around the package load (a few busier than the rest)
+            for c in range(self.cores):
+                bias = 1.3 if c < max(1, self.cores // 4) else 0.9
+                self.core_loads[i][c] = min(100.0, max(0.0, cpu.load * bias + self.noise(8)))
+        for gpu in self.gpus:
+            gpu.step(target["gpu"], self.noise(2))
+        if self.igpu:
+            self.igpu.step(target["igpu"], self.noise(2))
+        for i, disk in enumerate(self.disks):
+            disk.step(target["disk"] / (i + 1), self.noise(1))
+            self.disk_used[i] = min(99.0, self.disk_used[i] + disk.load * 1e-5)
+        for i, nic in enumerate(self.nics):
+            share = target["net"] / (i + 1)
+            nic["down"] = max(0.0, share * 1.0 + self.noise(share * 0.2 + 0.05))
+            nic["up"] = max(0.0, share * 0.15 + self.noise(share * 0.05 + 0.02))
+        self.ram += (target["ram"] - self.ram) * 0.05
+        self.sim_time += STEP
+
+    def advance(self):
+        """Catch up with the (scaled) wall clock in fixed steps"""
+        with self.lock:
+            now = (time.monotonic() - self.start) * self.speed
+            while self.sim_time + STEP <= now:
+                self.step()
+
+    # ----- data.json tree (same shape and texts as LHM's Remote Web Server) -----
+
+    def tree(self):
+        self.advance()
+        ids = iter(range(1, 100000))
+
+        def node(text, children=(), image="", value=""):
+            return {"id": next(ids), "Text": text, "Min": value, "Value": value, "Max": value,
+                    "ImageURL": image, "Children": list(children)}
+
+        def group(text, image, sensors):
+            return node(text, [node(name, value=value) for name, value in sensors], image)
+
+        def fmt(v, unit):
+            return f"{v:.1f} {unit}"
+
+        hardware = []
+        for i, cpu in enumerate(self.cpus):
+            cores = self.core_loads[i]
+            hardware.append(node(cpu.name, [
+                group("Temperatures", "images/temperature.png",
+                      [("Core (Tctl/Tdie)", fmt(cpu.temp, "°C"))] +
+                      [(f"CPU Core #{c + 1}", fmt(cpu.temp - 2 + cores[c] / 25, "°C")) for c in range(self.cores)]),
+                group("Load", "images/load.png",
+                      [("CPU Total", fmt(cpu.load, "%"))] +
+                      [(f"CPU Core #{c + 1}", fmt(cores[c], "%")) for c in range(self.cores)]),
+                group("Powers", "images/power.png", [("Package", fmt(cpu.power, "W"))]),
+                group("Clocks", "images/clock.png",
+                      [(f"Core #{c + 1}", fmt(2200 + 25 * cores[c], "MHz")) for c in range(self.cores)]),
+            ], "images_icon/cpu.png"))
+
+        used = RAM_TOTAL * self.ram / 100
+        hardware.append(node("Generic Memory", [
+            group("Load", "images/load.png", [("Memory", fmt(self.ram, "%"))]),
+            group("Data", "images/data.png", [("Memory Used", fmt(used, "GB")),
+                                              ("Memory Available", fmt(RAM_TOTAL - used, "GB"))]),
+        ], "images_icon/ram.png"))
+
+        for gpu in self.gpus:
+            hardware.append(node(gpu.name, [
+                group("Temperatures", "images/temperature.png", [("GPU Core", fmt(gpu.temp, "°C"))]),
+                group("Load", "images/load.png", [("GPU Core", fmt(gpu.load, "%"))]),
+                group("Powers", "images/power.png", [("GPU Package", fmt(gpu.power, "W"))]),
+                group("Data", "images/data.png", [("GPU Memory Used", fmt(1024 + 60 * gpu.load, "MB")),
+                                                  ("GPU Memory Total", fmt(8192, "MB"))]),
+            ], "images_icon/nvidia.png"))
+
+        if self.igpu:
+            hardware.append(node(self.igpu.name, [
+                group("Temperatures", "images/temperature.png", [("GPU VR SoC", fmt(self.igpu.temp, "°C"))]),
+                group("Load", "images/load.png", [("GPU Core", fmt(self.igpu.load, "%"))]),
+            ], "images_icon/ati.png"))
+
+        for i, disk in enumerate(self.disks):
+            hardware.append(node(disk.name, [
+                group("Temperatures", "images/temperature.png", [("Temperature", fmt(disk.temp, "°C"))]),
+                group("Load", "images/load.png", [("Used Space", fmt(self.disk_used[i], "%")),
+                                                  ("Total Activity", fmt(disk.load, "%"))]),
+            ], "images_icon/hdd.png"))
+
+        for nic in self.nics:
+            hardware.append(node(nic["name"], [
+                group("Throughput", "images/throughput.png", [("Upload Speed", fmt(nic["up"], "MB/s")),
+                                                              ("Download Speed", fmt(nic["down"], "MB/s"))]),
+            ], "images_icon/nic.png"))
+
+        computer = node(self.name, hardware, "images_icon/computer.png")
+        return {"id": 0, "Text": "Sensor", "Min": "Min", "Value": "Value", "Max": "Max",
+                "ImageURL": "", "Children": [computer]}
+
+
+machine = None
+
+
+@app.route('/data.json', methods=['GET'])
+def data_json():
+    return jsonify(machine.tree())
+
+
+@app.route('/', methods=['GET'])
+def home():
+    return f"""
+    <h1>LHM Simulator</h1>
+    <p>{machine.name}: {len(machine.cpus)} CPU x {machine.cores} cores, {len(machine.gpus)} GPU,
+       {"iGPU, " if machine.igpu else ""}{len(machine.disks)} disks, {len(machine.nics)} NICs</p>
+    <p>Simulated time: {machine.sim_time:.0f}s (x{machine.speed})</p>
+    <p>Sensor tree: <a href="/data.json">/data.json</a></p>
+    """
+
+
+def main():
+    global machine
+
+    parser = argparse.ArgumentParser(description="Serve a simulated Libre Hardware Monitor data.json")
+    parser.add_argument("--port", type=int, default=8085)
+    parser.add_argument("--name", default="SIM-PC", help="Computer node name")
+    parser.add_argument("--cpus", type=int, default=1)
+    parser.add_argument("--cores", type=int, default=8, help="Cores per CPU")
+    parser.add_argument("--gpus", type=int, default=1, help="Discrete GPUs")
+    parser.add_argument("--no-igpu", dest="igpu", action="store_false", help="No integrated GPU")
+    parser.add_argument("--disks", type=int, default=2)
+    parser.add_argument("--nics", type=int, default=1)
+    parser.add_argument("--pattern", choices=sorted(PATTERNS), default="office")
+    parser.add_argument("--scenario", help="JSON file with load phases (overrides --pattern)")
+    parser.add_argument("--speed", type=float, default=1.0, help="Simulated seconds per real second")
+    parser.add_argument("--seed", type=int, default=1, help="Noise seed (same seed = same trajectory)")
+    args = parser.parse_args()
+    if min(args.cpus, args.cores) < 1 or min(args.gpus, args.disks, args.nics) < 0 or args.speed <= 0:
+        parser.error("counts must be >= 0 (cpus/cores >= 1) and --speed > 0")
+
+    machine = Machine(args)
+
+    print("=" * 50)
+    print("LHM Simulator")
+    print("=" * 50)
+    print(f"Hardware: {args.cpus} CPU x {args.cores} cores, {args.gpus} GPU, "
+          f"{'iGPU, ' if args.igpu else ''}{args.disks} disks, {args.nics} NICs")
+    print(f"Load: {args.scenario or args.pattern} (x{args.speed}, seed {args.seed})")
+    print(f"data.json: http://127.0.0.1:{args.port}/data.json")
+    print("=" * 50)
+
+    import logging
+    logging.getLogger('werkzeug').setLevel(logging.ERROR)
+
+    app.run(host='0.0.0.0', port=args.port, debug=False)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,342 @@
+"""
+Linux Collector - Đọc sensor trực tiếp từ /proc và /sys (không cần Libre Hardware Monitor)
+  CPU load  : /proc/stat (delta giữa 2 lần lấy mẫu), cả từng core + cpufreq cho heatmap
+  RAM       : /proc/meminfo
+  Nhiệt độ  : /sys/class/hwmon (coretemp, k10temp, amdgpu, nvme, drivetemp...)
+  CPU power : /sys/class/powercap/intel-rapl (delta năng lượng, thường cần quyền root)
+  GPU       : amdgpu qua hwmon + sysfs (NVIDIA không có sysfs -> để trống)
+  Disk      : /proc/diskstats (ổ vật lý) + % dung lượng các phân vùng đang mount
+  Network   : /sys/class/net/*/statistics (delta byte -> Mb/s)
+
+Lấy mẫu ở thread riêng với chu kỳ cố định; /system-info chỉ copy mẫu mới nhất.
+Đo overhead mỗi lần lấy mẫu:  python linux_collector.py --bench 200
+"""
+
+import copy
+import glob
+import os
+import threading
+import time
+
+from collectors import Collector, empty_result, pack_cores
+
+CPU_HWMON = ("coretemp", "k10temp", "zenpower", "cpu_thermal", "soc_thermal")
+CPU_TEMP_LABELS = ("Package id 0", "Tctl", "Tdie")
+VIRTUAL_NICS = ("lo", "docker", "veth", "br-", "virbr", "tun", "tap")
+VIRTUAL_DISKS = ("loop", "ram", "zram", "dm-", "md", "sr", "fd")
+IGPU_VRAM_MAX = 2 << 30     # amdgpu with <= 2 GiB carve-out = APU
+REDISCOVER_EVERY = 60       # Samples between hardware rescans (hot-plugged disks, new NICs)
+
+
+def read_text(path, default=""):
+    try:
+        with open(path, 'r') as f:
+            return f.read().strip()
+    except OSError:
+        return default
+
+
+def read_int(path, default=0):
+    try:
+        return int(read_text(path))
+    except ValueError:
+        return default
+
+
+def delta(now, prev):
+    """Counter difference, 0 on reset/wrap"""
+    return now - prev if now >= prev else 0
+
+
+class LinuxCollector(Collector):
+    name = "linux"
+
+    def __init__(self, host, interval_ms=1000, max_disks=8, root="/"):
+        self.host = host
+        self.interval = max(100, interval_ms) / 1000
+        self.max_disks = max_disks
+        self.root = root
+        self.lock = threading.Lock()
+        self.latest = empty_result(host)
+        self.prev = None            # Counters from the previous sample
+        self.samples = 0
+        self.nic = ""               # NIC shown last time (kept while everything is idle)
+        self.cpu_name = self.read_cpu_name()
+        self.discover()
+
+    def path(self, *parts):
+        return os.path.join(self.root, *parts)
+
+    # ----- discovery (once, then every REDISCOVER_EVERY samples) -----
+
+    def read_cpu_name(self):
+        for line in read_text(self.path("proc/cpuinfo")).splitlines():
+            key, _, value = line.partition(":")
+            if key.strip() in ("model name", "Model"):
+                return value.strip()
+        return "CPU"
+
+    def discover(self):
+        self.cpu_temp = None        # tempN_input path
+        self.gpus = []              # {"name", "integrated", "temp", "power", "busy", "vram_used", "vram_total"}
+        self.disk_temps = {}        # Real device path -> tempN_input path
+
+        for hwmon in sorted(glob.glob(self.path("sys/class/hwmon/hwmon*"))):
+            name = read_text(os.path.join(hwmon, "name"))
+            if name in CPU_HWMON and not self.cpu_temp:
+                self.cpu_temp = self.find_temp(hwmon, CPU_TEMP_LABELS)
+            elif name == "amdgpu":
+                self.gpus.append(self.amdgpu(hwmon))
+            elif name in ("nvme", "drivetemp"):
+                device = os.path.realpath(os.path.join(hwmon, "device"))
+                self.disk_temps[device] = os.path.join(hwmon, "temp1_input")
+
+        self.disks = self.find_disks()
+        self.nics = [os.path.basename(p) for p in sorted(glob.glob(self.path("sys/class/net/*")))
+                     if not os.path.basename(p).startswith(VIRTUAL_NICS)]
+        self.rapl = self.path("sys/class/powercap/intel-rapl:0/energy_uj")
+        if not os.access(self.rapl, os.R_OK):
+            self.rapl = None
+
+    @staticmethod
+    def find_temp(hwmon, labels):
+        """tempN_input whose label matches (in label order), else temp1_input"""
+        inputs = sorted(glob.glob(os.path.join(hwmon, "temp*_input")))
+        for wanted in labels:
+            for path in inputs:
+                if read_text(path.replace("_input", "_label")) == wanted:
+                    return path
+        return inputs[0] if inputs else None
+
+    def amdgpu(self, hwmon):
+        device = os.path.join(hwmon, "device")
+        vram_total = read_int(os.path.join(device, "mem_info_vram_total"))
+        power = os.path.join(hwmon, "power1_average")
+        if not os.path.exists(power):
+            power = os.path.join(hwmon, "power1_input")
+        return {
+            "name": read_text(os.path.join(device, "product_name")) or "AMD Radeon",
+            "integrated": 0 < vram_total <= IGPU_VRAM_MAX,
+            "temp": self.find_temp(hwmon, ("edge",)),
+            "power": power,
+            "busy": os.path.join(device, "gpu_busy_percent"),
+            "vram_used": os.path.join(device, "mem_info_vram_used"),
+            "vram_total": vram_total,
+        }
+
+    def find_disks(self):
+        """Whole physical disks from /proc/diskstats with their mounted partitions"""
+        mounts = {}
+        for line in read_text(self.path("proc/mounts")).splitlines():
+            fields = line.split()
+            if len(fields) >= 2 and fields[0].startswith("/dev/"):
+                mounts.setdefault(os.path.basename(fields[0]), fields[1].replace("\\040", " "))
+
+        disks = []
+        for line in read_text(self.path("proc/diskstats")).splitlines():
+            fields = line.split()
+            if len(fields) < 4:
+                continue
+            dev = fields[2]
+            block = self.path("sys/block", dev)
+            if dev.startswith(VIRTUAL_DISKS) or not os.path.exists(os.path.join(block, "device")):
+                continue  # Partition, loop, device-mapper...
+            parts = [dev] + [p for p in os.listdir(block) if p.startswith(dev)]
+            model = read_text(os.path.join(block, "device", "model")) or dev
+            disks.append({
+                "name": model[:30],
+                "mounts": [mounts[p] for p in parts if p in mounts],
+                "temp": self.disk_temp(os.path.realpath(os.path.join(block, "device"))),
+            })
+        return disks
+
+    def disk_temp(self, device):
+        """drivetemp hangs off the SCSI device, nvme off the controller or its PCI parent"""
+        for _ in range(3):
+            if device in self.disk_temps:
+                return self.disk_temps[device]
+            device = os.path.dirname(device)
+        return None
+
+    # ----- sampling -----
+
+    @staticmethod
+    def cpu_ticks(line):
+        """(total, idle + iowait) jiffies of one /proc/stat cpu line"""
+        fields = line.split()[1:9]
+        ticks = [int(v) for v in fields] + [0] * (8 - len(fields))
+        return sum(ticks), ticks[3] + ticks[4]
+
+    def read_counters(self):
+        lines = read_text(self.path("proc/stat")).splitlines()
+        cpu_total, cpu_idle = self.cpu_ticks(lines[0]) if lines else (0, 0)
+        cores = [(line.split(None, 1)[0],) + self.cpu_ticks(line) for line in lines[1:] if line.startswith("cpu")]
+        nics = {}
+        for nic in self.nics:
+            stats = self.path("sys/class/net", nic, "statistics")
+            nics[nic] = (read_int(os.path.join(stats, "rx_bytes")), read_int(os.path.join(stats, "tx_bytes")))
+        return {
+            "time": time.monotonic(),
+            "cpu_total": cpu_total,
+            "cpu_idle": cpu_idle,
+            "cores": cores,
+            "energy": read_int(self.rapl) if self.rapl else 0,
+            "nics": nics,
+        }
+
+    def meminfo(self):
+        info = {}
+        for line in read_text(self.path("proc/meminfo")).splitlines():
+            key, _, value = line.partition(":")
+            info[key] = int(value.split()[0]) if value.strip() else 0
+        return info.get("MemTotal", 0), info.get("MemAvailable", info.get("MemFree", 0))
+
+    @staticmethod
+    def milli(path):
+        """hwmon milli-unit value (°C) or 0"""
+        return round(read_int(path) / 1000, 1) if path else 0
+
+    def sample(self):
+        """Take one sample; loads and rates come from the deltas to the previous one"""
+        if self.samples and self.samples % REDISCOVER_EVERY == 0:
+            self.discover()
+        self.samples += 1
+
+        now = self.read_counters()
+        prev = self.prev or now
+        self.prev = now
+        dt = now["time"] - prev["time"]
+        result = empty_result(self.host)
+
+        cpu = result["cpu"]
+        cpu["name"] = self.cpu_name
+        total = delta(now["cpu_total"], prev["cpu_total"])
+        if total:
+            cpu["load"] = round(100 * (total - delta(now["cpu_idle"], prev["cpu_idle"])) / total, 1)
+        cpu["temp"] = self.milli(self.cpu_temp)
+
+        # Per logical CPU (cpufreq is in kHz; missing on some VMs -> clock 0)
+        loads, clocks = [], []
+        for i, (core, core_total, core_idle) in enumerate(now["cores"]):
+            old = prev["cores"][i] if i < len(prev["cores"]) else (core, core_total, core_idle)
+            busy_total = delta(core_total, old[1])
+            loads.append(100 * (busy_total - delta(core_idle, old[2])) / busy_total if busy_total else 0)
+            clocks.append(read_int(self.path("sys/devices/system/cpu", core, "cpufreq/scaling_cur_freq")) / 1000)
+        result["cores"] = pack_cores(loads, clocks)
+        if self.rapl and dt > 0:
+            cpu["power"] = round(delta(now["energy"], prev["energy"]) / 1e6 / dt, 1)
+
+        total_kb, available_kb = self.meminfo()
+        ram = result["ram"]
+        ram["total"] = round(total_kb / 1048576, 1)           # GiB, like LHM
+        ram["used"] = round((total_kb - available_kb) / 1048576, 1)
+        ram["percent"] = round(100 * (total_kb - available_kb) / total_kb, 1) if total_kb else 0
+
+        for gpu in self.gpus:
+            section = result["gpu_integrated" if gpu["integrated"] else "gpu_discrete"]
+            if section["name"]:
+                continue  # First GPU of each kind, like the LHM path
+            section["name"] = gpu["name"]
+            section["temp"] = self.milli(gpu["temp"])
+            section["load"] = float(read_int(gpu["busy"]))
+            if not gpu["integrated"]:
+                section["power"] = round(read_int(gpu["power"]) / 1e6, 1)
+                section["mem_used"] = read_int(gpu["vram_used"]) >> 20
+                section["mem_total"] = gpu["vram_total"] >> 20
+
+        for disk in self.disks[:self.max_disks]:
+            size = free = 0
+            for mount in disk["mounts"]:
+                try:
+                    st = os.statvfs(mount)
+                except OSError:
+                    continue
+                size += st.f_blocks * st.f_frsize
+                free += st.f_bfree * st.f_frsize
+            result["disk"].append({
+                "name": disk["name"],
+                "temp": self.milli(disk["temp"]),
+                "load": round(100 * (size - free) / size, 1) if size else 0,   # Used space
+            })
+
+        # Every NIC (sorted by name), plus the busiest one this sample (stick with the last one while idle)
+        rates = {}
+        for nic, (rx, tx) in now["nics"].items():
+            old = prev["nics"].get(nic, (rx, tx))
+            rates[nic] = (delta(rx, old[0]) * 8 / 1e6 / dt if dt > 0 else 0,
+                          delta(tx, old[1]) * 8 / 1e6 / dt if dt > 0 else 0)
+            result["networks"].append({
+                "name": nic[:30],
+                "upload": round(rates[nic][1], 1),
+                "download": round(rates[nic][0], 1),
+            })
+        if rates:
+            busiest = max(rates, key=lambda n: sum(rates[n]))
+            if sum(rates[busiest]) > 0 or self.nic not in rates:
+                self.nic = busiest
+            net = result["network"]
+            net["name"] = self.nic[:30]
+            net["download"] = round(rates[self.nic][0], 1)
+            net["upload"] = round(rates[self.nic][1], 1)
+
+        with self.lock:
+            self.latest = result
+        return result
+
+    def start(self):
+        self.sample()   # Prime the counters; the first real rates arrive one interval later
+
+        def run():
+            start = time.monotonic()
+            while True:
+                # Fixed grid: a slow sample doesn't shift the ones after it
+                elapsed = time.monotonic() - start
+                time.sleep(self.interval - elapsed % self.interval)
+                try:
+                    self.sample()
+                except Exception as e:
+                    print(f"[LINUX] Sample failed: {e}")
+
+        threading.Thread(target=run, daemon=True).start()
+        print(f"[LINUX] Sampling /proc + /sys every {int(self.interval * 1000)}ms "
+              f"({len(self.disks)} disks, {len(self.nics)} NICs, {len(self.gpus)} AMD GPUs)")
+
+    def collect(self):
+        with self.lock:
+            return copy.deepcopy(self.latest)
+
+
+def benchmark(collector, count):
+    """Wall and CPU time of sample() (what the sampling thread pays per interval)"""
+    collector.sample()
+    wall, cpu = [], []
+    for _ in range(count):
+        w, c = time.perf_counter(), time.process_time()
+        collector.sample()
+        wall.append(time.perf_counter() - w)
+        cpu.append(time.process_time() - c)
+    wall.sort()
+    print(f"{count} samples: wall avg {sum(wall) / count * 1e6:.0f}us, "
+          f"p95 {wall[int(count * 0.95) - 1] * 1e6:.0f}us, max {wall[-1] * 1e6:.0f}us; "
+          f"cpu avg {sum(cpu) / count * 1e6:.0f}us")
+    print(f"At 1 sample/s that is {sum(cpu) / count * 100:.3f}% of one core")
+
+
+if __name__ == '__main__':
+    import argparse
+    import json
+    import socket
+
+    parser = argparse.ArgumentParser(description="Print or benchmark Linux /system-info samples")
+    parser.add_argument("--bench", type=int, metavar="N", help="Time N samples")
+    parser.add_argument("--root", default="/", help="Filesystem root (for a copied /proc + /sys tree)")
+    parser.add_argument("--disks", type=int, default=8)
+    args = parser.parse_args()
+
+    collector = LinuxCollector(socket.gethostname(), max_disks=args.disks, root=args.root)
+    if args.bench:
+        benchmark(collector, max(1, args.bench))
+    else:
+        collector.sample()
+        time.sleep(1)
+        print(json.dumps(collector.sample(), indent=2, ensure_ascii=False))
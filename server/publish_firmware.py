@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""
+Firmware Publisher
+Copies a build into server/firmware/ and writes manifest.json for the
+pull-based update channel (/firmware/manifest)
+
+Usage:
+    python publish_firmware.py                      # .pio build, version from version.h, 100% rollout
+    python publish_firmware.py --rollout 20         # staged: ~20% of devices first
+    python publish_firmware.py --rollout 100 --only-rollout   # widen an existing rollout
+    python publish_firmware.py --devices hwmon-1a2b3c         # pin to specific devices
+    python publish_firmware.py --gzip               # publish firmware.bin.gz (eboot inflates it)
+"""
+
+import argparse
+import gzip
+import hashlib
+import json
+import os
+import re
+import shutil
+
+SERVER_DIR = os.path.dirname(os.path.abspath(__file__))
+PROJECT_DIR = os.path.dirname(SERVER_DIR)
+FIRMWARE_DIR = os.getenv('FIRMWARE_DIR', os.path.join(SERVER_DIR, 'firmware'))
+MANIFEST = os.path.join(FIRMWARE_DIR, 'manifest.json')
+DEFAULT_BIN = os.path.join(PROJECT_DIR, '.pio', 'build', 'esp12e', 'firmware.bin')
+
+
+def project_version():
+    """Extract version from include/version.h"""
+    with open(os.path.join(PROJECT_DIR, 'include', 'version.h'), 'r', encoding='utf-8') as f:
+        match = re.search(r'#define\s+PROJECT_VERSION\s+"([^"]+)"', f.read())
+    return match.group(1) if match else None
+
+
+def sha256_file(path):
+    h = hashlib.sha256()
+    with open(path, 'rb') as f:
+        for block in iter(lambda: f.read(65536), b''):
+            h.update(block)
+    return h.hexdigest()
+
+
+def write_manifest(manifest):
+    os.makedirs(FIRMWARE_DIR, exist_ok=True)
+    with open(MANIFEST, 'w', encoding='utf-8') as f:
+        json.dump(manifest, f, indent=2)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Publish firmware for pull-based OTA')
+    parser.add_argument('--bin', default=DEFAULT_BIN, help='firmware.bin to publish')
+    parser.add_argument('--version', default=None, help='version string (default: include/version.h)')
+    parser.add_argument('--rollout', type=int, default=100, help='percent of devices offered the update (0-100)')
+    parser.add_argument('--devices', nargs='*', default=None, help='restrict to these device IDs')
+    parser.add_argument('--only-rollout', action='store_true', help='only change rollout of the current manifest')
+    parser.add_argument('--gzip', action='store_true', help='publish a gzip-compressed image (.bin.gz)')
+    args = parser.parse_args()
+
+    rollout = max(0, min(100, args.rollout))
+
+    if args.only_rollout:
+        with open(MANIFEST, 'r', encoding='utf-8') as f:
+            manifest = json.load(f)
+        manifest['rollout'] = rollout
+        if args.devices is not None:
+            manifest['devices'] = args.devices
+        write_manifest(manifest)
+        print(f"✓ v{manifest['version']} rollout -> {rollout}%")
+        return
+
+    version = args.version or project_version()
+    if not version:
+        parser.error('could not determine version')
+    if not os.path.exists(args.bin):
+        parser.error(f'{args.bin} not found - build first (pio run)')
+
+    name = f'hwmon-{version}.bin'
+    path = os.path.join(FIRMWARE_DIR, name)
+    raw_size = os.path.getsize(args.bin)
+    os.makedirs(FIRMWARE_DIR, exist_ok=True)
+
+    if args.gzip:
+        # Reuse the build's .bin.gz when present (scripts/gzip_firmware.py)
+        name += '.gz'
+        path += '.gz'
+        if os.path.exists(args.bin + '.gz'):
+            shutil.copyfile(args.bin + '.gz', path)
+        else:
+            with open(args.bin, 'rb') as src, open(path, 'wb') as dst:
+                dst.write(gzip.compress(src.read(), compresslevel=9, mtime=0))
+    else:
+        shutil.copyfile(args.bin, path)
+
+    manifest = {
+        'version': version,
+        'file': name,
+        'size': os.path.getsize(path),
+        'sha256': sha256_file(path),
+        'rollout': rollout,
+    }
+    if args.gzip:
+        manifest['raw_size'] = raw_size
+    if args.devices:
+        manifest['devices'] = args.devices
+    write_manifest(manifest)
+
+    print(f"✓ Published v{version}: {name}, {manifest['size']} bytes, sha256 {manifest['sha256'][:16]}..., rollout {rollout}%")
+
+
+if __name__ == '__main__':
+    main()
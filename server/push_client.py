@@ -0,0 +1,82 @@
+"""
+Push Client - Đẩy metric lên panel (POST /push, cần PUSH_ENABLED trong config.h)
+Dùng từ CI, cron, render farm... hoặc đo throughput ingest của thiết bị
+
+Usage:
+  python push_client.py DEVICE_IP ci.status=1 farm.queue=42.5 [--binary] [--token T]
+  python push_client.py DEVICE_IP --bench 200 [--metrics 8] [--binary]
+"""
+
+import argparse
+import json
+import struct
+import time
+
+import requests
+
+NAME_MAX = 15  # PUSH_NAME_LEN - 1 on the device
+
+
+def encode_binary(values):
+    """Binary frame: per metric [u8 name length][name][int32 little-endian value x10]"""
+    out = bytearray()
+    for name, value in values.items():
+        raw = name.encode("ascii")[:NAME_MAX]
+        out += bytes([len(raw)]) + raw + struct.pack("<i", round(value * 10))
+    return bytes(out)
+
+
+def push(session, url, values, binary=False, token=None):
+    """One POST /push. Returns the device reply ({"stored", "parse_us"})"""
+    params = {"token": token} if token else None
+    if binary:
+        body, content_type = encode_binary(values), "application/octet-stream"
+    else:
+        body, content_type = json.dumps(values, separators=(",", ":")), "application/json"
+    r = session.post(url, data=body, params=params, headers={"Content-Type": content_type}, timeout=5)
+    r.raise_for_status()
+    return r.json()
+
+
+def bench(session, url, requests_count, metrics, binary, token):
+    """Push the same-sized update N times: requests/s end to end and the device parse time"""
+    values = {f"bench.m{i}": 0.0 for i in range(metrics)}
+    parse_us = []
+    start = time.perf_counter()
+    for n in range(requests_count):
+        for i, name in enumerate(values):
+            values[name] = (n * 7 + i) % 1000 / 10
+        parse_us.append(push(session, url, values, binary, token)["parse_us"])
+    elapsed = time.perf_counter() - start
+
+    size = len(encode_binary(values)) if binary else len(json.dumps(values, separators=(",", ":")))
+    print(f"{requests_count} requests x {metrics} metrics ({'binary' if binary else 'JSON'}, {size} bytes)")
+    print(f"  end to end    {requests_count / elapsed:.1f} req/s, {requests_count * metrics / elapsed:.0f} values/s")
+    print(f"  device parse  avg {sum(parse_us) / len(parse_us):.0f}us, max {max(parse_us)}us per request")
+    print(f"                {metrics * len(parse_us) * 1e6 / max(1, sum(parse_us)):.0f} values/s of parse time")
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Push named metrics to the panel")
+    parser.add_argument("device", help="Panel address (host or host:port, default port 9100)")
+    parser.add_argument("values", nargs="*", metavar="name=value")
+    parser.add_argument("--binary", action="store_true", help="Send the compact binary frame instead of JSON")
+    parser.add_argument("--token", help="PUSH_TOKEN, if the panel has one")
+    parser.add_argument("--bench", type=int, metavar="N", help="Time N pushes")
+    parser.add_argument("--metrics", type=int, default=8, help="Metrics per request with --bench")
+    args = parser.parse_args()
+
+    device = args.device if ":" in args.device else f"{args.device}:9100"
+    url = f"http://{device}/push"
+    session = requests.Session()
+
+    if args.bench:
+        bench(session, url, args.bench, args.metrics, args.binary, args.token)
+    else:
+        values = {}
+        for item in args.values:
+            name, _, value = item.partition("=")
+            values[name] = float(value)
+        if not values:
+            parser.error("nothing to push (name=value ...)")
+        print(push(session, url, values, args.binary, args.token))
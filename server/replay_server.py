@@ -0,0 +1,149 @@
+"""
+Replay Server - Phát lại bản ghi /system-info (RECORD_FILE của system_monitor_server.py)
+Không cần Libre Hardware Monitor: ESP poll vào đây như bridge thật
+
+Usage:
+  python replay_server.py recording.jsonl [--speed 4] [--loop] [--port 8080]
+"""
+
+import argparse
+import bisect
+import copy
+import json
+import time
+
+from flask import Flask, jsonify, request
+
+from system_monitor_server import RECORDING_VERSION, apply_limits, get_local_ip, query_limit, to_fixed
+
+app = Flask(__name__)
+app.config['JSON_SORT_KEYS'] = False
+
+
+class Recording:
+    """Frames of one recording, looked up by (scaled) elapsed time"""
+
+    def __init__(self, path):
+        self.header = None
+        self.times = []
+        self.frames = []
+        with open(path, 'r', encoding='utf-8') as f:
+            for line in f:
+                line = line.strip()
+                if not line:
+                    continue
+                entry = json.loads(line)
+                if self.header is None:
+                    if entry.get("hwmon_rec") != RECORDING_VERSION:
+                        raise ValueError(f"{path}: not a v{RECORDING_VERSION} recording")
+                    self.header = entry
+                    continue
+                self.times.append(int(entry["t"]))
+                self.frames.append(entry["d"])
+        if not self.frames:
+            raise ValueError(f"{path}: no frames")
+        # Loop length: last frame + one sample interval
+        self.duration = self.times[-1] + int(self.header.get("interval", 1000))
+
+    def frame_at(self, t):
+        """Newest frame recorded at or before t (ms)"""
+        i = bisect.bisect_right(self.times, t) - 1
+        return max(i, 0)
+
+
+class Player:
+    def __init__(self, recording, speed, loop):
+        self.recording = recording
+        self.speed = speed
+        self.loop = loop
+        self.start = time.monotonic()
+
+    def position(self):
+        """Recording time (ms) for the current wall clock"""
+        t = int((time.monotonic() - self.start) * 1000 * self.speed) + self.recording.times[0]
+        if self.loop:
+            return t % self.recording.duration
+        return min(t, self.recording.times[-1])
+
+    def current(self):
+        t = self.position()
+        return t, self.recording.frame_at(t)
+
+
+player = None
+
+
+@app.route('/system-info', methods=['GET'])
+def system_info():
+    """Same reply as the live bridge, taken from the recording"""
+    _, index = player.current()
+    data = copy.deepcopy(player.recording.frames[index])  # to_fixed() edits in place
+    data = apply_limits(data, query_limit('disks'), query_limit('nics'), query_limit('cores'))
+    if request.args.get('fixed') == '1':
+        data = to_fixed(data)
+    return jsonify(data)
+
+
+@app.route('/replay/status', methods=['GET'])
+def replay_status():
+    t, index = player.current()
+    return jsonify({
+        "host": player.recording.header.get("host", ""),
+        "position_ms": t,
+        "frame": index,
+        "frames": len(player.recording.frames),
+        "duration_ms": player.recording.duration,
+        "speed": player.speed,
+        "loop": player.loop,
+    })
+
+
+@app.route('/replay/restart', methods=['POST'])
+def replay_restart():
+    player.start = time.monotonic()
+    return jsonify({"ok": True})
+
+
+@app.route('/', methods=['GET'])
+def home():
+    return f"""
+    <h1>System Monitor Replay</h1>
+    <p>{len(player.recording.frames)} frames from {player.recording.header.get("host", "?")},
+       speed x{player.speed}{", looping" if player.loop else ""}</p>
+    <p>API endpoint: <a href="/system-info">/system-info</a></p>
+    <p>Status: <a href="/replay/status">/replay/status</a></p>
+    """
+
+
+def main():
+    global player
+
+    parser = argparse.ArgumentParser(description="Serve a recorded /system-info stream")
+    parser.add_argument("recording", help="JSON Lines file written with RECORD_FILE")
+    parser.add_argument("--speed", type=float, default=1.0, help="Playback rate (2 = twice as fast)")
+    parser.add_argument("--loop", action="store_true", help="Start over at the end instead of holding the last frame")
+    parser.add_argument("--port", type=int, default=8080)
+    args = parser.parse_args()
+    if args.speed <= 0:
+        parser.error("--speed must be > 0")
+
+    recording = Recording(args.recording)
+    player = Player(recording, args.speed, args.loop)
+
+    print("=" * 50)
+    print("System Monitor Replay")
+    print("=" * 50)
+    print(f"Recording: {args.recording} ({len(recording.frames)} frames, "
+          f"{recording.duration / 1000:.1f}s, host {recording.header.get('host', '?')})")
+    print(f"Speed: x{args.speed}{' (loop)' if args.loop else ''}")
+    print(f"API: http://{get_local_ip()}:{args.port}/system-info")
+    print("=" * 50)
+
+    import logging
+    logging.getLogger('werkzeug').setLevel(logging.ERROR)
+
+    app.run(host='0.0.0.0', port=args.port, debug=False)
+
+
+if __name__ == '__main__':
+    main()
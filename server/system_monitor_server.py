@@ -6,12 +6,18 @@ Yêu cầu:
 - pip install flask requests python-dotenv
 """
 
-from flask import Flask, jsonify
+from flask import Flask, jsonify, request, send_from_directory
 import requests
 import socket
 import os
 import json
+import time
+import hashlib
+import re
+import sys
 from dotenv import load_dotenv
+from collectors import Collector, empty_result, pack_cores
+from layout_compiler import LayoutFile
 
 # Load cấu hình từ .env ở folder server
 load_dotenv()
@@ -34,15 +40,33 @@ def get_local_ip():
 DEBUG_MODE = os.getenv('DEBUG_MODE', 'false').lower() == 'true'
 SERVER_PORT = int(os.getenv('SERVER_PORT', '8080'))
 LIBRE_HW_MONITOR_PORT = int(os.getenv('LIBRE_HW_MONITOR_PORT', '8085'))
-MAX_DISKS = int(os.getenv('MAX_DISKS', '2'))
+MAX_DISKS = int(os.getenv('MAX_DISKS', '8'))
 PC_IP_ADDRESS = os.getenv('PC_IP_ADDRESS', '').strip()
 
 # Nếu không có IP trong .env, tự động phát hiện
 if not PC_IP_ADDRESS:
     PC_IP_ADDRESS = get_local_ip()
 
-# Libre Hardware Monitor server URL
-LIBRE_HW_MONITOR_URL = f"http://{PC_IP_ADDRESS}:{LIBRE_HW_MONITOR_PORT}/data.json"
+# mDNS: quảng bá _hwmon._tcp để ESP tự tìm lại bridge khi IP của PC đổi (cần `pip install zeroconf`)
+MDNS_ENABLED = os.getenv('MDNS_ENABLED', 'true').lower() == 'true'
+PC_IP_PINNED = bool(os.getenv('PC_IP_ADDRESS', '').strip())
+BRIDGE_NAME = socket.gethostname()[:20]
+
+# Nguồn dữ liệu: lhm (Libre Hardware Monitor), linux (/proc + /sys), auto = linux trên Linux khi không đặt LIBRE_HW_MONITOR_URL
+COLLECTOR = os.getenv('COLLECTOR', 'auto').strip().lower()
+SAMPLE_INTERVAL = int(os.getenv('SAMPLE_INTERVAL', '1000'))  # ms giữa 2 lần lấy mẫu (backend linux)
+
+# Ghi lại frame /system-info để replay (replay_server.py, tools/replay) - để trống = tắt
+RECORD_FILE = os.getenv('RECORD_FILE', '').strip()
+RECORD_INTERVAL = int(os.getenv('RECORD_INTERVAL', '1000'))  # ms giữa 2 frame
+
+# Layout dashboard (JSON, xem layout_compiler.py) - panel tự tải khi file đổi; để trống = layout của firmware
+LAYOUT_FILE = os.getenv('LAYOUT_FILE', '').strip()
+layout_file = LayoutFile(LAYOUT_FILE) if LAYOUT_FILE else None
+
+# Libre Hardware Monitor server URL (LIBRE_HW_MONITOR_URL ghi đè, vd. lhm_simulator.py trên Linux)
+LIBRE_HW_MONITOR_URL = os.getenv('LIBRE_HW_MONITOR_URL', '').strip() or \
+    f"http://{PC_IP_ADDRESS}:{LIBRE_HW_MONITOR_PORT}/data.json"
 
 # Hardware detection patterns
 CPU_KEYWORDS = ("Intel Core", "AMD Ryzen", "Intel Xeon", "AMD EPYC", "Intel Pentium", "Intel Celeron", "AMD Athlon")
@@ -84,21 +108,39 @@ def find_sensor_multi(sensors, sensor_type, keywords):
             return value
     return 0.0
 
-def get_system_info():
+# LHM: "CPU Core #3" / "CPU Core #3 Thread #2" (Load), "Core #3" / "CPU Core #3" (Clocks)
+CORE_LOAD_RE = re.compile(r"^CPU Core #(\d+)(?: Thread #(\d+))?$")
+CORE_CLOCK_RE = re.compile(r"^(?:CPU )?Core #(\d+)$")
+
+def find_core_sensors(sensors):
+    """Per logical CPU (load %, clock MHz) of one CPU node; threads when LHM lists them"""
+    loads, clocks = {}, {}
+    for group in sensors:
+        for item in group.get("Children", []):
+            text = item.get("Text", "")
+            if group.get("Text") == "Load":
+                m = CORE_LOAD_RE.match(text)
+                if m:
+                    loads[(int(m.group(1)), int(m.group(2) or 0))] = parse_value(item.get("Value", "0"))
+            elif group.get("Text") == "Clocks":
+                m = CORE_CLOCK_RE.match(text)
+                if m:
+                    clocks[int(m.group(1))] = parse_value(item.get("Value", "0"))
+    threads = sorted(k for k in loads if k[1])
+    keys = threads or sorted(loads)
+    return [loads[k] for k in keys], [clocks.get(k[0], 0) for k in keys]
+
+def nic_traffic(nic):
+    return nic["upload"] + nic["download"]
+
+def get_lhm_system_info():
     """Get SYSTEM Statistics from Libre Hardware Monitor"""
     try:
         response = requests.get(LIBRE_HW_MONITOR_URL, timeout=5)
         data = response.json()
         
         # Khởi tạo result với thứ tự cố định (Python 3.7+ dict giữ insertion order)
-        result = {
-            "cpu": {"name": "", "temp": 0, "load": 0, "power": 0},
-            "ram": {"used": 0, "total": 0, "percent": 0},
-            "gpu_discrete": {"name": "", "temp": 0, "load": 0, "power": 0, "mem_used": 0, "mem_total": 0},
-            "gpu_integrated": {"name": "", "temp": 0, "load": 0},
-            "disk": [],
-            "network": {"name": "", "upload": 0, "download": 0}
-        }
+        result = empty_result(socket.gethostname())
         
         # Duyệt qua tất cả hardware
         # Cấu trúc: root -> Children[0] (Computer) -> Children[] (các thiết bị)
@@ -112,8 +154,9 @@ def get_system_info():
         debug_print(f"\n[INFO] Detected {len(hardware_list)} hardware devices:")
         
         
+        core_loads, core_clocks = [], []   # Mọi CPU (nhiều socket nối tiếp nhau)
         detected_hardware = {"cpu": False, "ram": False, "gpu_discrete": False, 
-                            "gpu_integrated": False, "disk": 0, "network": False}
+                            "gpu_integrated": False, "disk": 0, "network": 0}
         
         for hw in hardware_list:
             debug_print(f"  - {hw.get('Text', 'Unknown')}")
@@ -128,6 +171,9 @@ def get_system_info():
                 result["cpu"]["temp"] = find_sensor_multi(sensors, "Temperatures", ("Tctl", "Package", "Core"))
                 result["cpu"]["load"] = find_sensor(sensors, "Load", "CPU Total")
                 result["cpu"]["power"] = find_sensor(sensors, "Powers", "Package")
+                loads, clocks = find_core_sensors(sensors)
+                core_loads += loads
+                core_clocks += clocks
             
             # RAM - Phát hiện linh hoạt
             elif any(kw in hw_name for kw in RAM_KEYWORDS):
@@ -165,13 +211,19 @@ def get_system_info():
             
             # Network - Phát hiện linh hoạt
             elif any(kw in hw_name for kw in NETWORK_KEYWORDS) or "nic.png" in hw_type:
-                download = find_sensor(sensors, "Throughput", "Download Speed")
-                upload = find_sensor(sensors, "Throughput", "Upload Speed")
-                if download > 0 or upload > 0:
-                    detected_hardware["network"] = True
-                    result["network"]["name"] = hw_name[:30]
-                    result["network"]["download"] = download
-                    result["network"]["upload"] = upload
+                detected_hardware["network"] += 1
+                result["networks"].append({
+                    "name": hw_name[:30],
+                    "upload": find_sensor(sensors, "Throughput", "Upload Speed"),
+                    "download": find_sensor(sensors, "Throughput", "Download Speed")
+                })
+        
+        result["cores"] = pack_cores(core_loads, core_clocks)
+        
+        # "network" = NIC bận nhất (giữ cho firmware cũ)
+        busiest = max(result["networks"], key=nic_traffic, default=None)
+        if busiest and nic_traffic(busiest) > 0:
+            result["network"] = dict(busiest)
         
         # Giới hạn số disk (cấu hình trong .env)
         result["disk"] = result["disk"][:MAX_DISKS]
@@ -184,7 +236,7 @@ def get_system_info():
                 f"GPU rời: {'✓' if detected_hardware['gpu_discrete'] else '✗'}",
                 f"iGPU: {'✓' if detected_hardware['gpu_integrated'] else '✗'}",
                 f"Disk: {detected_hardware['disk']} thiết bị",
-                f"Network: {'✓' if detected_hardware['network'] else '✗'}"
+                f"Network: {detected_hardware['network']} NIC"
             ]
             print("\n[Statistics]\n  " + "\n  ".join(stats) + "\n")
         
@@ -197,12 +249,194 @@ def get_system_info():
         print(f"Lỗi xử lý: {str(e)}")
         return {"error": str(e), "message": "Lỗi khi xử lý dữ liệu!"}
 
+class LhmCollector(Collector):
+    """Query Libre Hardware Monitor on every request (LHM does its own sampling)"""
+    name = "lhm"
+
+    def collect(self):
+        return get_lhm_system_info()
+
+collector = None
+
+def get_collector():
+    """Backend chosen by COLLECTOR, started on first use"""
+    global collector
+    if collector is None:
+        kind = COLLECTOR
+        if kind == 'auto':
+            use_linux = sys.platform.startswith('linux') and not os.getenv('LIBRE_HW_MONITOR_URL', '').strip()
+            kind = 'linux' if use_linux else 'lhm'
+        if kind == 'linux':
+            from linux_collector import LinuxCollector
+            collector = LinuxCollector(BRIDGE_NAME, SAMPLE_INTERVAL, MAX_DISKS)
+        else:
+            collector = LhmCollector()
+        collector.start()
+    return collector
+
+def get_system_info():
+    """Current metrics from the active collector (same schema for every backend)"""
+    return get_collector().collect()
+
+# Fixed-point output (?fixed=1): các metric nhân 10 và làm tròn thành int
+# ESP8266 không có FPU - firmware đọc thẳng số nguyên, không cần soft-float
+FIXED_SCALE = 10
+FIXED_FIELDS = {
+    "cpu": ("temp", "load", "power"),
+    "ram": ("used", "total", "percent"),
+    "gpu_discrete": ("temp", "load", "power"),
+    "gpu_integrated": ("temp", "load"),
+    "network": ("upload", "download"),
+}
+FIXED_DISK_FIELDS = ("temp", "load")
+
+def to_fixed(data):
+    """Convert metric floats to integers scaled by FIXED_SCALE"""
+    if "error" in data:
+        return data
+    for section, fields in FIXED_FIELDS.items():
+        for field in fields:
+            if section in data and field in data[section]:
+                data[section][field] = int(round(data[section][field] * FIXED_SCALE))
+    for disk in data.get("disk", []):
+        for field in FIXED_DISK_FIELDS:
+            if field in disk:
+                disk[field] = int(round(disk[field] * FIXED_SCALE))
+    for nic in data.get("networks", []):
+        for field in FIXED_FIELDS["network"]:
+            if field in nic:
+                nic[field] = int(round(nic[field] * FIXED_SCALE))
+    data["fixed"] = FIXED_SCALE
+    return data
+
+def query_limit(name):
+    """?disks=N / ?nics=N from the device (None = no limit)"""
+    try:
+        return max(0, int(request.args.get(name, '')))
+    except ValueError:
+        return None
+
+def apply_limits(data, disks=None, nics=None, cores=None):
+    """Trim lists to what the device can hold (it sends its DISK_MAX / NIC_MAX / CORE_MAX)"""
+    if "error" in data:
+        return data
+    if disks is not None:
+        data["disk"] = data.get("disk", [])[:disks]
+    networks = data.get("networks", [])
+    if nics is not None and len(networks) > nics:
+        # Keep the busiest NICs, in their original order (stable tile pages)
+        keep = sorted(range(len(networks)), key=lambda i: nic_traffic(networks[i]), reverse=True)[:nics]
+        data["networks"] = [networks[i] for i in sorted(keep)]
+    if cores is not None and "cores" in data:
+        data["cores"] = {key: packed[:2 * cores] for key, packed in data["cores"].items()}
+    return data
+
 @app.route('/system-info', methods=['GET'])
 def system_info():
     """API endpoint trả về thông tin hệ thống"""
-    data = get_system_info()
+    data = apply_limits(get_system_info(), query_limit('disks'), query_limit('nics'), query_limit('cores'))
+    if request.args.get('fixed') == '1':
+        data = to_fixed(data)
+    if layout_file:
+        _, layout_id = layout_file.get()
+        if layout_id:
+            data["layout"] = layout_id  # Panel fetches /layout when this differs from its own
     return jsonify(data)
 
+@app.route('/layout', methods=['GET'])
+def layout():
+    """Compiled LAYOUT_FILE descriptor (binary) for the panel"""
+    descriptor = layout_file.get()[0] if layout_file else None
+    if descriptor is None:
+        return "No layout\n", 404
+    return descriptor, 200, {"Content-Type": "application/octet-stream"}
+
+# ===== Firmware update channel =====
+# server/firmware/manifest.json + binaries, written by publish_firmware.py
+FIRMWARE_DIR = os.getenv('FIRMWARE_DIR', os.path.join(os.path.dirname(os.path.abspath(__file__)), 'firmware'))
+FIRMWARE_MANIFEST = os.path.join(FIRMWARE_DIR, 'manifest.json')
+FIRMWARE_DEVICES = os.path.join(FIRMWARE_DIR, 'devices.json')
+
+def load_json(path, default):
+    try:
+        with open(path, 'r', encoding='utf-8') as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return default
+
+devices = load_json(FIRMWARE_DEVICES, {})
+
+def record_device(device_id, **fields):
+    """Lưu version/trạng thái mới nhất của từng thiết bị"""
+    entry = devices.setdefault(device_id, {})
+    entry.update({k: v for k, v in fields.items() if v is not None})
+    entry["last_seen"] = int(time.time())
+    entry["ip"] = request.remote_addr
+    os.makedirs(FIRMWARE_DIR, exist_ok=True)
+    with open(FIRMWARE_DEVICES, 'w', encoding='utf-8') as f:
+        json.dump(devices, f, indent=2)
+
+def rollout_bucket(device_id):
+    """Bucket 0-99 cố định cho mỗi device (staged rollout)"""
+    return int(hashlib.sha256(device_id.encode()).hexdigest()[:8], 16) % 100
+
+def in_rollout(manifest, device_id):
+    allow = manifest.get("devices")
+    if allow:
+        return device_id in allow
+    return rollout_bucket(device_id) < int(manifest.get("rollout", 100))
+
+@app.route('/firmware/manifest', methods=['GET'])
+def firmware_manifest():
+    """Device hỏi firmware mới (kèm device ID + version đang chạy)"""
+    device_id = request.args.get('device', '')
+    version = request.args.get('version', '')
+    if device_id:
+        record_device(device_id, version=version)
+
+    manifest = load_json(FIRMWARE_MANIFEST, None)
+    if not manifest or not device_id:
+        return jsonify({"update": False})
+
+    update = manifest["version"] != version and in_rollout(manifest, device_id)
+    debug_print(f"[FW] {device_id} v{version} -> v{manifest['version']}: {'update' if update else 'skip'}")
+    if not update:
+        return jsonify({"update": False, "version": manifest["version"]})
+
+    return jsonify({
+        "update": True,
+        "version": manifest["version"],
+        "url": f"/firmware/files/{manifest['file']}",
+        "size": manifest["size"],
+        "sha256": manifest["sha256"],
+        "raw_size": manifest.get("raw_size", 0),  # > size for .bin.gz images
+    })
+
+@app.route('/firmware/files/<path:name>', methods=['GET'])
+def firmware_file(name):
+    """Binary firmware (hỗ trợ Range để device resume)"""
+    return send_from_directory(FIRMWARE_DIR, name, mimetype='application/octet-stream', conditional=True)
+
+@app.route('/firmware/report', methods=['POST'])
+def firmware_report():
+    """Device báo trạng thái: downloading / verified / failed"""
+    device_id = request.args.get('device', '')
+    if not device_id:
+        return jsonify({"ok": False}), 400
+    record_device(device_id,
+                  version=request.args.get('version'),
+                  target=request.args.get('target'),
+                  status=request.args.get('status'),
+                  detail=request.args.get('detail'))
+    print(f"[FW] {device_id}: {request.args.get('status')} v{request.args.get('target')} {request.args.get('detail', '')}")
+    return jsonify({"ok": True})
+
+@app.route('/firmware/devices', methods=['GET'])
+def firmware_devices():
+    """Version + trạng thái update của từng thiết bị"""
+    manifest = load_json(FIRMWARE_MANIFEST, {})
+    return jsonify({"manifest": manifest, "devices": devices})
+
 @app.route('/test', methods=['GET'])
 def test():
     """Test endpoint - hiển thị JSON với thứ tự chính xác (không bị Chrome sort)"""
@@ -211,6 +445,76 @@ def test():
     json_str = json.dumps(data, indent=2, ensure_ascii=False)
     return Response(json_str, mimetype='text/plain')
 
+def start_mdns_advertiser():
+    """Advertise BRIDGE_NAME._hwmon._tcp.local and follow DHCP address changes"""
+    try:
+        from zeroconf import Zeroconf, ServiceInfo
+    except ImportError:
+        print("[mDNS] zeroconf not installed - auto-discovery disabled (pip install zeroconf)")
+        return
+
+    import threading
+
+    def make_info(ip):
+        return ServiceInfo(
+            "_hwmon._tcp.local.",
+            f"{BRIDGE_NAME}._hwmon._tcp.local.",
+            addresses=[socket.inet_aton(ip)],
+            port=SERVER_PORT,
+            properties={"host": BRIDGE_NAME, "path": "/system-info"},
+            server=f"{BRIDGE_NAME}.local.",
+        )
+
+    zc = Zeroconf()
+    state = {"ip": PC_IP_ADDRESS, "info": make_info(PC_IP_ADDRESS)}
+    zc.register_service(state["info"])
+    print(f"[mDNS] Advertising {BRIDGE_NAME}._hwmon._tcp on {PC_IP_ADDRESS}:{SERVER_PORT}")
+
+    def watch_ip():
+        # DHCP đổi IP -> cập nhật bản ghi A để ESP resolve ra IP mới
+        while True:
+            time.sleep(30)
+            ip = get_local_ip()
+            if ip != state["ip"] and ip != "127.0.0.1":
+                print(f"[mDNS] IP changed {state['ip']} -> {ip}")
+                state["ip"], state["info"] = ip, make_info(ip)
+                zc.update_service(state["info"])
+
+    if not PC_IP_PINNED:
+        threading.Thread(target=watch_ip, daemon=True).start()
+
+# ===== Recorder =====
+# JSON Lines: dòng đầu là header, mỗi dòng sau là 1 frame {"t": ms từ lúc bắt đầu, "d": /system-info}
+# Frame giữ nguyên dạng float (chưa to_fixed) nên replay phục vụ được cả ?fixed=1
+RECORDING_VERSION = 1
+
+def start_recorder(path, interval_ms):
+    """Sample get_system_info() at a fixed cadence into path (overwritten)"""
+    import threading
+
+    def record():
+        compact = (',', ':')
+        start = time.monotonic()
+        frames = 0
+        with open(path, 'w', encoding='utf-8') as f:
+            f.write(json.dumps({"hwmon_rec": RECORDING_VERSION, "host": BRIDGE_NAME,
+                                "start": int(time.time()), "interval": interval_ms},
+                               separators=compact) + "\n")
+            while True:
+                t = int((time.monotonic() - start) * 1000)
+                f.write(json.dumps({"t": t, "d": get_system_info()},
+                                   separators=compact, ensure_ascii=False) + "\n")
+                f.flush()
+                frames += 1
+                if frames % 60 == 0:
+                    debug_print(f"[REC] {frames} frames -> {path}")
+                # Next slot on the original grid (a slow LHM reply doesn't shift later frames)
+                next_t = (t // interval_ms + 1) * interval_ms / 1000
+                time.sleep(max(0, next_t - (time.monotonic() - start)))
+
+    threading.Thread(target=record, daemon=True).start()
+    print(f"[REC] Recording /system-info every {interval_ms}ms -> {path}")
+
 @app.route('/', methods=['GET'])
 def home():
     """Trang chủ"""
@@ -220,6 +524,7 @@ def home():
     <p>Server IP: <strong>{PC_IP_ADDRESS}:{SERVER_PORT}</strong></p>
     <p>API endpoint: <a href="/system-info">/system-info</a> (JSON - Chrome có thể sort keys)</p>
     <p>Test endpoint: <a href="/test">/test</a> (Plain text - thứ tự chính xác)</p>
+    <p>Firmware rollout: <a href="/firmware/devices">/firmware/devices</a></p>
     <p>Libre HW Monitor: <a href="http://{PC_IP_ADDRESS}:{LIBRE_HW_MONITOR_PORT}" target="_blank">
        http://{PC_IP_ADDRESS}:{LIBRE_HW_MONITOR_PORT}</a></p>
     """
@@ -230,16 +535,25 @@ if __name__ == '__main__':
     print("="*50)
     print(f"Server: http://{PC_IP_ADDRESS}:{SERVER_PORT}")
     print(f"API: http://{PC_IP_ADDRESS}:{SERVER_PORT}/system-info")
-    print(f"Libre HW Monitor: http://{PC_IP_ADDRESS}:{LIBRE_HW_MONITOR_PORT}")
+    print(f"Collector: {get_collector().name}")
+    if get_collector().name == "lhm":
+        print(f"Libre HW Monitor: {LIBRE_HW_MONITOR_URL}")
     print(f"Debug Mode: {'ON' if DEBUG_MODE else 'OFF'}")
     print(f"Max Disks: {MAX_DISKS}")
     print("="*50)
-    print("\nMake sure Libre Hardware Monitor is running!")
+    if get_collector().name == "lhm":
+        print("\nMake sure Libre Hardware Monitor is running!")
     print("ESP8266:")
     print(f'  SERVER_IP = "{PC_IP_ADDRESS}"\n  SERVER_PORT = "{SERVER_PORT}"')
     print("="*50)
     print("\nTip: Edit server/.env để to change settings\n")
     
+    if MDNS_ENABLED:
+        start_mdns_advertiser()
+    
+    if RECORD_FILE:
+        start_recorder(RECORD_FILE, max(100, RECORD_INTERVAL))
+    
     # Tắt Werkzeug logging (HTTP request logs)
     import logging
     log = logging.getLogger('werkzeug')
@@ -0,0 +1,92 @@
+/*
+ * Adaptive Refresh Scheduler Implementation
+ */
+
+#include "config.h"
+#include "adaptive_refresh.h"
+
+AdaptiveRefresh::AdaptiveRefresh(uint16_t minMs, uint16_t maxMs)
+  : minInterval(minMs), maxInterval(maxMs), interval(maxMs),
+    hasPrev(false), prevCpuLoad(0), prevGpuLoad(0), prevRamPercent(0),
+    prevCpuTemp(0), prevNet(0), lastScore(0), polls(0), startMs(0) {}
+
+void AdaptiveRefresh::setBounds(uint16_t minMs, uint16_t maxMs) {
+  if (minMs == 0 || maxMs < minMs) return;  // Ignore invalid bounds
+  
+  minInterval = minMs;
+  maxInterval = maxMs;
+  if (interval < minInterval) interval = minInterval;
+  if (interval > maxInterval) interval = maxInterval;
+}
+
+void AdaptiveRefresh::reset(unsigned long nowMs) {
+  hasPrev = false;
+  lastScore = 0;
+  polls = 0;
+  startMs = nowMs;
+  interval = maxInterval;
+}
+
+fixed10_t AdaptiveRefresh::term(fixed10_t now, fixed10_t prev) {
+  fixed10_t d = now - prev;
+  if (d < 0) d = -d;
+  return (d > TERM_CAP) ? TERM_CAP : d;
+}
+
+fixed10_t AdaptiveRefresh::score(const SystemData& data) const {
+  fixed10_t ramPercent = Fixed10::percent(data.ramUsed, data.ramTotal);
+  
+  return term(data.cpuLoad, prevCpuLoad) +
+         term(data.gpuLoad, prevGpuLoad) +
+         term(ramPercent, prevRamPercent) +
+         term(data.cpuTemp, prevCpuTemp) +
+         term(data.netTotal(), prevNet);  // 1 Mb/s ~ 1 point
+}
+
+void AdaptiveRefresh::remember(const SystemData& data) {
+  prevCpuLoad = data.cpuLoad;
+  prevGpuLoad = data.gpuLoad;
+  prevRamPercent = Fixed10::percent(data.ramUsed, data.ramTotal);
+  prevCpuTemp = data.cpuTemp;
+  prevNet = data.netTotal();
+  hasPrev = true;
+}
+
+uint16_t AdaptiveRefresh::update(const SystemData& data, unsigned long nowMs) {
+  if (polls == 0) startMs = nowMs;
+  polls++;
+  
+  if (hasPrev) {
+    lastScore = score(data);
+    
+    if (lastScore >= FAST_THRESHOLD) {
+      // Moving: halve the interval (reach the floor within a few polls)
+      interval = interval / 2;
+    } else if (lastScore <= SLOW_THRESHOLD) {
+      // Static: back off gently (+25%, at least 100ms)
+      uint16_t step = interval / 4;
+      if (step < 100) step = 100;
+      uint32_t next = (uint32_t)interval + step;
+      interval = (next > maxInterval) ? maxInterval : next;
+    }
+    
+    if (interval < minInterval) interval = minInterval;
+    if (interval > maxInterval) interval = maxInterval;
+  }
+  
+  remember(data);
+  
+  #ifdef DEBUG_NETWORK
+  DEBUG_PRINTF("[ADAPT] score=%d interval=%ums\n", (int)lastScore, interval);
+  #endif
+  
+  return interval;
+}
+
+fixed10_t AdaptiveRefresh::getPollsPerMinute(unsigned long nowMs) const {
+  unsigned long elapsed = nowMs - startMs;
+  if (polls < 2 || elapsed == 0) return 0;
+  
+  // (polls - 1) intervals over elapsed ms, scaled to minutes, x10
+  return (fixed10_t)(((uint64_t)(polls - 1) * 60000UL * FIXED10_SCALE) / elapsed);
+}
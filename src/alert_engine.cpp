@@ -0,0 +1,100 @@
+/*
+ * Alert Engine Implementation
+ */
+
+#include "config.h"
+#include "alert_engine.h"
+
+static const char* const METRIC_NAMES[ALERT_METRIC_COUNT] = {
+  "cpu_temp", "cpu_load", "gpu_temp", "gpu_load", "ram_load", "disk_temp", "net_total"
+};
+
+AlertEngine::AlertEngine()
+  : rules(), state(), ruleCount(0), activeActions(0), raisedActions(0), highlightMask(0) {}
+
+void AlertEngine::setRules(const AlertRule* source, uint8_t count) {
+  // Keep slot numbering so /alerts and the metrics can refer to rules by slot
+  ruleCount = count < ALERT_RULE_MAX ? count : ALERT_RULE_MAX;
+  for (uint8_t i = 0; i < ruleCount; i++) {
+    rules[i] = source[i];
+    state[i] = RuleState();
+  }
+  activeActions = raisedActions = 0;
+  highlightMask = 0;
+}
+
+bool AlertEngine::update(const SystemData& data, unsigned long now) {
+  bool changed = false;
+  activeActions = raisedActions = 0;
+  highlightMask = 0;
+
+  for (uint8_t i = 0; i < ruleCount; i++) {
+    const AlertRule& rule = rules[i];
+    RuleState& s = state[i];
+    if (!isEnabled(i)) continue;
+    fixed10_t value = metricValue(data, rule.metric);
+    bool low = rule.clearAt > rule.raiseAt;  // Low alarm: trips going down
+
+    if (s.active) {
+      // Hysteresis: stay active until the value is strictly past clearAt, so a
+      // reading sitting on raise == clear does not trip and clear in turn
+      if (low ? value > rule.clearAt : value < rule.clearAt) {
+        s.active = false;
+        changed = true;
+      }
+    } else if (low ? value <= rule.raiseAt : value >= rule.raiseAt) {
+      if (!s.pending) {
+        s.pending = true;
+        s.since = now;
+      }
+      if (now - s.since >= rule.sustainS * 1000UL) {
+        s.active = true;
+        s.pending = false;
+        raisedActions |= rule.actions;
+        changed = true;
+      }
+    } else {
+      s.pending = false;  // Dipped back before the sustain time
+    }
+
+    if (s.active) {
+      activeActions |= rule.actions;
+      if (rule.actions & ALERT_HIGHLIGHT) highlightMask |= 1 << rule.metric;
+    }
+  }
+  return changed;
+}
+
+bool AlertEngine::isEnabled(uint8_t i) const {
+  return rules[i].actions != 0 && rules[i].metric < ALERT_METRIC_COUNT;
+}
+
+fixed10_t AlertEngine::metricValue(const SystemData& data, uint8_t metric) {
+  switch (metric) {
+    case ALERT_CPU_TEMP: return data.cpuTemp;
+    case ALERT_CPU_LOAD: return data.cpuLoad;
+    case ALERT_GPU_TEMP: return data.gpuTemp;
+    case ALERT_GPU_LOAD: return data.gpuLoad;
+    case ALERT_RAM_LOAD: return Fixed10::percent(data.ramUsed, data.ramTotal);
+    case ALERT_DISK_TEMP: {
+      fixed10_t hottest = 0;
+      for (uint8_t i = 0; i < data.diskCount; i++) {
+        if (data.disks[i].temp > hottest) hottest = data.disks[i].temp;
+      }
+      return hottest;
+    }
+    case ALERT_NET_TOTAL: return data.netTotal();
+    default: return 0;
+  }
+}
+
+const char* AlertEngine::metricName(uint8_t metric) {
+  return metric < ALERT_METRIC_COUNT ? METRIC_NAMES[metric] : "?";
+}
+
+int8_t AlertEngine::metricFromName(const char* name) {
+  for (uint8_t i = 0; i < ALERT_METRIC_COUNT; i++) {
+    if (strcmp(name, METRIC_NAMES[i]) == 0) return i;
+  }
+  return -1;
+}
@@ -0,0 +1,119 @@
+/*
+ * Backlight Manager Implementation
+ */
+
+#include "config.h"
+#include "backlight_manager.h"
+
+BacklightManager::BacklightManager(uint8_t ledPin)
+  : pin(ledPin), fullLevel(DEFAULT_FULL), dimLevel(DEFAULT_DIM), state(BACKLIGHT_FULL), pulsing(false),
+    current(0), fadeFrom(0), fadeTarget(0), fadeStart(0), lastActivity(0) {}
+
+void BacklightManager::begin() {
+  pinMode(pin, OUTPUT);
+  analogWriteRange(255);
+  
+  // Boot at full brightness immediately (splash screen)
+  current = fadeFrom = fadeTarget = fullLevel;
+  write(current);
+  state = BACKLIGHT_FULL;
+  lastActivity = millis();
+}
+
+void BacklightManager::write(uint8_t level) {
+  // analogWrite(0/255) leaves PWM running - use plain GPIO at the extremes
+  if (level == 0) {
+    digitalWrite(pin, LOW);
+  } else if (level == 255) {
+    digitalWrite(pin, HIGH);
+  } else {
+    analogWrite(pin, level);
+  }
+}
+
+void BacklightManager::fadeTo(uint8_t level) {
+  fadeFrom = current;
+  fadeTarget = level;
+  fadeStart = millis();
+}
+
+void BacklightManager::enterState(BacklightState newState) {
+  state = newState;
+  
+  switch (state) {
+    case BACKLIGHT_FULL: fadeTo(fullLevel); break;
+    case BACKLIGHT_DIM:  fadeTo(dimLevel);  break;
+    case BACKLIGHT_OFF:  fadeTo(0);         break;
+  }
+  
+  DEBUG_PRINT(F("[DISP] Backlight: "));
+  DEBUG_PRINTLN(state == BACKLIGHT_FULL ? F("full") : state == BACKLIGHT_DIM ? F("dim") : F("off"));
+}
+
+void BacklightManager::update() {
+  unsigned long now = millis();
+  
+  // Alert pulse: counts as activity, next swing once the last fade landed
+  if (pulsing) {
+    lastActivity = now;
+    if (state != BACKLIGHT_FULL) enterState(BACKLIGHT_FULL);
+    if (current == fadeTarget) fadeTo(fadeTarget == fullLevel ? fullLevel / 4 : fullLevel);
+  }
+  
+  // Idle timeline
+  unsigned long idle = now - lastActivity;
+  if (state == BACKLIGHT_FULL && BACKLIGHT_DIM_TIMEOUT > 0 && idle >= BACKLIGHT_DIM_TIMEOUT) {
+    enterState(BACKLIGHT_DIM);
+  }
+  if (state != BACKLIGHT_OFF && BACKLIGHT_TIMEOUT > 0 && idle >= BACKLIGHT_TIMEOUT) {
+    enterState(BACKLIGHT_OFF);
+  }
+  
+  // Linear fade
+  if (current != fadeTarget) {
+    unsigned long elapsed = now - fadeStart;
+    uint8_t next;
+    if (elapsed >= BACKLIGHT_FADE_MS) {
+      next = fadeTarget;
+    } else {
+      int16_t delta = (int16_t)fadeTarget - fadeFrom;
+      next = fadeFrom + (int16_t)((delta * (int32_t)elapsed) / BACKLIGHT_FADE_MS);
+    }
+    if (next != current) {
+      current = next;
+      write(current);
+    }
+  }
+}
+
+bool BacklightManager::noteActivity() {
+  lastActivity = millis();
+  bool wasOff = (state == BACKLIGHT_OFF);
+  if (state != BACKLIGHT_FULL) {
+    enterState(BACKLIGHT_FULL);
+  }
+  return wasOff;
+}
+
+void BacklightManager::wake() {
+  noteActivity();
+}
+
+void BacklightManager::sleep() {
+  enterState(BACKLIGHT_OFF);
+}
+
+void BacklightManager::setPulse(bool on) {
+  if (on == pulsing) return;
+  pulsing = on;
+  if (!on && state == BACKLIGHT_FULL) fadeTo(fullLevel);  // Settle back
+}
+
+void BacklightManager::setLevels(uint8_t full, uint8_t dim) {
+  fullLevel = full ? full : DEFAULT_FULL;
+  dimLevel = (dim && dim < fullLevel) ? dim : fullLevel / 4;
+  
+  // Apply immediately to the current stage
+  if (state == BACKLIGHT_FULL) fadeTo(fullLevel);
+  else if (state == BACKLIGHT_DIM) fadeTo(dimLevel);
+}
@@ -0,0 +1,153 @@
+/*
+ * Bridge Discovery Implementation
+ */
+
+#include "config.h"
+#include "bridge_discovery.h"
+#include "metrics.h"
+#include <EEPROM.h>
+#include <ESP8266WiFi.h>
+
+static_assert(DISCOVERY_EEPROM_OFFSET + sizeof(BridgeCacheData) <= 200, "Discovery cache overlaps UserSettings");
+
+BridgeDiscovery::BridgeDiscovery()
+  : hostname("esp8266"), query(nullptr), queryStartedAt(0), lastQuery(0),
+    found(false), foundPort(0) {
+  memset(&cache, 0, sizeof(cache));
+}
+
+uint8_t BridgeDiscovery::checksum(const BridgeCacheData& data) {
+  uint8_t sum = 0;
+  const uint8_t* bytes = (const uint8_t*)&data;
+  for (size_t i = 0; i < offsetof(BridgeCacheData, checksum); i++) {
+    sum ^= bytes[i];
+  }
+  return sum;
+}
+
+void BridgeDiscovery::begin(const char* deviceName) {
+  hostname = deviceName;
+
+  EEPROM.get(DISCOVERY_EEPROM_OFFSET, cache);
+  if (cache.magic != DISCOVERY_MAGIC || cache.checksum != checksum(cache)) {
+    memset(&cache, 0, sizeof(cache));
+  }
+  cache.name[sizeof(cache.name) - 1] = '\0';
+
+  DEBUG_PRINTF("[DISC] Following bridge: %s\n", cache.name[0] ? cache.name : "(any)");
+}
+
+void BridgeDiscovery::rememberBridge(const String& name) {
+  if (name.length() == 0 || strncmp(name.c_str(), cache.name, sizeof(cache.name) - 1) == 0) return;
+
+  cache.magic = DISCOVERY_MAGIC;
+  memset(cache.name, 0, sizeof(cache.name));
+  strncpy(cache.name, name.c_str(), sizeof(cache.name) - 1);
+  cache.checksum = checksum(cache);
+  EEPROM.put(DISCOVERY_EEPROM_OFFSET, cache);
+  EEPROM.commit();
+  Metrics::recordFlashWrite();
+
+  DEBUG_PRINTF("[DISC] Now following bridge: %s\n", cache.name);
+}
+
+bool BridgeDiscovery::startQuery() {
+  #if DISCOVERY_ENABLED
+  if (query) return true;
+  if (WiFi.status() != WL_CONNECTED) return false;
+
+  // ArduinoOTA may already have started the responder
+  if (!MDNS.isRunning() && !MDNS.begin(hostname)) {
+    DEBUG_PRINTLN(F("[DISC] mDNS start failed"));
+    return false;
+  }
+
+  found = false;
+  query = MDNS.installServiceQuery("hwmon", "tcp",
+    [this](const MDNSResponder::MDNSServiceInfo& info, MDNSResponder::AnswerType, bool set) {
+      if (set) onAnswer(info);
+    });
+  queryStartedAt = millis();
+  lastQuery = queryStartedAt;
+
+  DEBUG_PRINTLN(query ? F("[DISC] Looking for _hwmon._tcp") : F("[DISC] Query failed"));
+  return query != nullptr;
+  #else
+  return false;
+  #endif
+}
+
+void BridgeDiscovery::stopQuery() {
+  if (query) {
+    MDNS.removeServiceQuery(query);
+    query = nullptr;
+  }
+}
+
+void BridgeDiscovery::request() {
+  if (query || found) return;
+  if (lastQuery != 0 && millis() - lastQuery < REQUERY_INTERVAL) return;
+  startQuery();
+}
+
+// The bridge advertises its hostname as the instance name and in TXT "host"
+bool BridgeDiscovery::matches(const MDNSResponder::MDNSServiceInfo& info) const {
+  if (!cache.name[0]) return true;
+
+  if (info.txtAvailable()) {
+    const char* host = info.value("host");
+    if (host && strcmp(host, cache.name) == 0) return true;
+  }
+
+  const char* domain = info.serviceDomain();
+  size_t len = strlen(cache.name);
+  return domain && strncmp(domain, cache.name, len) == 0 && domain[len] == '.';
+}
+
+// Called from MDNS.update() as answer parts (PTR/SRV/TXT/A) arrive
+void BridgeDiscovery::onAnswer(const MDNSResponder::MDNSServiceInfo& info) {
+  if (found || !info.IP4AddressAvailable() || !info.hostPortAvailable() || !matches(info)) return;
+
+  std::vector<IPAddress> addresses = info.IP4Adresses();
+  if (addresses.empty()) return;
+
+  foundIP = addresses[0];
+  foundPort = info.hostPort();
+  found = true;
+  DEBUG_PRINTF("[DISC] Found %s at %s:%u\n", info.serviceDomain(),
+               foundIP.toString().c_str(), foundPort);
+}
+
+void BridgeDiscovery::handle() {
+  if (!query) return;
+
+  MDNS.update();
+
+  if (found) {
+    stopQuery();
+  } else if (millis() - queryStartedAt >= QUERY_TIMEOUT) {
+    DEBUG_PRINTLN(F("[DISC] No bridge answered"));
+    stopQuery();
+  }
+}
+
+bool BridgeDiscovery::takeResult(IPAddress& ip, uint16_t& port) {
+  if (!found) return false;
+  found = false;
+  ip = foundIP;
+  port = foundPort;
+  return true;
+}
+
+bool BridgeDiscovery::resolve(IPAddress& ip, uint16_t& port, unsigned long timeoutMs) {
+  lastQuery = 0;  // Not rate-limited
+  if (!startQuery()) return false;
+
+  unsigned long start = millis();
+  while (!found && millis() - start < timeoutMs) {
+    MDNS.update();
+    delay(10);
+  }
+  stopQuery();
+  return takeResult(ip, port);
+}
@@ -7,6 +7,8 @@
 #include "config_validator.h"
 #include "display_manager.h"
 #include "button_handler.h"
+#include "host_poller.h"
+#include "bridge_discovery.h"
 
 // ESP8266 WiFi credentials struct
 extern "C" {
@@ -16,10 +18,10 @@ extern "C" {
 ConfigManager::ConfigManager(const char* apName, const char* apPass)
   : wifiManager(nullptr), server(nullptr), configMode(false), 
     apSSID(apName), apPassword(apPass),
-    tempServerPort(8080), tempWiFiSSID(""), tempWiFiPassword(""),
-    connectionFailCount(0), serverFailCount(0),
-    lastConnectionAttempt(0), lastServerCheck(0), 
-    displayManager(nullptr), buttonHandler(nullptr) {
+    tempServerPort(8080), serverSubmitted(false), tempWiFiSSID(""), tempWiFiPassword(""),
+    connectionFailCount(0), lastConnectionAttempt(0),
+    recoveryAP(false), recoveryChanged(false), 
+    displayManager(nullptr), discovery(nullptr), buttonHandler(nullptr) {
   storage.clear(config);
 }
 
@@ -72,7 +74,17 @@ bool ConfigManager::hasValidConfig() {
 }
 
 String ConfigManager::getServerURL() {
-  return String("http://") + config.serverIP + ":" + config.serverPort + "/system-info";
+  return String("http://") + config.serverIP + ":" + config.serverPort + "/system-info?fixed=1";
+}
+
+bool ConfigManager::updateServerAddress(const char* ip, uint16_t port) {
+  if (strcmp(config.serverIP, ip) == 0 && config.serverPort == port) return false;
+  
+  DEBUG_PRINTF("[CFG] Bridge moved: %s:%u -> %s:%u\n", config.serverIP, config.serverPort, ip, port);
+  setServerIP(ip);
+  setServerPort(port);
+  saveConfig();
+  return true;
 }
 
 void ConfigManager::setServerIP(const char* ip) {
@@ -117,7 +129,7 @@ bool ConfigManager::shouldFallbackToConfig() {
   // WiFi connected - reset WiFi counter and return
   if (WiFi.status() == WL_CONNECTED) {
     connectionFailCount = 0;
-    // Note: serverFailCount is managed separately by reportServerFailure()
+    // Server outages are handled by RecoveryPolicy, never by a config reset
     return false;
   }
   
@@ -216,52 +228,73 @@ void ConfigManager::showRetryDisplay() {
   displayManager->drawText(45, 80, attemptText, ST77XX_WHITE, 2);
 }
 
-void ConfigManager::reportServerFailure() {
-  unsigned long currentTime = millis();
+// ============= Recovery AP =============
+
+// Server unreachable for a long time: AP + server form next to the STA link.
+// Stored WiFi/server config is kept; the dashboard keeps polling meanwhile.
+void ConfigManager::startRecoveryAP() {
+  if (recoveryAP) return;
   
-  // Debounce: only count if more than 10s since last check
-  if (currentTime - lastServerCheck < 10000) return;
+  WiFi.mode(WIFI_AP_STA);
+  WiFi.softAP(apSSID, apPassword);
   
-  lastServerCheck = currentTime;
-  serverFailCount++;
+  if (!server) server = new ESP8266WebServer(80);
+  server->on("/", [this]() { handleRoot(); });
+  server->on("/server", HTTP_POST, [this]() { handleRecoveryServer(); });
+  server->begin();
+  recoveryAP = true;
   
-  DEBUG_PRINT(F("[CFG] Server fail: "));
-  DEBUG_PRINT(serverFailCount);
-  DEBUG_PRINTLN(F("/10"));
+  DEBUG_PRINT(F("[CFG] Recovery AP: "));
+  DEBUG_PRINT(apSSID);
+  DEBUG_PRINT(F(" @ "));
+  DEBUG_PRINTLN(WiFi.softAPIP());
+}
+
+void ConfigManager::stopRecoveryAP() {
+  if (!recoveryAP) return;
   
-  // Show server reconnecting on display
-  if (displayManager) {
-    displayManager->clear();
-    displayManager->drawText(5, 40, "Server Lost!", ST77XX_RED, 2);
-    displayManager->drawText(5, 70, "Reconnecting", ST77XX_YELLOW, 1);
-    
-    char attemptText[20];
-    snprintf(attemptText, sizeof(attemptText), "Attempt %d/10", serverFailCount);
-    displayManager->drawText(5, 90, attemptText, ST77XX_WHITE, 1);
-    
-    displayManager->drawText(5, 110, config.serverIP, ST77XX_CYAN, 1);
-  }
+  server->stop();
+  delete server;  // Drops the handlers too
+  server = nullptr;
+  WiFi.softAPdisconnect(true);
+  WiFi.mode(WIFI_STA);
+  recoveryAP = false;
+  DEBUG_PRINTLN(F("[CFG] Recovery AP closed"));
+}
+
+bool ConfigManager::handleRecoveryAP() {
+  if (!recoveryAP) return false;
   
-  // If server fails 10 times, fallback to config
-  if (serverFailCount >= 10) {
-    DEBUG_PRINTLN(F("\n[CFG] SERVER UNREACHABLE! Entering config mode...\n"));
-    if (displayManager) {
-      displayManager->clear();
-      displayManager->drawText(5, 20, "SERVER ERROR!", ST77XX_RED, 1);
-      displayManager->drawText(5, 40, "Cannot reach", ST77XX_YELLOW, 1);
-      displayManager->drawText(5, 55, "server after", ST77XX_YELLOW, 1);
-      displayManager->drawText(5, 70, "10 attempts", ST77XX_YELLOW, 1);
-      displayManager->drawText(5, 90, "Rebooting to", ST77XX_WHITE, 1);
-      displayManager->drawText(5, 105, "config mode...", ST77XX_WHITE, 1);
-      delay(3000);
-    }
-    resetConfig();
-    ESP.restart();
-  }
+  server->handleClient();
+  bool changed = recoveryChanged;
+  recoveryChanged = false;
+  return changed;
 }
 
-void ConfigManager::reportServerSuccess() {
-  serverFailCount = 0;  // Reset on success
+void ConfigManager::handleRecoveryServer() {
+  String ip = server->arg("ip");
+  String portText = server->arg("port");
+  ip.trim();
+  portText.trim();
+  
+  if (ip.length() == 0) {
+    // Empty = find it again via mDNS
+    if (discovery) discovery->request();
+    server->send(200, "text/plain", "Searching for the bridge on the local network...");
+    return;
+  }
+  
+  // Same checks as the portal; an unreachable bridge is saved anyway (it may come back)
+  uint16_t port;
+  if (!ConfigValidator::checkServer(ip.c_str(), portText.c_str(), sizeof(config.serverIP), port)) {
+    server->send(400, "text/plain", "Invalid server address or port");
+    return;
+  }
+  bool reachable = testServerConnection(ip.c_str(), port, 3000);
+  
+  recoveryChanged = updateServerAddress(ip.c_str(), port);
+  server->send(200, "text/plain", String(reachable ? "Saved" : "Saved, but the bridge did not answer") +
+                                  " - the panel now uses " + ip + ":" + String(port));
 }
 
 // ============= Config Portal =============
@@ -278,6 +311,32 @@ bool ConfigManager::startConfigPortalWithValidation() {
   
   // Step 3: Validate server (optional - save anyway if failed)
   DEBUG_PRINTLN(F("\n[CFG] Step 3: Validating..."));
+  
+  // Address left empty: look the bridge up via mDNS
+  if (tempServerIP.length() == 0) {
+    if (displayManager) {
+      displayManager->clear();
+      displayManager->drawText(5, 50, "Searching for", ST77XX_WHITE, 1);
+      displayManager->drawText(5, 65, "PC bridge...", ST77XX_CYAN, 1);
+    }
+    IPAddress ip;
+    uint16_t port;
+    if (discovery && discovery->resolve(ip, port)) {
+      tempServerIP = ip.toString();
+      tempServerPort = port;
+    } else {
+      DEBUG_PRINTLN(F("[CFG] ERROR: No bridge found via mDNS!"));
+      if (displayManager) {
+        displayManager->clear();
+        displayManager->drawText(10, 50, "ERROR!", ST77XX_RED, 2);
+        displayManager->drawText(5, 80, "No bridge found", ST77XX_WHITE, 1);
+        displayManager->drawText(5, 95, "Enter its IP", ST77XX_CYAN, 1);
+        delay(3000);
+      }
+      return false;
+    }
+  }
+  
   bool serverValid = testServerConnection(tempServerIP.c_str(), tempServerPort, 5000);
   
   if (!serverValid) {
@@ -336,6 +395,7 @@ bool ConfigManager::startConfigPortalWithValidation() {
   
   if (saveConfig()) {
     DEBUG_PRINTLN(F("[CFG] Config saved!"));
+    HostPoller::saveHostList(tempHosts.c_str());  // Extra carousel hosts (may be empty)
     
     if (displayManager) {
       displayManager->clear();
@@ -467,7 +527,7 @@ bool ConfigManager::startServerConfigPortal() {
     }
     
     // Check if config completed
-    if (tempServerIP.length() > 0 && tempServerPort > 0) {
+    if (serverSubmitted && tempServerPort > 0) {
       server->stop();
       WiFi.softAPdisconnect(true);
       return true;
@@ -637,25 +697,38 @@ void ConfigManager::handleClient() {
 // ============= Web Handlers =============
 
 void ConfigManager::handleRoot() {
-  server->send(200, "text/html", ConfigPortal::generateServerConfigHTML());
+  ConfigPortal::sendServerConfigPage(*server);
 }
 
 void ConfigManager::handleServerConfig() {
   if (server->hasArg("ip")) {
-    tempServerIP = server->arg("ip");
-    
-    // Port is optional - default to 80 if empty or not provided
-    if (server->hasArg("port") && server->arg("port").length() > 0) {
-      tempServerPort = server->arg("port").toInt();
-    } else {
-      tempServerPort = 80;  // Default HTTP port
+    String ip = server->arg("ip");
+    String port = server->arg("port");
+    ip.trim();
+    port.trim();
+    
+    // Port is optional (80); empty address = mDNS lookup, port comes from the bridge
+    uint16_t checkedPort = 80;
+    if (ip.length() > 0 &&
+        !ConfigValidator::checkServer(ip.c_str(), port.c_str(), sizeof(config.serverIP), checkedPort)) {
+      server->send(400, "text/plain", "Invalid server address or port");
+      return;
     }
+    tempServerIP = ip;
+    tempServerPort = checkedPort;
+    serverSubmitted = true;
     
     DEBUG_PRINT(F("[CFG] Config: "));
     DEBUG_PRINT(tempServerIP);
     DEBUG_PRINT(F(":"));
     DEBUG_PRINTLN(tempServerPort);
-    server->send(200, "text/html", ConfigPortal::generateSuccessHTML(apSSID, tempServerIP, tempServerPort));
+    
+    // Extra hosts for the carousel (optional, "host[:port]" per line)
+    tempHosts = server->hasArg("hosts") ? server->arg("hosts") : String();
+    
+    ConfigPortal::sendSuccessPage(*server, apSSID,
+                                  tempServerIP.length() > 0 ? tempServerIP.c_str() : "auto (mDNS)",
+                                  tempServerPort);
     
     // Delay to let user see success page before WiFi portal switch
     delay(2000);
@@ -665,31 +738,19 @@ void ConfigManager::handleServerConfig() {
 }
 
 void ConfigManager::handleTestServer() {
-  server->send(200, "text/html", ConfigPortal::generateTestingHTML());
+  ConfigPortal::sendTestingPage(*server);
 }
 
 void ConfigManager::handleStatus() {
   String j = "{\"serverIP\":\"" + tempServerIP + "\",\"serverPort\":" + String(tempServerPort) + 
-             ",\"hasServerConfig\":" + (tempServerIP.length() > 0 ? "true" : "false") + "}";
+             ",\"hasServerConfig\":" + (serverSubmitted ? "true" : "false") + "}";
   server->send(200, "application/json", j);
 }
 
 void ConfigManager::handleCancel() {
   DEBUG_PRINTLN(F("[CFG] User cancelled config"));
   
-  String html = F("<!DOCTYPE html><html><head><meta charset='UTF-8'>");
-  html += F("<meta name='viewport' content='width=device-width,initial-scale=1'>");
-  html += F("<title>Cancelled</title>");
-  html += F("<style>");
-  html += F("body{font-family:sans-serif;background:#667eea;color:white;text-align:center;padding:50px}");
-  html += F("h1{font-size:24px;margin-bottom:16px}");
-  html += F("p{opacity:0.9}");
-  html += F("</style></head><body>");
-  html += F("<h1>Configuration Cancelled</h1>");
-  html += F("<p>Restarting device...</p>");
-  html += F("</body></html>");
-  
-  server->send(200, "text/html", html);
+  ConfigPortal::sendCancelledPage(*server);
   delay(2000);
   ESP.restart();
 }
@@ -4,6 +4,7 @@
 
 #include "config.h"
 #include "config_storage.h"
+#include "metrics.h"
 #include <string.h>
 
 ConfigStorage::ConfigStorage() {
@@ -70,6 +71,7 @@ bool ConfigStorage::save(const ConfigData& config) {
   
   EEPROM.put(0, tempConfig);
   bool success = EEPROM.commit();
+  Metrics::recordFlashWrite();
   
   if (success) {
     DEBUG_PRINTLN(F("[STOR] Config saved to EEPROM"));
@@ -57,3 +57,25 @@ bool ConfigValidator::testServer(const char* serverIP, uint16_t serverPort, int
   
   return success;
 }
+
+bool ConfigValidator::checkServer(const char* host, const char* portText, size_t maxLen, uint16_t& port) {
+  size_t len = strlen(host);
+  if (len == 0 || len >= maxLen) return false;  // Would be cut when stored
+  for (size_t i = 0; i < len; i++) {
+    char c = host[i];
+    if (!isalnum((unsigned char)c) && c != '.' && c != '-') return false;
+  }
+  
+  if (*portText == '\0') {
+    port = 80;  // Default HTTP port
+    return true;
+  }
+  uint32_t value = 0;
+  for (const char* p = portText; *p; p++) {
+    if (*p < '0' || *p > '9' || p - portText >= 5) return false;
+    value = value * 10 + (*p - '0');
+  }
+  if (value == 0 || value > 65535) return false;
+  port = value;
+  return true;
+}
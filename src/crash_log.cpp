@@ -0,0 +1,223 @@
+/*
+ * Crash Log Implementation
+ */
+
+#include "config.h"
+#include "crash_log.h"
+#include "health_log.h"  // HEALTH_RTC_OFFSET, RTC_EBOOT_BLOCK
+#include <user_interface.h>  // rst_info, REASON_*
+#include <flash_hal.h>       // FS_PHYS_ADDR / FS_PHYS_SIZE
+
+static_assert(sizeof(CrashRecord) == 36, "CrashRecord layout changed");
+static_assert(sizeof(CrashRecord) % 4 == 0, "Flash writes are 4-byte aligned");
+
+static constexpr uint32_t LIVE_MAGIC = 0x4352534C;  // "CRSL"
+static constexpr uint16_t SLOT_COUNT = FLASH_SECTOR_SIZE / sizeof(CrashRecord);
+static constexpr uint32_t EMPTY_WORD = 0xFFFFFFFF;  // Erased flash
+
+// Last known state of the running firmware (RTC memory)
+struct LiveState {
+  uint32_t magic;
+  uint32_t uptimeMs;
+  uint16_t freeHeap;
+  uint8_t stage;
+  uint8_t depth;
+  uint32_t stack[CrashLog::STACK_DEPTH];
+};
+
+static constexpr size_t LIVE_HEAD = offsetof(LiveState, stack);  // Updated per stage
+
+static_assert(sizeof(LiveState) % 4 == 0, "RTC memory is accessed in 4-byte blocks");
+static_assert(CRASH_RTC_OFFSET >= HEALTH_RTC_OFFSET + HealthLog::RTC_BLOCKS ||
+              CRASH_RTC_OFFSET + sizeof(LiveState) / 4 <= HEALTH_RTC_OFFSET,
+              "Crash log overlaps the health log in RTC user memory");
+static_assert(CRASH_RTC_OFFSET + sizeof(LiveState) / 4 <= RTC_EBOOT_BLOCK,
+              "Crash log must end before the eboot command area of RTC user memory");
+
+static LiveState live;
+static CrashRecord current;     // This boot (always available, even without flash)
+static uint32_t sectorAddr = 0; // 0 = no flash region
+static uint16_t used = 0;       // Records in the sector
+
+static uint32_t slotAddr(uint16_t slot) {
+  return sectorAddr + slot * sizeof(CrashRecord);
+}
+
+static bool readSlot(uint16_t slot, CrashRecord& rec) {
+  return ESP.flashRead(slotAddr(slot), reinterpret_cast<uint32_t*>(&rec), sizeof(rec));
+}
+
+static void findRegion() {
+  #if CRASH_LOG_FLASH
+  if (FS_PHYS_SIZE >= FLASH_SECTOR_SIZE) {
+    sectorAddr = FS_PHYS_ADDR + FS_PHYS_SIZE - FLASH_SECTOR_SIZE;
+  }
+  #endif
+}
+
+// Count used slots (records are appended, erased flash reads 0xFF)
+static void scan() {
+  used = 0;
+  while (used < SLOT_COUNT) {
+    uint32_t word;
+    if (!ESP.flashRead(slotAddr(used), &word, sizeof(word)) || word == EMPTY_WORD) break;
+    used++;
+  }
+}
+
+// Sector full: erase it and write back only the newest records
+static bool compact() {
+  CrashRecord keep[CrashLog::CAPACITY - 1];
+  uint8_t n = 0;
+  for (uint16_t slot = used - (CrashLog::CAPACITY - 1); slot < used; slot++) {
+    readSlot(slot, keep[n++]);
+  }
+
+  if (!ESP.flashEraseSector(sectorAddr / FLASH_SECTOR_SIZE)) return false;
+  used = 0;
+
+  if (!ESP.flashWrite(sectorAddr, reinterpret_cast<uint32_t*>(keep), sizeof(keep))) return false;
+  used = n;
+  return true;
+}
+
+static void append(CrashRecord& rec) {
+  if (sectorAddr == 0) return;
+
+  if (used >= SLOT_COUNT && !compact()) {
+    DEBUG_PRINTLN(F("[CRASH] Flash compact failed"));
+    return;
+  }
+
+  if (ESP.flashWrite(slotAddr(used), reinterpret_cast<uint32_t*>(&rec), sizeof(rec))) {
+    used++;
+  }
+}
+
+void CrashLog::begin() {
+  findRegion();
+  if (sectorAddr != 0) scan();
+
+  // Previous run, as far as RTC memory remembers it
+  bool haveLive = ESP.rtcUserMemoryRead(CRASH_RTC_OFFSET, reinterpret_cast<uint32_t*>(&live), sizeof(live)) &&
+                  live.magic == LIVE_MAGIC && live.depth <= STACK_DEPTH;
+  if (!haveLive) {
+    memset(&live, 0, sizeof(live));
+  }
+
+  CrashRecord last;
+  uint16_t lastBoot = (used > 0 && readSlot(used - 1, last)) ? last.boot : 0;
+
+  const rst_info* info = ESP.getResetInfoPtr();
+  memset(&current, 0, sizeof(current));
+  current.boot = lastBoot + 1;
+  current.reason = info->reason;
+  current.stage = live.stage;
+  current.uptimeS = live.uptimeMs / 1000;
+  current.freeHeap = live.freeHeap;
+  if (info->reason == REASON_EXCEPTION_RST) {
+    current.exccause = info->exccause;
+    current.epc1 = info->epc1;
+    current.excvaddr = info->excvaddr;
+  }
+  current.depth = live.depth;
+  memcpy(current.stack, live.stack, live.depth * sizeof(uint32_t));
+
+  append(current);
+
+  // Fresh live state for this run
+  memset(&live, 0, sizeof(live));
+  live.magic = LIVE_MAGIC;
+  ESP.rtcUserMemoryWrite(CRASH_RTC_OFFSET, reinterpret_cast<uint32_t*>(&live), sizeof(live));
+  stage(STAGE_SETUP);
+
+  DEBUG_PRINTF("[CRASH] Boot #%u: %s (prev stage %s, up %us)\n", current.boot,
+               reasonName(current.reason), stageName(current.stage), current.uptimeS);
+}
+
+void CrashLog::stage(LoopStage s) {
+  live.stage = s;
+  live.uptimeMs = millis();
+  uint32_t heap = ESP.getFreeHeap();
+  live.freeHeap = heap > 0xFFFF ? 0xFFFF : heap;
+  ESP.rtcUserMemoryWrite(CRASH_RTC_OFFSET, reinterpret_cast<uint32_t*>(&live), LIVE_HEAD);
+}
+
+void CrashLog::captureStack(uint32_t stackStart, uint32_t stackEnd) {
+  live.depth = 0;
+  live.uptimeMs = millis();
+
+  for (uint32_t p = stackStart; p < stackEnd && live.depth < STACK_DEPTH; p += 4) {
+    uint32_t v = *reinterpret_cast<const uint32_t*>(p);
+    // IRAM or flash-mapped code
+    if ((v >= 0x40100000 && v < 0x40110000) || (v >= 0x40201000 && v < 0x40300000)) {
+      live.stack[live.depth++] = v;
+    }
+  }
+
+  ESP.rtcUserMemoryWrite(CRASH_RTC_OFFSET, reinterpret_cast<uint32_t*>(&live), sizeof(live));
+}
+
+uint8_t CrashLog::count() {
+  if (sectorAddr == 0 || used == 0) return 1;  // RAM copy of this boot only
+  return used < CAPACITY ? used : CAPACITY;
+}
+
+bool CrashLog::get(uint8_t index, CrashRecord& out) {
+  if (index >= count()) return false;
+  if (index == 0) {
+    out = current;
+    return true;
+  }
+  return readSlot(used - 1 - index, out);
+}
+
+uint16_t CrashLog::getBootCount() {
+  return current.boot;
+}
+
+uint8_t CrashLog::getLastReason() {
+  return current.reason;
+}
+
+bool CrashLog::isCrash(uint8_t reason) {
+  return reason == REASON_WDT_RST || reason == REASON_EXCEPTION_RST || reason == REASON_SOFT_WDT_RST;
+}
+
+const char* CrashLog::reasonName(uint8_t reason) {
+  switch (reason) {
+    case REASON_DEFAULT_RST:       return "power_on";
+    case REASON_WDT_RST:           return "hw_wdt";
+    case REASON_EXCEPTION_RST:     return "exception";
+    case REASON_SOFT_WDT_RST:      return "soft_wdt";
+    case REASON_SOFT_RESTART:      return "restart";
+    case REASON_DEEP_SLEEP_AWAKE:  return "deep_sleep";
+    case REASON_EXT_SYS_RST:       return "ext_reset";
+    default:                       return "unknown";
+  }
+}
+
+const char* CrashLog::stageName(uint8_t s) {
+  switch (s) {
+    case STAGE_SETUP:      return "setup";
+    case STAGE_INPUT:      return "input";
+    case STAGE_MENU:       return "menu";
+    case STAGE_OTA_WEB:    return "ota_web";
+    case STAGE_CONFIG:     return "config";
+    case STAGE_WIFI:       return "wifi";
+    case STAGE_OTA:        return "ota";
+    case STAGE_FW_UPDATE:  return "fw_update";
+    case STAGE_METRICS:    return "metrics";
+    case STAGE_FETCH:      return "fetch";
+    case STAGE_RENDER:     return "render";
+    case STAGE_IDLE:       return "idle";
+    case STAGE_HOSTS:      return "hosts";
+    case STAGE_DISCOVERY:  return "discovery";
+    default:               return "-";
+  }
+}
+
+// Core hook: runs after the exception/soft-WDT dump, before the reboot
+extern "C" void custom_crash_callback(struct rst_info*, uint32_t stack, uint32_t stackEnd) {
+  CrashLog::captureStack(stack, stackEnd);
+}
@@ -4,11 +4,17 @@
 
 #include "config.h"  // MUST be first to define TFT_ST7735
 #include "display_manager.h"
+#include "dashboard_layout.h"
+#include "alert_engine.h"
+#include "push_metrics.h"
 #include "version.h"
 #include <ESP8266WiFi.h>  // For WiFi.localIP()
 
 DisplayManager::DisplayManager(uint8_t cs, uint8_t dc, uint8_t rst, uint8_t led, uint8_t rot)
-  : csPin(cs), dcPin(dc), rstPin(rst), ledPin(led), rotation(rot), displayOn(true) {
+  : csPin(cs), dcPin(dc), rstPin(rst), ledPin(led), rotation(rot), displayOn(true),
+    plainRendering(false), backlight(led), tilePage(0), tilePageAt(0),
+    heatCount(0), highlightMask(0), flashUntil(0), flashToggleAt(0), inverted(false),
+    pushed(nullptr), layout(DASHBOARD_LAYOUT), layoutCount(DASHBOARD_TILE_COUNT), frameColor(0) {
   
   #ifdef TFT_ST7735
     tft = new Adafruit_ST7735(csPin, dcPin, rstPin);
@@ -24,8 +30,7 @@ DisplayManager::~DisplayManager() {
 }
 
 void DisplayManager::begin() {
-  pinMode(ledPin, OUTPUT);
-  digitalWrite(ledPin, HIGH);
+  backlight.begin();
   
   // Initialize display based on type
   #ifdef TFT_ST7735
@@ -41,11 +46,13 @@ void DisplayManager::begin() {
   #endif
   
   tft->setRotation(rotation);
-  tft->fillScreen(COLOR_BG);
+  clearScreen();
+  
+  glyphs.begin();
 }
 
 void DisplayManager::showSplashScreen() {
-  tft->fillScreen(COLOR_BG);
+  clearScreen();
   
   // Title
   tft->setTextColor(COLOR_HEADER);
@@ -70,7 +77,7 @@ void DisplayManager::showSplashScreen() {
 }
 
 void DisplayManager::showWiFiConnecting() {
-  tft->fillScreen(COLOR_BG);
+  clearScreen();
   tft->setTextSize(2);
   tft->setTextColor(COLOR_HEADER);
   tft->setCursor(10, 50);
@@ -85,7 +92,7 @@ void DisplayManager::showWiFiConnecting() {
 }
 
 void DisplayManager::showWiFiStatus(bool success, String ip) {
-  tft->fillScreen(COLOR_BG);
+  clearScreen();
   tft->setTextSize(2);
   
   if (success) {
@@ -128,538 +135,602 @@ void DisplayManager::showWiFiStatus(bool success, String ip) {
   }
 }
 
-void DisplayManager::displaySystemInfo(const SystemData& data) {
-  tft->fillScreen(COLOR_BG);
-  
-  // Calculate responsive grid layout
-  int margin = 2;  // Minimal margin for more space
-  int tileSpacing = 2; // Minimal gap between tiles
-  
-  // Get actual display dimensions after rotation is applied
-  int16_t screenWidth = tft->width();
-  int16_t screenHeight = tft->height();
-  
-  // Auto-detect orientation based on actual screen dimensions after rotation
-  // Portrait: height > width (rotation 0 or 2)
-  // Landscape: width > height (rotation 1 or 3)
-  bool isLandscape = (screenWidth > screenHeight);
-  
-  int tileWidth, tileHeight, numCols, numRows;
-  
-  if (isLandscape) {
-    // Landscape mode: 3 columns x 2-3 rows
-    numCols = 3;
-    numRows = 2;
-    tileWidth = (screenWidth - margin * 2 - tileSpacing * (numCols - 1)) / numCols;
-    tileHeight = (screenHeight - 10 - margin * 2 - tileSpacing) / numRows;
+void DisplayManager::displaySystemInfo(const SystemData& data, const char* title, uint16_t highlight) {
+  // Backlight off - nobody can see it, skip all SPI traffic
+  if (!isOn()) return;
+  
+  // Alert borders changed: the kept heatmap tile needs its frame redrawn too
+  if (highlight != highlightMask) heatCount = 0;
+  highlightMask = highlight;
+  
+  // Core heatmap with the same grid: clear around it and repaint only changed cells
+  const TileSlot* heat = nullptr;
+  for (uint8_t i = 0; i < layoutCount; i++) {
+    if (layout[i].kind == TILE_CORES) heat = &layout[i];
+  }
+  if (heat && heatCount > 0 && heatCount == data.coreCount) {
+    const int16_t W = DashboardLayout::WIDTH, H = DashboardLayout::HEIGHT;
+    tft->fillRect(0, 0, W, heat->y, COLOR_BG);
+    tft->fillRect(0, heat->y + heat->h, W, H - heat->y - heat->h, COLOR_BG);
+    tft->fillRect(0, heat->y, heat->x, heat->h, COLOR_BG);
+    tft->fillRect(heat->x + heat->w, heat->y, W - heat->x - heat->w, heat->h, COLOR_BG);
   } else {
-    // Portrait mode: 2 columns x 4 rows
-    numCols = 2;
-    numRows = 4;
-    tileWidth = (screenWidth - margin * 2 - tileSpacing) / numCols;
-    tileHeight = (screenHeight - 10 - margin * 2) / numRows;
+    clearScreen();
   }
   
-  int x = margin;
-  int y = margin;
-  
   // Header bar at top
-  tft->fillRect(0, 0, screenWidth, 10, COLOR_HEADER);
+  tft->fillRect(0, 0, DashboardLayout::WIDTH, DashboardLayout::HEADER_H, COLOR_HEADER);
   tft->setTextSize(1);
   tft->setTextColor(COLOR_BG);
-  drawCenteredText(1, "SYS", 1);
-  y = 12;
-  
-  // Draw tiles based on orientation
-  if (isLandscape) {
-    // === LANDSCAPE MODE: 3 columns ===
-    // Row 1: CPU | RAM | GPU
-    // Row 2: VRAM | STORAGE | NET
-    
-    // CPU Tile (col 1)
-    drawTile_CPU(x, y, tileWidth, tileHeight, data);
-    
-    // RAM Tile (col 2)
-    int col2X = x + tileWidth + tileSpacing;
-    drawTile_RAM(col2X, y, tileWidth, tileHeight, data);
-    
-    // GPU Tile (col 3)
-    if (data.gpuName.length() > 0) {
-      int col3X = col2X + tileWidth + tileSpacing;
-      drawTile_GPU(col3X, y, tileWidth, tileHeight, data);
-    }
-    
-    y += tileHeight + tileSpacing;
-    
-    // VRAM Tile (col 1)
-    if (data.gpuName.length() > 0 && data.gpuMemTotal > 0) {
-      drawTile_VRAM(x, y, tileWidth, tileHeight, data);
-    }
-    
-    // Storage Tile (col 2)
-    if (data.disk1Name.length() > 0) {
-      drawTile_Storage(col2X, y, tileWidth, tileHeight, data);
-    }
-    
-    // Network Tile (col 3) - combined UP+DOWN
-    if (data.netName.length() > 0) {
-      int col3X = col2X + tileWidth + tileSpacing;
-      drawTile_Network_Combined(col3X, y, tileWidth, tileHeight, data);
-    }
-    
-  } else {
-    // === PORTRAIT MODE: 2 columns ===
-    // Row 1: CPU and RAM tiles (side by side)
-    // CPU Tile (left)
-    tft->drawRect(x, y, tileWidth, tileHeight, COLOR_CPU);
-    tft->setTextSize(1);
-    tft->setTextColor(COLOR_CPU);
-    tft->setCursor(x + 2, y + 2);
-    tft->print(F("CPU"));
+  drawCenteredText(1, title, COLOR_BG, 1);
   
-  // CPU percentage (large) - centered vertically
-  tft->setTextSize(2);
-  tft->setTextColor(COLOR_TEXT);
-  int centerY = y + (tileHeight / 2) - 8;
-  tft->setCursor(x + 4, centerY);
-  tft->print((int)data.cpuLoad);
-  tft->setTextSize(1);
-  tft->print(F("%"));
+  // Walk the precomputed layout (see dashboard_layout.h / layout_store.h)
+  for (uint8_t i = 0; i < layoutCount; i++) {
+    drawTile(layout[i], data);
+  }
+}
+
+void DisplayManager::setLayout(const TileSlot* slots, uint8_t count) {
+  layout = slots;
+  layoutCount = count;
+  heatCount = 0;  // Heatmap may have moved - next frame is a full redraw
+}
+
+// Server unreachable: last data stays up, header shows its age ("!45s", "!12m")
+void DisplayManager::drawStaleBadge(unsigned long ageS, bool apActive) {
+  if (!isOn()) return;
+  
+  char text[12];
+  if (ageS < 100) {
+    snprintf(text, sizeof(text), "!%lus", ageS);
+  } else if (ageS < 6000) {
+    snprintf(text, sizeof(text), "!%lum", ageS / 60);
+  } else {
+    snprintf(text, sizeof(text), "!%luh", ageS / 3600);
+  }
   
-  // CPU temp (bottom right corner)
+  int16_t w = strlen(text) * DashboardLayout::FONT_W;
+  tft->fillRect(DashboardLayout::WIDTH - w - 4, 0, w + 4, DashboardLayout::HEADER_H, COLOR_CPU);
   tft->setTextSize(1);
-  tft->setTextColor(ST77XX_YELLOW);
-  tft->setCursor(x + tileWidth - 24, y + tileHeight - 10);
-  tft->print((int)data.cpuTemp);
-  tft->print(F("C"));
+  tft->setTextColor(COLOR_TEXT);
+  tft->setCursor(DashboardLayout::WIDTH - w - 2, 1);
+  tft->print(text);
   
-  // RAM Tile (right)
-  int ramX = x + tileWidth + tileSpacing;
-  tft->drawRect(ramX, y, tileWidth, tileHeight, COLOR_RAM);
-  tft->setTextSize(1);
-  tft->setTextColor(COLOR_RAM);
-  tft->setCursor(ramX + 2, y + 2);
-  tft->print(F("RAM"));
+  // Recovery AP is up - say so on the left
+  if (apActive) {
+    tft->fillRect(0, 0, 2 * DashboardLayout::FONT_W + 4, DashboardLayout::HEADER_H, COLOR_GPU);
+    tft->setCursor(2, 1);
+    tft->print(F("AP"));
+  }
+}
+
+// Carousel summary: one two-line row per host (status, CPU/RAM, latency)
+void DisplayManager::displayHostSummary(const HostSummaryRow* rows, uint8_t count) {
+  if (!isOn()) return;
   
-  float ramPercent = (data.ramTotal > 0) ? (data.ramUsed / data.ramTotal * 100.0) : 0;
+  clearScreen();
+  tft->fillRect(0, 0, DashboardLayout::WIDTH, DashboardLayout::HEADER_H, COLOR_HEADER);
+  drawCenteredText(1, "HOSTS", COLOR_BG, 1);
   
-  // RAM percentage (large) - centered vertically
-  tft->setTextSize(2);
-  tft->setTextColor(COLOR_TEXT);
-  tft->setCursor(ramX + 4, centerY);
-  tft->print((int)ramPercent);
-  tft->setTextSize(1);
-  tft->print(F("%"));
+  const int16_t rowH = DashboardLayout::FONT_H * 2 + 6;
+  const uint8_t maxChars = (DashboardLayout::WIDTH - 14) / DashboardLayout::FONT_W;
+  uint32_t totalMem = 0;
+  int16_t y = DashboardLayout::HEADER_H + 4;
   
-  // RAM usage (bottom right corner)
   tft->setTextSize(1);
-  tft->setTextColor(ST77XX_CYAN);
-  tft->setCursor(ramX + tileWidth - 28, y + tileHeight - 10);
-  tft->print(data.ramUsed, 1);
-  tft->print(F("G"));
-  
-  y += tileHeight + tileSpacing;
-  
-  // Row 2: GPU and VRAM tiles (if available)
-  if (data.gpuName.length() > 0) {
-    centerY = y + (tileHeight / 2) - 8;
+  for (uint8_t i = 0; i < count && y + rowH <= DashboardLayout::HEIGHT - DashboardLayout::FONT_H; i++) {
+    const HostSummaryRow& row = rows[i];
+    totalMem += row.memBytes;
     
-    // GPU Tile (left)
-    tft->drawRect(x, y, tileWidth, tileHeight, COLOR_GPU);
-    tft->setTextSize(1);
-    tft->setTextColor(COLOR_GPU);
-    tft->setCursor(x + 2, y + 2);
-    tft->print(F("GPU"));
-    
-    // GPU percentage (large) - centered
-    tft->setTextSize(2);
+    // Status dot + name
+    tft->fillCircle(5, y + 3, 3, row.online ? COLOR_RAM : COLOR_CPU);
     tft->setTextColor(COLOR_TEXT);
-    tft->setCursor(x + 4, centerY);
-    tft->print((int)data.gpuLoad);
-    tft->setTextSize(1);
-    tft->print(F("%"));
-    
-    // GPU temp (bottom right)
-    tft->setTextSize(1);
-    tft->setTextColor(ST77XX_YELLOW);
-    tft->setCursor(x + tileWidth - 24, y + tileHeight - 10);
-    tft->print((int)data.gpuTemp);
-    tft->print(F("C"));
-    
-    // VRAM Tile (right)
-    if (data.gpuMemTotal > 0) {
-      float vramPercent = (data.gpuMemUsed / (float)data.gpuMemTotal * 100.0);
-      tft->drawRect(ramX, y, tileWidth, tileHeight, COLOR_VRAM);
-      tft->setTextSize(1);
-      tft->setTextColor(COLOR_VRAM);
-      tft->setCursor(ramX + 2, y + 2);
-      tft->print(F("VRAM"));
-      
-      // VRAM percentage (large) - centered
-      tft->setTextSize(2);
-      tft->setTextColor(COLOR_TEXT);
-      tft->setCursor(ramX + 4, centerY);
-      tft->print((int)vramPercent);
-      tft->setTextSize(1);
-      tft->print(F("%"));
-      
-      // VRAM usage (bottom right corner)
-      tft->setTextSize(1);
-      tft->setTextColor(ST77XX_CYAN);
-      if (data.gpuMemUsed < 10000) {
-        // Show in MB
-        tft->setCursor(ramX + tileWidth - 32, y + tileHeight - 10);
-        tft->print(data.gpuMemUsed);
-        tft->print(F("M"));
-      } else {
-        // Show in GB
-        tft->setCursor(ramX + tileWidth - 28, y + tileHeight - 10);
-        tft->print(data.gpuMemUsed / 1024);
-        tft->print(F("G"));
-      }
+    tft->setCursor(12, y);
+    for (uint8_t c = 0; row.label[c] && c < maxChars; c++) {
+      tft->print(row.label[c]);
     }
     
-    y += tileHeight + tileSpacing;
-  }
-  
-  // Row 3: Storage (full width)
-  if (data.disk1Name.length() > 0 && y < screenHeight - 30) {
-    int storageWidth = screenWidth - margin * 2;
-    tft->drawRect(x, y, storageWidth, tileHeight, COLOR_DISK);
-    tft->setTextSize(1);
-    tft->setTextColor(COLOR_DISK);
-    tft->setCursor(x + 2, y + 2);
-    tft->print(F("STORAGE"));
-    
-    // Calculate center for storage info
-    int storageCenterY = y + (tileHeight / 2) - 4;
-    
-    // Show disk 1 info
-    tft->setTextColor(COLOR_TEXT);
-    tft->setCursor(x + 4, storageCenterY);
-    tft->print(F("D1:"));
-    tft->print((int)data.disk1Load);
-    tft->print(F("%"));
-    
-    // Disk 1 temp on right side
-    tft->setTextColor(ST77XX_YELLOW);
-    tft->setCursor(x + storageWidth - 28, storageCenterY);
-    tft->print((int)data.disk1Temp);
-    tft->print(F("C"));
-    
-    // Show disk 2 if available (below disk 1)
-    if (data.disk2Name.length() > 0) {
-      tft->setTextColor(COLOR_TEXT);
-      tft->setCursor(x + 4, storageCenterY + 10);
-      tft->print(F("D2:"));
-      tft->print((int)data.disk2Load);
-      tft->print(F("%"));
-      
+    tft->setCursor(12, y + DashboardLayout::FONT_H + 1);
+    if (row.online && row.data->hasData) {
+      tft->setTextColor(COLOR_CPU);
+      tft->print(F("C"));
+      tft->print(Fixed10::toInt(row.data->cpuLoad));
+      tft->print(F("% "));
+      tft->setTextColor(COLOR_RAM);
+      tft->print(F("R"));
+      tft->print(Fixed10::toInt(Fixed10::percent(row.data->ramUsed, row.data->ramTotal)));
+      tft->print(F("% "));
       tft->setTextColor(ST77XX_YELLOW);
-      tft->setCursor(x + storageWidth - 28, storageCenterY + 10);
-      tft->print((int)data.disk2Temp);
+      tft->print(Fixed10::toInt(row.data->cpuTemp));
       tft->print(F("C"));
+    } else {
+      tft->setTextColor(COLOR_CPU);
+      tft->print(F("offline"));
+    }
+    if (row.latencyMs > 0) {
+      tft->setTextColor(COLOR_NET);
+      tft->print(F(" "));
+      tft->print(row.latencyMs);
+      tft->print(F("ms"));
     }
     
-    y += tileHeight + tileSpacing;
+    y += rowH;
   }
   
-  // Row 4: Network UP and DOWN (side by side)
-  if (data.netName.length() > 0 && y < SCREEN_HEIGHT - 10) {
-    centerY = y + (tileHeight / 2) - 8;
-    
-    // Upload Tile (left)
-    tft->drawRect(x, y, tileWidth, tileHeight, COLOR_NET);
-    tft->setTextSize(1);
-    tft->setTextColor(COLOR_NET);
-    tft->setCursor(x + 2, y + 2);
-    tft->print(F("UP"));
-    
-    // Upload speed (centered)
-    tft->setTextSize(2);
-    tft->setTextColor(COLOR_TEXT);
-    tft->setCursor(x + 4, centerY);
-    if (data.netUp < 10) {
-      tft->print(data.netUp, 1);
-    } else if (data.netUp < 100) {
-      tft->print((int)data.netUp);
-    } else {
-      tft->print((int)data.netUp);
-    }
-    
-    // Unit (bottom left)
-    tft->setTextSize(1);
-    tft->setTextColor(ST77XX_GREEN);
-    tft->setCursor(x + 2, y + tileHeight - 10);
-    tft->print(F("Mb/s"));
-    
-    // Download Tile (right)
-    tft->drawRect(ramX, y, tileWidth, tileHeight, COLOR_NET);
-    tft->setTextSize(1);
-    tft->setTextColor(COLOR_NET);
-    tft->setCursor(ramX + 2, y + 2);
-    tft->print(F("DOWN"));
-    
-    // Download speed (centered)
-    tft->setTextSize(2);
-    tft->setTextColor(COLOR_TEXT);
-    tft->setCursor(ramX + 4, centerY);
-    if (data.netDown < 10) {
-      tft->print(data.netDown, 1);
-    } else if (data.netDown < 100) {
-      tft->print((int)data.netDown);
-    } else {
-      tft->print((int)data.netDown);
+  // Poller heap footprint (bounded per host)
+  tft->setTextColor(COLOR_NET);
+  tft->setCursor(2, DashboardLayout::HEIGHT - DashboardLayout::FONT_H);
+  tft->print(F("mem "));
+  tft->print(totalMem);
+  tft->print(F("B"));
+}
+
+// AlertMetric bits shown by each tile kind (alert border)
+static uint16_t tileAlertMask(TileKind kind) {
+  switch (kind) {
+    case TILE_CPU:      return (1 << ALERT_CPU_TEMP) | (1 << ALERT_CPU_LOAD);
+    case TILE_CORES:    return 1 << ALERT_CPU_LOAD;
+    case TILE_RAM:      return 1 << ALERT_RAM_LOAD;
+    case TILE_GPU:      return (1 << ALERT_GPU_TEMP) | (1 << ALERT_GPU_LOAD);
+    case TILE_STORAGE:  return 1 << ALERT_DISK_TEMP;
+    case TILE_NET:
+    case TILE_NET_UP:
+    case TILE_NET_DOWN: return 1 << ALERT_NET_TOTAL;
+    default:            return 0;
+  }
+}
+
+// Dispatch one layout slot to its tile renderer (skip tiles without data)
+void DisplayManager::drawTile(const TileSlot& slot, const SystemData& data) {
+  drawTileContent(slot, data);
+  
+  // Active alert on this tile's metric: double border over the normal frame
+  if (highlightMask & tileAlertMask(slot.kind)) {
+    tft->drawRect(slot.x, slot.y, slot.w, slot.h, COLOR_ALERT);
+    tft->drawRect(slot.x + 1, slot.y + 1, slot.w - 2, slot.h - 2, COLOR_ALERT);
+  }
+}
+
+void DisplayManager::drawTileContent(const TileSlot& slot, const SystemData& data) {
+  frameColor = slot.color;
+  switch (slot.kind) {
+    case TILE_CPU:
+      drawTile_CPU(slot.x, slot.y, slot.w, slot.h, data);
+      break;
+    case TILE_RAM:
+      drawTile_RAM(slot.x, slot.y, slot.w, slot.h, data);
+      break;
+    case TILE_GPU:
+      if (data.gpuName.length() > 0) {
+        drawTile_GPU(slot.x, slot.y, slot.w, slot.h, data);
+      }
+      break;
+    case TILE_VRAM:
+      if (data.gpuName.length() > 0 && data.gpuMemTotal > 0) {
+        drawTile_VRAM(slot.x, slot.y, slot.w, slot.h, data);
+      }
+      break;
+    case TILE_STORAGE:
+      if (data.diskCount > 0) {
+        drawTile_Storage(slot.x, slot.y, slot.w, slot.h, data);
+      }
+      break;
+    case TILE_NET:
+      if (data.nicCount > 0) {
+        drawTile_Network_Combined(slot.x, slot.y, slot.w, slot.h, data);
+      }
+      break;
+    case TILE_NET_UP:
+      if (data.nicCount > 0) {
+        drawTile_NetRate(slot.x, slot.y, slot.w, slot.h, "UP", data, true);
+      }
+      break;
+    case TILE_NET_DOWN:
+      if (data.nicCount > 0) {
+        drawTile_NetRate(slot.x, slot.y, slot.w, slot.h, "DOWN", data, false);
+      }
+      break;
+    case TILE_CORES:
+      if (data.coreCount > 0) {
+        drawTile_Cores(slot.x, slot.y, slot.w, slot.h, data);
+      }
+      break;
+    case TILE_PUSH:
+      drawTile_Push(slot.x, slot.y, slot.w, slot.h, slot.metric);
+      break;
+    default:
+      break;
+  }
+  frameColor = 0;
+}
+
+// Storage rows that fit one tile: narrow = load + temp lines, wide = one line per disk
+static uint8_t diskRowsPerTile(int w, int h) {
+  int rowH = (w < 100) ? 20 : 10;
+  int rows = (h - 14) / rowH;
+  return rows > 0 ? rows : 1;
+}
+
+// How many pages a slot rotates through for this data (1 = static)
+uint8_t DisplayManager::tilePages(const TileSlot& slot, const SystemData& data) {
+  switch (slot.kind) {
+    case TILE_STORAGE: {
+      uint8_t rows = diskRowsPerTile(slot.w, slot.h);
+      return (data.diskCount + rows - 1) / rows;
     }
-    
-    // Unit (bottom left)
-    tft->setTextSize(1);
-    tft->setTextColor(ST77XX_GREEN);
-    tft->setCursor(ramX + 2, y + tileHeight - 10);
-    tft->print(F("Mb/s"));
+    case TILE_NET:
+    case TILE_NET_UP:
+    case TILE_NET_DOWN:
+      return data.nicCount;
+    default:
+      return 1;
   }
-  } // End of portrait/landscape conditional
 }
 
-// Helper function to draw CPU tile
-void DisplayManager::drawTile_CPU(int x, int y, int w, int h, const SystemData& data) {
-  tft->drawRect(x, y, w, h, COLOR_CPU);
+// Step paged tiles to their next disk/NIC page. Only those tiles are cleared
+// and redrawn, so the SPI work per step is a few tile rows, not a full frame.
+bool DisplayManager::advanceTilePage(const SystemData& data) {
+  if (!isOn() || !data.hasData) return false;
+  if (millis() - tilePageAt < TILE_PAGE_INTERVAL) return false;
+  tilePageAt = millis();
+  
+  bool drawn = false;
+  for (uint8_t i = 0; i < layoutCount; i++) {
+    const TileSlot& slot = layout[i];
+    if (tilePages(slot, data) <= 1) continue;
+    if (!drawn) tilePage++;
+    tft->fillRect(slot.x, slot.y, slot.w, slot.h, COLOR_BG);
+    drawTile(slot, data);
+    drawn = true;
+  }
+  return drawn;
+}
+
+// Helper: tile border + label (top-left)
+void DisplayManager::drawTileFrame(int x, int y, int w, int h, const char* label, uint16_t color) {
+  if (frameColor) color = frameColor;  // Style from the layout descriptor
+  tft->drawRect(x, y, w, h, color);
   tft->setTextSize(1);
-  tft->setTextColor(COLOR_CPU);
-  tft->setCursor(x + 2, y + 2);
-  tft->print(F("CPU"));
-  
-  int centerY = y + (h / 2) - 8;
-  tft->setTextSize(2);
-  tft->setTextColor(COLOR_TEXT);
-  tft->setCursor(x + 4, centerY);
-  tft->print((int)data.cpuLoad);
+  tft->setTextColor(color);
+  tft->setCursor(x + DashboardLayout::PAD, y + DashboardLayout::PAD);
+  tft->print(label);
+}
+
+// Helper: large percentage value centered vertically
+void DisplayManager::drawTilePercent(int x, int y, int h, int percent) {
+  char text[8];
+  Fixed10::formatInt(text, sizeof(text), percent);
+  drawBigNumber(x + 4, DashboardLayout::centerLine(y, h), text);
   tft->setTextSize(1);
+  tft->setTextColor(COLOR_TEXT);
   tft->print(F("%"));
+}
+
+// Helper: "2/3" page marker (top-right) on tiles that rotate
+void DisplayManager::drawTilePager(int x, int y, int w, uint8_t page, uint8_t pages) {
+  if (pages <= 1) return;
+  char text[8];
+  int len = snprintf(text, sizeof(text), "%u/%u", page + 1, pages);
+  tft->setTextSize(1);
+  tft->setTextColor(COLOR_TEXT);
+  tft->setCursor(DashboardLayout::alignRight(x, w, len), y + DashboardLayout::PAD);
+  tft->print(text);
+}
+
+// Helper function to draw CPU tile
+void DisplayManager::drawTile_CPU(int x, int y, int w, int h, const SystemData& data) {
+  drawTileFrame(x, y, w, h, "CPU", COLOR_CPU);
+  drawTilePercent(x, y, h, Fixed10::toInt(data.cpuLoad));
   
   tft->setTextSize(1);
   tft->setTextColor(ST77XX_YELLOW);
-  tft->setCursor(x + w - 24, y + h - 10);
-  tft->print((int)data.cpuTemp);
+  tft->setCursor(DashboardLayout::alignRight(x, w, 3), DashboardLayout::bottomLine(y, h));
+  tft->print(Fixed10::toInt(data.cpuTemp));
   tft->print(F("C"));
 }
 
 // Helper function to draw RAM tile
 void DisplayManager::drawTile_RAM(int x, int y, int w, int h, const SystemData& data) {
-  tft->drawRect(x, y, w, h, COLOR_RAM);
-  tft->setTextSize(1);
-  tft->setTextColor(COLOR_RAM);
-  tft->setCursor(x + 2, y + 2);
-  tft->print(F("RAM"));
+  drawTileFrame(x, y, w, h, "RAM", COLOR_RAM);
   
-  float ramPercent = (data.ramTotal > 0) ? (data.ramUsed / data.ramTotal * 100.0) : 0;
-  int centerY = y + (h / 2) - 8;
-  tft->setTextSize(2);
-  tft->setTextColor(COLOR_TEXT);
-  tft->setCursor(x + 4, centerY);
-  tft->print((int)ramPercent);
-  tft->setTextSize(1);
-  tft->print(F("%"));
+  drawTilePercent(x, y, h, Fixed10::toInt(Fixed10::percent(data.ramUsed, data.ramTotal)));
   
   tft->setTextSize(1);
   tft->setTextColor(ST77XX_CYAN);
-  tft->setCursor(x + w - 28, y + h - 10);
-  tft->print(data.ramUsed, 1);
+  tft->setCursor(DashboardLayout::alignRight(x, w, 5), DashboardLayout::bottomLine(y, h));
+  printFixed(data.ramUsed, true);
   tft->print(F("G"));
 }
 
 // Helper function to draw GPU tile
 void DisplayManager::drawTile_GPU(int x, int y, int w, int h, const SystemData& data) {
-  tft->drawRect(x, y, w, h, COLOR_GPU);
-  tft->setTextSize(1);
-  tft->setTextColor(COLOR_GPU);
-  tft->setCursor(x + 2, y + 2);
-  tft->print(F("GPU"));
-  
-  int centerY = y + (h / 2) - 8;
-  tft->setTextSize(2);
-  tft->setTextColor(COLOR_TEXT);
-  tft->setCursor(x + 4, centerY);
-  tft->print((int)data.gpuLoad);
-  tft->setTextSize(1);
-  tft->print(F("%"));
+  drawTileFrame(x, y, w, h, "GPU", COLOR_GPU);
+  drawTilePercent(x, y, h, Fixed10::toInt(data.gpuLoad));
   
   tft->setTextSize(1);
   tft->setTextColor(ST77XX_YELLOW);
-  tft->setCursor(x + w - 24, y + h - 10);
-  tft->print((int)data.gpuTemp);
+  tft->setCursor(DashboardLayout::alignRight(x, w, 3), DashboardLayout::bottomLine(y, h));
+  tft->print(Fixed10::toInt(data.gpuTemp));
   tft->print(F("C"));
 }
 
 // Helper function to draw VRAM tile
 void DisplayManager::drawTile_VRAM(int x, int y, int w, int h, const SystemData& data) {
-  float vramPercent = (data.gpuMemUsed / (float)data.gpuMemTotal * 100.0);
-  tft->drawRect(x, y, w, h, COLOR_VRAM);
-  tft->setTextSize(1);
-  tft->setTextColor(COLOR_VRAM);
-  tft->setCursor(x + 2, y + 2);
-  tft->print(F("VRAM"));
-  
-  int centerY = y + (h / 2) - 8;
-  tft->setTextSize(2);
-  tft->setTextColor(COLOR_TEXT);
-  tft->setCursor(x + 4, centerY);
-  tft->print((int)vramPercent);
-  tft->setTextSize(1);
-  tft->print(F("%"));
+  drawTileFrame(x, y, w, h, "VRAM", COLOR_VRAM);
+  drawTilePercent(x, y, h, Fixed10::toInt(Fixed10::percent(data.gpuMemUsed, data.gpuMemTotal)));
   
   tft->setTextSize(1);
   tft->setTextColor(ST77XX_CYAN);
+  int16_t bottomY = DashboardLayout::bottomLine(y, h);
   if (data.gpuMemUsed < 10000) {
-    tft->setCursor(x + w - 32, y + h - 10);
+    tft->setCursor(DashboardLayout::alignRight(x, w, 5), bottomY);
     tft->print(data.gpuMemUsed);
     tft->print(F("M"));
   } else {
-    tft->setCursor(x + w - 28, y + h - 10);
+    tft->setCursor(DashboardLayout::alignRight(x, w, 4), bottomY);
     tft->print(data.gpuMemUsed / 1024);
     tft->print(F("G"));
   }
 }
 
-// Helper function to draw Storage tile
+// Helper function to draw Storage tile (pages through disks when they don't fit)
 void DisplayManager::drawTile_Storage(int x, int y, int w, int h, const SystemData& data) {
-  tft->drawRect(x, y, w, h, COLOR_DISK);
-  tft->setTextSize(1);
-  tft->setTextColor(COLOR_DISK);
-  tft->setCursor(x + 2, y + 2);
-  tft->print(F("SSD"));
-  
   // For narrow tiles (landscape), use vertical layout
   // For wide tiles (portrait full-width), use horizontal layout
   bool narrowTile = (w < 100);
+  drawTileFrame(x, y, w, h, narrowTile ? "SSD" : "STORAGE", COLOR_DISK);
+  
+  uint8_t rows = diskRowsPerTile(w, h);
+  uint8_t pages = (data.diskCount + rows - 1) / rows;
+  uint8_t page = tilePage % pages;
+  uint8_t first = page * rows;
+  uint8_t last = first + rows;
+  if (last > data.diskCount) last = data.diskCount;
+  drawTilePager(x, y, w, page, pages);
   
-  if (narrowTile) {
-    // Vertical layout for narrow tiles (landscape mode)
-    int lineY = y + 12;
+  int lineY = y + 12;
+  int tempX = DashboardLayout::alignRight(x, w, 3);
+  
+  for (uint8_t i = first; i < last; i++) {
+    const DiskInfo& disk = data.disks[i];
     
-    // D1 load
     tft->setTextColor(COLOR_TEXT);
-    tft->setCursor(x + 2, lineY);
-    tft->print(F("D1:"));
-    tft->print((int)data.disk1Load);
+    tft->setCursor(x + (narrowTile ? 2 : 4), lineY);
+    tft->print(F("D"));
+    tft->print(i + 1);
+    tft->print(F(":"));
+    tft->print(Fixed10::toInt(disk.load));
     tft->print(F("%"));
     
-    // D1 temp below
-    tft->setTextColor(ST77XX_YELLOW);
-    tft->setCursor(x + 2, lineY + 10);
-    tft->print((int)data.disk1Temp);
-    tft->print(F("C"));
-    
-    if (data.disk2Name.length() > 0) {
-      lineY += 20;
-      // D2 load
-      tft->setTextColor(COLOR_TEXT);
-      tft->setCursor(x + 2, lineY);
-      tft->print(F("D2:"));
-      tft->print((int)data.disk2Load);
-      tft->print(F("%"));
-      
-      // D2 temp below
+    if (narrowTile) {
+      // Temp below
       tft->setTextColor(ST77XX_YELLOW);
       tft->setCursor(x + 2, lineY + 10);
-      tft->print((int)data.disk2Temp);
+      tft->print(Fixed10::toInt(disk.temp));
       tft->print(F("C"));
-    }
-  } else {
-    // Horizontal layout for wide tiles (portrait mode)
-    int centerY = y + (h / 2) - 4;
-    
-    tft->setTextColor(COLOR_TEXT);
-    tft->setCursor(x + 4, centerY);
-    tft->print(F("D1:"));
-    tft->print((int)data.disk1Load);
-    tft->print(F("%"));
-    
-    tft->setTextColor(ST77XX_YELLOW);
-    tft->setCursor(x + w - 28, centerY);
-    tft->print((int)data.disk1Temp);
-    tft->print(F("C"));
-    
-    if (data.disk2Name.length() > 0) {
-      tft->setTextColor(COLOR_TEXT);
-      tft->setCursor(x + 4, centerY + 10);
-      tft->print(F("D2:"));
-      tft->print((int)data.disk2Load);
-      tft->print(F("%"));
+      lineY += 20;
+    } else {
+      // Name between load and temp when there is room
+      int nameX = x + 4 + 9 * DashboardLayout::FONT_W;
+      int room = (tempX - nameX) / DashboardLayout::FONT_W - 1;
+      if (room >= 4) {
+        tft->setTextColor(COLOR_DISK);
+        tft->setCursor(nameX, lineY);
+        for (int c = 0; disk.name[c] && c < room; c++) {
+          tft->print(disk.name[c]);
+        }
+      }
       
       tft->setTextColor(ST77XX_YELLOW);
-      tft->setCursor(x + w - 28, centerY + 10);
-      tft->print((int)data.disk2Temp);
+      tft->setCursor(tempX, lineY);
+      tft->print(Fixed10::toInt(disk.temp));
       tft->print(F("C"));
+      lineY += 10;
     }
   }
-  
 }
 
 // Helper function to draw combined Network tile (UP+DOWN in one tile)
 void DisplayManager::drawTile_Network_Combined(int x, int y, int w, int h, const SystemData& data) {
-  tft->drawRect(x, y, w, h, COLOR_NET);
-  tft->setTextSize(1);
-  tft->setTextColor(COLOR_NET);
-  tft->setCursor(x + 2, y + 2);
-  tft->print(F("NET"));
+  drawTileFrame(x, y, w, h, "NET", COLOR_NET);
+  
+  // Several NICs: one per page
+  uint8_t page = tilePage % data.nicCount;
+  const NicInfo& nic = data.nics[page];
+  drawTilePager(x, y, w, page, data.nicCount);
   
-  int centerY = y + (h / 2) - 8;
+  int centerY = DashboardLayout::centerLine(y, h);
   
   // Upload
   tft->setTextColor(ST77XX_GREEN);
   tft->setCursor(x + 2, centerY);
   tft->print(F("U:"));
   tft->setTextColor(COLOR_TEXT);
-  if (data.netUp < 10) {
-    tft->print(data.netUp, 1);
-  } else {
-    tft->print((int)data.netUp);
-  }
+  printFixed(nic.up, nic.up < Fixed10::fromInt(10));
   
   // Download
   tft->setTextColor(ST77XX_GREEN);
   tft->setCursor(x + 2, centerY + 10);
   tft->print(F("D:"));
   tft->setTextColor(COLOR_TEXT);
-  if (data.netDown < 10) {
-    tft->print(data.netDown, 1);
-  } else {
-    tft->print((int)data.netDown);
-  }
+  printFixed(nic.down, nic.down < Fixed10::fromInt(10));
   
   // Unit
   tft->setTextSize(1);
   tft->setTextColor(ST77XX_GREEN);
-  tft->setCursor(x + w - 28, y + h - 10);
+  tft->setCursor(DashboardLayout::alignRight(x, w, 4), DashboardLayout::bottomLine(y, h));
   tft->print(F("Mb/s"));
 }
 
-void DisplayManager::clear() {
+// Helper function to draw a single network rate tile (portrait UP / DOWN)
+void DisplayManager::drawTile_NetRate(int x, int y, int w, int h, const char* label, const SystemData& data, bool up) {
+  drawTileFrame(x, y, w, h, label, COLOR_NET);
+  
+  uint8_t page = tilePage % data.nicCount;
+  fixed10_t rate = up ? data.nics[page].up : data.nics[page].down;
+  drawTilePager(x, y, w, page, data.nicCount);
+  
+  // Speed (large, centered) - one decimal below 10 Mb/s
+  char text[12];
+  Fixed10::format(text, sizeof(text), rate, rate < Fixed10::fromInt(10));
+  drawBigNumber(x + 4, DashboardLayout::centerLine(y, h), text);
+  
+  // Unit (bottom left)
+  tft->setTextSize(1);
+  tft->setTextColor(ST77XX_GREEN);
+  tft->setCursor(x + DashboardLayout::PAD, DashboardLayout::bottomLine(y, h));
+  tft->print(F("Mb/s"));
+}
+
+// Heatmap colors, idle -> busy (8 levels, 12.5% each)
+static const uint16_t HEAT_COLORS[] PROGMEM = {
+  0x0010, 0x001F, 0x041F, 0x07E0, 0x87E0, 0xFFE0, 0xFC00, 0xF800
+};
+static constexpr uint8_t HEAT_LEVELS = sizeof(HEAT_COLORS) / sizeof(HEAT_COLORS[0]);
+
+// Helper function to draw the per-core heatmap tile (one cell per logical CPU).
+// Cells keep their last color level; only cells whose level changed are repainted.
+void DisplayManager::drawTile_Cores(int x, int y, int w, int h, const SystemData& data) {
+  if (heatCount != data.coreCount) {
+    drawTileFrame(x, y, w, h, "CORE", COLOR_CPU);
+    memset(heatLevel, 0xFF, sizeof(heatLevel));
+    heatCount = data.coreCount;
+  }
+  
+  // Average clock top-right ("4.2G"), when the tile is wide enough
+  if (w >= 9 * DashboardLayout::FONT_W + 2 * DashboardLayout::PAD) {
+    int16_t clockX = DashboardLayout::alignRight(x, w, 4);
+    tft->fillRect(clockX, y + DashboardLayout::PAD, 4 * DashboardLayout::FONT_W, DashboardLayout::FONT_H, COLOR_BG);
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < data.coreCount; i++) sum += data.coreClock[i];
+    uint16_t avg = (sum + data.coreCount / 2) / data.coreCount;  // 100 MHz units
+    if (avg > 0 && avg < 100) {
+      char text[8];
+      snprintf(text, sizeof(text), "%u.%uG", avg / 10, avg % 10);
+      tft->setTextSize(1);
+      tft->setTextColor(COLOR_TEXT);
+      tft->setCursor(DashboardLayout::alignRight(x, w, strlen(text)), y + DashboardLayout::PAD);
+      tft->print(text);
+    }
+  }
+  
+  // Largest square cell that fits every core below the label
+  int16_t areaX = x + DashboardLayout::PAD, areaY = y + 12;
+  int16_t areaW = w - 2 * DashboardLayout::PAD, areaH = h - 14;
+  uint8_t cols = 1;
+  int16_t cell = 0;
+  for (uint16_t c = 1; c <= data.coreCount; c++) {
+    uint8_t rows = (data.coreCount + c - 1) / c;
+    int16_t size = min(areaW / c, areaH / rows);
+    if (size > cell) {
+      cell = size;
+      cols = c;
+    }
+  }
+  if (cell < 1) cell = 1;
+  uint8_t rows = (data.coreCount + cols - 1) / cols;
+  areaX += (areaW - cols * cell) / 2;
+  areaY += (areaH - rows * cell) / 2;
+  int16_t fill = cell >= 4 ? cell - 1 : cell;  // 1px gap once cells are big enough
+  
+  for (uint8_t i = 0; i < data.coreCount; i++) {
+    uint8_t load = data.coreLoad[i] > 100 ? 100 : data.coreLoad[i];
+    uint8_t level = load * HEAT_LEVELS / 101;
+    if (level == heatLevel[i]) continue;
+    heatLevel[i] = level;
+    tft->fillRect(areaX + (i % cols) * cell, areaY + (i / cols) * cell, fill, fill,
+                  pgm_read_word(&HEAT_COLORS[level]));
+  }
+}
+
+// Pushed metric tile: name as the label, value large ("--" when missing or stale)
+void DisplayManager::drawTile_Push(int x, int y, int w, int h, const char* metric) {
+  char label[PUSH_NAME_LEN];
+  size_t maxChars = (w - DashboardLayout::PAD * 2) / DashboardLayout::FONT_W;
+  if (maxChars >= sizeof(label)) maxChars = sizeof(label) - 1;
+  strncpy(label, metric, maxChars);
+  label[maxChars] = '\0';
+  drawTileFrame(x, y, w, h, label, COLOR_HEADER);
+  
+  char text[14] = "--";
+  fixed10_t value;
+  if (pushed && pushed->get(metric, value, millis())) {
+    // One decimal while it fits, whole numbers from 100 up
+    Fixed10::format(text, sizeof(text), value, value > -1000 && value < 1000);
+  }
+  drawBigNumber(x + 4, DashboardLayout::centerLine(y, h), text);
+}
+
+void DisplayManager::clearScreen() {
   tft->fillScreen(COLOR_BG);
+  heatCount = 0;
+}
+
+void DisplayManager::clear() {
+  clearScreen();
 }
 
 void DisplayManager::turnOn() {
   displayOn = true;
-  digitalWrite(ledPin, HIGH);
-  tft->fillScreen(COLOR_BG);
+  backlight.wake();
+  clearScreen();
 }
 
 void DisplayManager::turnOff() {
   displayOn = false;
-  digitalWrite(ledPin, LOW);
-  tft->fillScreen(COLOR_BG);
+  backlight.setPulse(false);
+  backlight.sleep();
+  clearScreen();
+}
+
+void DisplayManager::updateBacklight() {
+  backlight.update();
+  
+  // Alert flash: invert the panel (one SPI command, no redraw) a few times
+  if (flashUntil == 0) return;
+  unsigned long now = millis();
+  if ((long)(now - flashUntil) >= 0) {
+    flashUntil = 0;
+    if (inverted) {
+      inverted = false;
+      tft->invertDisplay(false);
+    }
+  } else if ((long)(now - flashToggleAt) >= 0) {
+    inverted = !inverted;
+    tft->invertDisplay(inverted);
+    flashToggleAt = now + 250;
+  }
+}
+
+void DisplayManager::flashAlert() {
+  if (!displayOn) return;
+  unsigned long now = millis();
+  flashUntil = now + ALERT_FLASH_MS;
+  if (flashUntil == 0) flashUntil = 1;  // 0 means idle
+  flashToggleAt = now;
+}
+
+void DisplayManager::setAlertPulse(bool on) {
+  backlight.setPulse(on && displayOn);
 }
 
 void DisplayManager::toggle() {
   displayOn ? turnOff() : turnOn();
 }
 
+bool DisplayManager::noteActivity() {
+  bool wasOff = !isOn();
+  displayOn = true;
+  backlight.noteActivity();
+  return wasOff;
+}
+
 bool DisplayManager::isOn() {
-  return displayOn;
+  return displayOn && !backlight.isOff();
 }
 
 void DisplayManager::drawText(int16_t x, int16_t y, const char* text, uint16_t color, uint8_t size) {
+  heatCount = 0;  // Drawn over the dashboard - next dashboard frame starts clean
   tft->setCursor(x, y);
   tft->setTextColor(color);
   tft->setTextSize(size);
@@ -670,73 +741,29 @@ void DisplayManager::drawText(int16_t x, int16_t y, String text, uint16_t color,
   drawText(x, y, text.c_str(), color, size);
 }
 
-// Draw gaming-style progress bar with gradient effect
-void DisplayManager::drawProgressBar(int16_t x, int16_t y, int16_t w, int16_t h, float percent, uint16_t color, uint16_t bgColor) {
-  if (percent > 100) percent = 100;
-  if (percent < 0) percent = 0;
-  
-  // Draw border with accent
-  tft->drawRect(x, y, w, h, color);
-  
-  // Fill background
-  tft->fillRect(x + 1, y + 1, w - 2, h - 2, bgColor);
-  
-  // Calculate filled width
-  int fillWidth = (int)((w - 2) * percent / 100.0);
-  
-  if (fillWidth > 0) {
-    // Create gradient effect for gaming look
-    for (int i = 0; i < fillWidth; i++) {
-      // Brightness varies from 60% to 100% for depth effect
-      float brightness = 0.6 + (0.4 * i / (float)fillWidth);
-      
-      uint16_t barColor = color;
-      
-      // Apply brightness (darken color at start)
-      if (brightness < 1.0) {
-        uint8_t r = ((color >> 11) & 0x1F) * brightness;
-        uint8_t g = ((color >> 5) & 0x3F) * brightness;
-        uint8_t b = (color & 0x1F) * brightness;
-        barColor = (r << 11) | (g << 5) | b;
-      }
-      
-      tft->drawFastVLine(x + 1 + i, y + 1, h - 2, barColor);
-    }
-    
-    // Add highlight line at top for 3D effect
-    if (h > 4) {
-      tft->drawFastHLine(x + 1, y + 1, fillWidth, ST77XX_WHITE);
-    }
+void DisplayManager::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  heatCount = 0;
+  tft->fillRect(x, y, w, h, color);
+}
+
+// Draw a large (size 2) readout - cached glyph blit, GFX fallback otherwise
+void DisplayManager::drawBigNumber(int16_t x, int16_t y, const char* text) {
+  if (!plainRendering && glyphs.drawString(tft, x, y, text, COLOR_TEXT, COLOR_BG)) {
+    tft->setCursor(x + glyphs.width(text), y);
+    return;
   }
   
-  // Warning colors at high usage
-  if (percent > 90) {
-    // Flash red border for critical
-    tft->drawRect(x, y, w, h, ST77XX_RED);
-  } else if (percent > 75) {
-    // Yellow border for warning
-    tft->drawRect(x, y, w, h, ST77XX_YELLOW);
-  }
+  tft->setTextSize(2);
+  tft->setTextColor(COLOR_TEXT);
+  tft->setCursor(x, y);
+  tft->print(text);
 }
 
-// Draw temperature gauge (circular indicator)
-void DisplayManager::drawTemperatureGauge(int16_t x, int16_t y, int16_t size, float temp, float maxTemp, uint16_t color) {
-  float percent = (temp / maxTemp) * 100.0;
-  if (percent > 100) percent = 100;
-  
-  // Draw outer circle
-  tft->drawCircle(x, y, size, color);
-  
-  // Fill based on temperature
-  int fillRadius = (int)(size * percent / 100.0);
-  tft->fillCircle(x, y, fillRadius, color);
-  
-  // Add warning colors
-  if (percent > 80) {
-    tft->drawCircle(x, y, size, ST77XX_RED);
-  } else if (percent > 60) {
-    tft->drawCircle(x, y, size, ST77XX_YELLOW);
-  }
+// Print a fixed-point value at the cursor (integer-only formatting)
+void DisplayManager::printFixed(fixed10_t value, bool decimal) {
+  char text[14];
+  Fixed10::format(text, sizeof(text), value, decimal);
+  tft->print(text);
 }
 
 // Draw centered text (useful for headers)
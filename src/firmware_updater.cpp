@@ -0,0 +1,241 @@
+/*
+ * Firmware Updater Implementation
+ */
+
+#include "config.h"
+#include "version.h"
+#include "firmware_updater.h"
+#include "display_manager.h"
+#include <ArduinoJson.h>
+
+FirmwareUpdater::FirmwareUpdater()
+  : baseUrl(""), state(FW_IDLE), streaming(false), streamOffset(0), retries(0),
+    checkTimer(0), checkDelay(FW_FIRST_CHECK_DELAY), lastByteMs(0), display(nullptr) {
+  snprintf(deviceId, sizeof(deviceId), "hwmon-%06x", ESP.getChipId());
+  targetVersion[0] = '\0';
+  imagePath[0] = '\0';
+}
+
+void FirmwareUpdater::setServer(const String& host, uint16_t port) {
+  baseUrl = "http://" + host + ":" + String(port);
+}
+
+void FirmwareUpdater::scheduleNextCheck(unsigned long delayMs) {
+  checkTimer = millis();
+  checkDelay = delayMs;
+}
+
+void FirmwareUpdater::handle() {
+  if (!FW_UPDATE_ENABLED || baseUrl.length() == 0) return;
+  
+  if (state == FW_IDLE) {
+    if (millis() - checkTimer < checkDelay) return;
+    
+    scheduleNextCheck(FW_CHECK_INTERVAL);
+    if (checkManifest()) {
+      state = FW_DOWNLOADING;
+      retries = 0;
+      lastByteMs = millis();
+      report("downloading");
+    }
+    return;
+  }
+  
+  if (state != FW_DOWNLOADING) return;
+  
+  if (!streaming) {
+    // Back off 1s, 2s, 3s... between reconnects
+    if (millis() - lastByteMs < 1000UL * retries) return;
+    
+    if (!openStream()) {
+      lastByteMs = millis();
+      if (++retries > MAX_RETRIES) giveUp("server unreachable");
+      return;
+    }
+  }
+  
+  pump();
+}
+
+// GET /firmware/manifest?device=ID&version=X - bridge records the version we
+// run and answers whether this device is in the current rollout
+bool FirmwareUpdater::checkManifest() {
+  String url = baseUrl + F("/firmware/manifest?device=") + deviceId + F("&version=") + F(PROJECT_VERSION);
+  
+  HTTPClient check;
+  check.begin(client, url);
+  check.setTimeout(3000);
+  
+  int httpCode = check.GET();
+  if (httpCode != HTTP_CODE_OK) {
+    check.end();
+    return false;
+  }
+  
+  StaticJsonDocument<384> doc;
+  DeserializationError error = deserializeJson(doc, check.getString());
+  check.end();
+  if (error || !(doc["update"] | false)) return false;
+  
+  const char* version = doc["version"] | "";
+  const char* path = doc["url"] | "";
+  const char* sha256 = doc["sha256"] | "";
+  uint32_t size = doc["size"] | 0;
+  uint32_t rawSize = doc["raw_size"] | 0;  // Set for .bin.gz images
+  
+  // Never "update" to what we already run (guards against a stale manifest)
+  if (*version == '\0' || *path == '\0' || strcmp(version, PROJECT_VERSION) == 0) {
+    return false;
+  }
+  
+  strlcpy(targetVersion, version, sizeof(targetVersion));
+  strlcpy(imagePath, path, sizeof(imagePath));
+  
+  if (!session.begin(size, sha256, rawSize)) {
+    report("failed", session.getError());
+    return false;
+  }
+  
+  DEBUG_PRINTF("[FW] Update available: v%s (%u bytes)\n", targetVersion, size);
+  return true;
+}
+
+bool FirmwareUpdater::openStream() {
+  http.begin(client, baseUrl + imagePath);
+  http.setTimeout(5000);
+  
+  // Resume where the last connection dropped
+  uint32_t offset = session.getOffset();
+  if (offset > 0) {
+    char range[24];
+    snprintf(range, sizeof(range), "bytes=%u-", offset);
+    http.addHeader(F("Range"), range);
+  }
+  
+  int httpCode = http.GET();
+  if (httpCode == HTTP_CODE_PARTIAL_CONTENT) {
+    streamOffset = offset;
+  } else if (httpCode == HTTP_CODE_OK) {
+    streamOffset = 0;  // Range ignored - OtaSession skips what it already has
+  } else {
+    DEBUG_PRINTF("[FW] Download failed: HTTP %d\n", httpCode);
+    http.end();
+    return false;
+  }
+  
+  DEBUG_PRINTF("[FW] Streaming from %u\n", streamOffset);
+  streaming = true;
+  lastByteMs = millis();
+  return true;
+}
+
+void FirmwareUpdater::closeStream() {
+  if (streaming) {
+    http.end();
+    streaming = false;
+  }
+}
+
+// Move at most STEP_BYTES per call so the dashboard loop keeps its pace
+void FirmwareUpdater::pump() {
+  WiFiClient* stream = http.getStreamPtr();
+  uint8_t buf[READ_BYTES];
+  size_t budget = STEP_BYTES;
+  
+  while (budget > 0 && stream != nullptr && stream->available() > 0) {
+    size_t want = min(min((size_t)stream->available(), budget), READ_BYTES);
+    size_t n = stream->readBytes(buf, want);
+    if (n == 0) break;
+    
+    OtaWriteResult result = session.write(streamOffset, buf, n);
+    streamOffset += n;
+    budget -= n;
+    lastByteMs = millis();
+    
+    if (result == OTA_WRITE_ERROR) {
+      giveUp(session.getError());
+      return;
+    }
+    if (result == OTA_WRITE_GAP) {
+      closeStream();  // Shouldn't happen - reconnect with a fresh Range
+      return;
+    }
+  }
+  
+  if (session.getState() == OTA_VERIFIED) {
+    closeStream();
+    state = FW_READY;
+    
+    char detail[24];
+    uint32_t rate = session.getEffectiveRateKBps10();
+    snprintf(detail, sizeof(detail), "%u.%u KB/s", rate / 10, rate % 10);
+    report("verified", detail);
+    DEBUG_PRINTF("[FW] v%s verified, rebooting\n", targetVersion);
+    showRebootScreen();
+    delay(1000);
+    ESP.restart();
+    return;
+  }
+  
+  bool dropped = stream == nullptr || (!stream->connected() && stream->available() == 0);
+  if (dropped || millis() - lastByteMs > FW_STALL_TIMEOUT) {
+    DEBUG_PRINTF("[FW] Stream lost at %u/%u\n", session.getOffset(), session.getSize());
+    closeStream();
+    lastByteMs = millis();
+    if (++retries > MAX_RETRIES) giveUp("stalled");
+  }
+}
+
+void FirmwareUpdater::giveUp(const char* reason) {
+  closeStream();
+  report("failed", reason);
+  session.abort();
+  state = FW_IDLE;
+  scheduleNextCheck(FW_CHECK_INTERVAL);
+}
+
+void FirmwareUpdater::abort() {
+  if (state != FW_DOWNLOADING) return;
+  
+  DEBUG_PRINTLN(F("[FW] Download aborted"));
+  closeStream();
+  session.abort();
+  state = FW_IDLE;
+  scheduleNextCheck(FW_FIRST_CHECK_DELAY);
+}
+
+// POST /firmware/report - per-device rollout status on the bridge
+void FirmwareUpdater::report(const char* status, const char* detail) {
+  String url = baseUrl + F("/firmware/report?device=") + deviceId +
+               F("&version=") + F(PROJECT_VERSION) +
+               F("&target=") + targetVersion +
+               F("&status=") + status + F("&detail=");
+  for (const char* p = detail; *p; p++) {
+    url += (*p == ' ') ? '+' : *p;
+  }
+  
+  HTTPClient post;
+  post.begin(client, url);
+  post.setTimeout(2000);
+  post.POST("");
+  post.end();
+}
+
+void FirmwareUpdater::showRebootScreen() {
+  if (display == nullptr) return;
+  
+  display->turnOn();
+  display->clear();
+  display->drawText(10, 40, "FIRMWARE", ST77XX_CYAN, 2);
+  display->drawText(10, 60, "UPDATED", ST77XX_CYAN, 2);
+  
+  char line[24];
+  snprintf(line, sizeof(line), "v%s%s", targetVersion, session.isCompressed() ? " (gz)" : "");
+  display->drawText(10, 90, line, ST77XX_WHITE, 1);
+  
+  // Effective rate = firmware bytes/s (higher than the wire rate for .bin.gz)
+  uint32_t rate = session.getEffectiveRateKBps10();
+  snprintf(line, sizeof(line), "%u.%u KB/s", rate / 10, rate % 10);
+  display->drawText(10, 105, line, ST77XX_WHITE, 1);
+  display->drawText(10, 120, "Rebooting...", ST77XX_YELLOW, 1);
+}
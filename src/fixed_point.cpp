@@ -0,0 +1,89 @@
+/*
+ * Fixed-Point Helpers Implementation
+ */
+
+#include "fixed_point.h"
+
+size_t Fixed10::formatInt(char* buf, size_t len, int32_t v) {
+  if (len == 0) return 0;
+  
+  char tmp[12];
+  uint8_t n = 0;
+  bool negative = v < 0;
+  uint32_t u = negative ? (uint32_t)(-(int64_t)v) : (uint32_t)v;
+  
+  do {
+    tmp[n++] = '0' + (u % 10);
+    u /= 10;
+  } while (u > 0);
+  if (negative) tmp[n++] = '-';
+  
+  size_t written = 0;
+  while (n > 0 && written < len - 1) {
+    buf[written++] = tmp[--n];
+  }
+  buf[written] = '\0';
+  return written;
+}
+
+size_t Fixed10::format(char* buf, size_t len, fixed10_t v, bool decimal) {
+  if (!decimal) {
+    return formatInt(buf, len, toInt(v));
+  }
+  
+  // Keep the sign for -0.x values
+  size_t written = 0;
+  if (v < 0 && v > -FIXED10_SCALE && len > 1) {
+    buf[written++] = '-';
+  }
+  written += formatInt(buf + written, len - written, toInt(v));
+  
+  if (written + 2 < len) {
+    int32_t frac = v % FIXED10_SCALE;
+    buf[written++] = '.';
+    buf[written++] = '0' + (frac < 0 ? -frac : frac);
+    buf[written] = '\0';
+  }
+  return written;
+}
+
+fixed10_t Fixed10::percent(int32_t part, int32_t total) {
+  if (total <= 0 || part <= 0) return 0;
+  if (part >= total) return 1000;
+  
+  // part < total here; part * 1000 + total / 2 must fit in int32, so halve both
+  // past 2M (RAM in tenths of a GB or VRAM in MB never gets there)
+  const int32_t RANGE_MAX = 2000000;
+  while (total > RANGE_MAX) {
+    part /= 2;
+    total /= 2;
+  }
+  return (part * 1000 + total / 2) / total;
+}
+
+bool Fixed10::parse(const char* s, fixed10_t& out) {
+  if (!s) return false;
+  bool negative = (*s == '-');
+  if (*s == '-' || *s == '+') s++;
+  if (*s < '0' || *s > '9') return false;
+  
+  // Largest whole part whose x10 plus a tenth still fits in int32
+  const int32_t WHOLE_MAX = (INT32_MAX - 9) / FIXED10_SCALE;
+  int32_t whole = 0;
+  while (*s >= '0' && *s <= '9') {
+    int32_t digit = *s++ - '0';
+    if (whole > (WHOLE_MAX - digit) / 10) return false;
+    whole = whole * 10 + digit;
+  }
+  int32_t tenth = 0;
+  if (*s == '.') {
+    s++;
+    if (*s >= '0' && *s <= '9') tenth = *s - '0';
+    while (*s >= '0' && *s <= '9') s++;
+  }
+  if (*s != '\0') return false;
+  
+  fixed10_t v = whole * FIXED10_SCALE + tenth;
+  out = negative ? -v : v;
+  return true;
+}
@@ -0,0 +1,160 @@
+/*
+ * Glyph Cache Implementation
+ */
+
+#include "config.h"
+#include "glyph_cache.h"
+
+// Subset of the classic 5x7 GFX font (column-major, LSB = top row)
+static const char GLYPH_CHARS[] = "0123456789.-%";
+static const uint8_t GLYPH_FONT[][5] PROGMEM = {
+  {0x3E, 0x51, 0x49, 0x45, 0x3E},  // 0
+  {0x00, 0x42, 0x7F, 0x40, 0x00},  // 1
+  {0x72, 0x49, 0x49, 0x49, 0x46},  // 2
+  {0x21, 0x41, 0x49, 0x4D, 0x33},  // 3
+  {0x18, 0x14, 0x12, 0x7F, 0x10},  // 4
+  {0x27, 0x45, 0x45, 0x45, 0x39},  // 5
+  {0x3C, 0x4A, 0x49, 0x49, 0x31},  // 6
+  {0x41, 0x21, 0x11, 0x09, 0x07},  // 7
+  {0x36, 0x49, 0x49, 0x49, 0x36},  // 8
+  {0x46, 0x49, 0x49, 0x29, 0x1E},  // 9
+  {0x00, 0x60, 0x60, 0x00, 0x00},  // .
+  {0x08, 0x08, 0x08, 0x08, 0x08},  // -
+  {0x23, 0x13, 0x08, 0x64, 0x62},  // %
+};
+
+static_assert(sizeof(GLYPH_FONT) / sizeof(GLYPH_FONT[0]) == GlyphCache::GLYPH_COUNT,
+              "Glyph font table out of sync with GLYPH_COUNT");
+
+GlyphCache::GlyphCache() : ready(false) {
+  memset(masks, 0, sizeof(masks));
+}
+
+void GlyphCache::begin() {
+  for (uint8_t i = 0; i < GLYPH_COUNT; i++) {
+    buildGlyph(i);
+  }
+  ready = true;
+
+  DEBUG_PRINT(F("[GLYPH] Cache ready: "));
+  DEBUG_PRINT(sizeof(masks));
+  DEBUG_PRINTLN(F(" bytes"));
+}
+
+int8_t GlyphCache::glyphIndex(char c) {
+  const char* p = strchr(GLYPH_CHARS, c);
+  return (p && c != '\0') ? (int8_t)(p - GLYPH_CHARS) : -1;
+}
+
+bool GlyphCache::canDraw(const char* text) const {
+  if (!ready) return false;
+
+  size_t len = strlen(text);
+  if (len == 0 || len > MAX_CHARS) return false;
+
+  for (size_t i = 0; i < len; i++) {
+    if (glyphIndex(text[i]) < 0) return false;
+  }
+  return true;
+}
+
+void GlyphCache::setAlpha(uint8_t index, uint8_t px, uint8_t py, uint8_t alpha) {
+  uint16_t bit = (py * CELL_W + px) * 2;
+  uint8_t& b = masks[index][bit >> 3];
+  b = (b & ~(0x03 << (bit & 7))) | ((alpha & 0x03) << (bit & 7));
+}
+
+uint8_t GlyphCache::getAlpha(uint8_t index, uint8_t px, uint8_t py) const {
+  uint16_t bit = (py * CELL_W + px) * 2;
+  return (masks[index][bit >> 3] >> (bit & 7)) & 0x03;
+}
+
+// Scale one 5x7 glyph by SCALE. With smoothing, empty sub-pixels sitting in
+// the corner between two set neighbours get half alpha (EPX-style), which
+// rounds off the staircase on diagonals and curves.
+void GlyphCache::buildGlyph(uint8_t index) {
+  uint8_t cols[5];
+  memcpy_P(cols, GLYPH_FONT[index], sizeof(cols));
+
+  auto src = [&cols](int8_t x, int8_t y) -> bool {
+    if (x < 0 || x >= 5 || y < 0 || y >= 7) return false;
+    return (cols[x] >> y) & 0x01;
+  };
+
+  for (int8_t sy = 0; sy < 7; sy++) {
+    for (int8_t sx = 0; sx < 5; sx++) {
+      bool on = src(sx, sy);
+
+      for (uint8_t dy = 0; dy < SCALE; dy++) {
+        for (uint8_t dx = 0; dx < SCALE; dx++) {
+          uint8_t alpha = on ? 3 : 0;
+
+          #if GLYPH_SMOOTHING
+          if (!on) {
+            int8_t nx = (dx == 0) ? sx - 1 : sx + 1;  // Horizontal neighbour
+            int8_t ny = (dy == 0) ? sy - 1 : sy + 1;  // Vertical neighbour
+            if (src(nx, sy) && src(sx, ny) && !src(nx, ny)) {
+              alpha = 2;
+            }
+          }
+          #endif
+
+          setAlpha(index, sx * SCALE + dx, sy * SCALE + dy, alpha);
+        }
+      }
+    }
+  }
+}
+
+uint16_t GlyphCache::blend(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  if (alpha == 0) return bg;
+  if (alpha >= 3) return fg;
+
+  // Per-channel integer blend: (fg * a + bg * (3 - a)) / 3
+  uint8_t inv = 3 - alpha;
+  uint16_t r = (((fg >> 11) & 0x1F) * alpha + ((bg >> 11) & 0x1F) * inv) / 3;
+  uint16_t g = (((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * inv) / 3;
+  uint16_t b = ((fg & 0x1F) * alpha + (bg & 0x1F) * inv) / 3;
+  return (r << 11) | (g << 5) | b;
+}
+
+bool GlyphCache::drawString(Adafruit_SPITFT* tft, int16_t x, int16_t y, const char* text,
+                            uint16_t fg, uint16_t bg) {
+  if (!canDraw(text)) return false;
+
+  uint8_t len = strlen(text);
+  int16_t w = len * CELL_W;
+
+  // Window writes don't clip - let GFX handle anything off-screen
+  if (x < 0 || y < 0 || x + w > tft->width() || y + CELL_H > tft->height()) {
+    return false;
+  }
+
+  int8_t indices[MAX_CHARS];
+  for (uint8_t i = 0; i < len; i++) {
+    indices[i] = glyphIndex(text[i]);
+  }
+
+  // 4-entry palette computed once per readout
+  uint16_t palette[4];
+  for (uint8_t a = 0; a < 4; a++) {
+    palette[a] = blend(fg, bg, a);
+  }
+
+  uint16_t line[MAX_CHARS * CELL_W];
+
+  tft->startWrite();
+  tft->setAddrWindow(x, y, w, CELL_H);
+  for (uint8_t py = 0; py < CELL_H; py++) {
+    uint16_t* out = line;
+    for (uint8_t i = 0; i < len; i++) {
+      for (uint8_t px = 0; px < CELL_W; px++) {
+        *out++ = palette[getAlpha(indices[i], px, py)];
+      }
+    }
+    tft->writePixels(line, w);
+  }
+  tft->endWrite();
+
+  return true;
+}
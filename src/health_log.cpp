@@ -0,0 +1,81 @@
+/*
+ * Health Log Implementation
+ */
+
+#include "config.h"
+#include "health_log.h"
+#include <coredecls.h>  // crc32()
+
+static constexpr uint32_t HEALTH_MAGIC = 0x484C4F47;  // "HLOG"
+
+static_assert(HEALTH_RTC_OFFSET + HealthLog::RTC_BLOCKS <= RTC_EBOOT_BLOCK,
+              "Health log must end before the eboot command area of RTC user memory");
+
+HealthLog::Record HealthLog::rec;
+
+uint32_t HealthLog::checksum() {
+  return crc32(&rec, offsetof(Record, crc));
+}
+
+void HealthLog::save() {
+  rec.crc = checksum();
+  ESP.rtcUserMemoryWrite(HEALTH_RTC_OFFSET, reinterpret_cast<uint32_t*>(&rec), sizeof(rec));
+}
+
+void HealthLog::begin() {
+  static_assert(sizeof(Record) % 4 == 0, "RTC memory is accessed in 4-byte blocks");
+  static_assert(sizeof(Record) == RTC_BLOCKS * 4, "RTC_BLOCKS out of date");
+  
+  bool valid = ESP.rtcUserMemoryRead(HEALTH_RTC_OFFSET, reinterpret_cast<uint32_t*>(&rec), sizeof(rec)) &&
+               rec.magic == HEALTH_MAGIC && rec.crc == checksum() &&
+               rec.head < CAPACITY && rec.used <= CAPACITY;
+
+  if (!valid) {
+    // Power-on: RTC memory holds garbage
+    memset(&rec, 0, sizeof(rec));
+    rec.magic = HEALTH_MAGIC;
+  }
+
+  rec.bootCount++;
+  save();
+
+  DEBUG_PRINTF("[HEALTH] Boot #%u, %u logged events\n", rec.bootCount, rec.used);
+}
+
+void HealthLog::log(HealthEvent event, uint16_t maxBlock, uint8_t frag) {
+  HealthEntry& e = rec.entries[rec.head];
+  e.uptimeS = millis() / 1000;
+  e.maxBlock = maxBlock;
+  e.frag = frag;
+  e.event = event;
+
+  rec.head = (rec.head + 1) % CAPACITY;
+  if (rec.used < CAPACITY) rec.used++;
+  save();
+
+  DEBUG_PRINTF("[HEALTH] %s (block %u, frag %u%%)\n", eventName(event), maxBlock, frag);
+}
+
+uint8_t HealthLog::count() {
+  return rec.used;
+}
+
+bool HealthLog::get(uint8_t index, HealthEntry& out) {
+  if (index >= rec.used) return false;
+  out = rec.entries[(rec.head + CAPACITY - 1 - index) % CAPACITY];
+  return true;
+}
+
+uint16_t HealthLog::getBootCount() {
+  return rec.bootCount;
+}
+
+const char* HealthLog::eventName(uint8_t event) {
+  switch (event) {
+    case HEALTH_HEAP_LOW:       return "heap_low";
+    case HEALTH_HEAP_CRITICAL:  return "heap_critical";
+    case HEALTH_HEAP_RECOVERED: return "heap_recovered";
+    case HEALTH_HEAP_RESTART:   return "heap_restart";
+    default:                    return "none";
+  }
+}
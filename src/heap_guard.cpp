@@ -0,0 +1,92 @@
+/*
+ * Heap Guard Implementation
+ */
+
+#include "config.h"
+#include "heap_guard.h"
+#include "health_log.h"
+
+HeapGuard::HeapGuard()
+  : level(HEAP_OK), badSamples(0), goodSamples(0), lastCheck(0), criticalSince(0),
+    lastMaxBlock(0), lastFrag(0), minMaxBlock(UINT32_MAX) {}
+
+HeapLevel HeapGuard::classify(uint32_t maxBlock, uint8_t frag) const {
+  if (maxBlock < HEAP_CRITICAL_BLOCK || frag >= HEAP_CRITICAL_FRAG) return HEAP_CRITICAL;
+  if (maxBlock < HEAP_LOW_BLOCK || frag >= HEAP_LOW_FRAG) return HEAP_LOW;
+  return HEAP_OK;
+}
+
+// Recovery needs real headroom, not a sample that barely clears the line
+bool HeapGuard::clearOfLow(uint32_t maxBlock, uint8_t frag) const {
+  return maxBlock >= HEAP_LOW_BLOCK + BLOCK_HYSTERESIS &&
+         frag + FRAG_HYSTERESIS < HEAP_LOW_FRAG;
+}
+
+bool HeapGuard::update() {
+  unsigned long now = millis();
+  if (now - lastCheck < CHECK_INTERVAL) return false;
+  lastCheck = now;
+
+  lastMaxBlock = ESP.getMaxFreeBlockSize();
+  lastFrag = ESP.getHeapFragmentation();
+  if (lastMaxBlock < minMaxBlock) minMaxBlock = lastMaxBlock;
+
+  HeapLevel target = classify(lastMaxBlock, lastFrag);
+  if (target == HEAP_OK && level != HEAP_OK && !clearOfLow(lastMaxBlock, lastFrag)) {
+    target = HEAP_LOW;
+  }
+
+  if (target > level) {
+    goodSamples = 0;
+    if (++badSamples >= ESCALATE_SAMPLES) {
+      setLevel(target);
+      return true;
+    }
+  } else if (target < level) {
+    badSamples = 0;
+    if (++goodSamples >= RECOVER_SAMPLES) {
+      setLevel(target);
+      return true;
+    }
+  } else {
+    badSamples = 0;
+    goodSamples = 0;
+  }
+  return false;
+}
+
+void HeapGuard::setLevel(HeapLevel next) {
+  level = next;
+  badSamples = 0;
+  goodSamples = 0;
+
+  HealthEvent event = HEALTH_HEAP_RECOVERED;
+  if (next == HEAP_CRITICAL) {
+    criticalSince = millis();
+    event = HEALTH_HEAP_CRITICAL;
+  } else if (next == HEAP_LOW) {
+    event = HEALTH_HEAP_LOW;
+  }
+
+  HealthLog::log(event, lastMaxBlock, lastFrag);
+}
+
+bool HeapGuard::restartDue() const {
+  return HEAP_RESTART_GRACE > 0 && level == HEAP_CRITICAL &&
+         millis() - criticalSince >= HEAP_RESTART_GRACE;
+}
+
+void HeapGuard::restart() {
+  HealthLog::log(HEALTH_HEAP_RESTART, ESP.getMaxFreeBlockSize(), ESP.getHeapFragmentation());
+  DEBUG_PRINTLN(F("[HEAP] Still critical after degrading - restarting"));
+  delay(100);
+  ESP.restart();
+}
+
+const char* HeapGuard::getLevelText() const {
+  switch (level) {
+    case HEAP_LOW:      return "Low";
+    case HEAP_CRITICAL: return "Critical";
+    default:            return "OK";
+  }
+}
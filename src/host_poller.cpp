@@ -0,0 +1,321 @@
+/*
+ * Host Poller Implementation
+ */
+
+#include "config.h"
+#include "host_poller.h"
+#include "network_manager.h"
+#include "system_data_json.h"
+#include "metrics.h"
+#include "settings_manager.h"  // ALERTS_EEPROM_OFFSET
+#include <EEPROM.h>
+#include <lwip/tcp.h>         // ESTABLISHED
+
+static_assert(HOSTS_EEPROM_OFFSET + sizeof(HostListData) <= ALERTS_EEPROM_OFFSET, "Host list overlaps the alert rules");
+
+static constexpr uint8_t OFFLINE_AFTER = 2;    // Consecutive failures before a host shows offline
+static constexpr uint8_t BACKOFF_MAX = 6;      // Offline hosts: poll at most every 6 intervals
+
+HostPoller::HostPoller() : hostCount(0), paused(false) {
+  for (uint8_t i = 0; i < MULTI_HOST_MAX; i++) {
+    Slot& slot = slots[i];
+    memset(&slot.entry, 0, sizeof(slot.entry));
+    slot.state = SLOT_IDLE;
+    slot.statusOk = false;
+    slot.updated = false;
+    slot.failures = 0;
+    slot.lineLen = 0;
+    slot.latencyMs = 0;
+    slot.contentLength = -1;
+    slot.startedAt = 0;
+    slot.nextPoll = 0;
+  }
+}
+
+uint8_t HostPoller::checksum(const HostListData& list) {
+  uint8_t sum = 0;
+  const uint8_t* data = (const uint8_t*)&list;
+  for (size_t i = 0; i < offsetof(HostListData, checksum); i++) {
+    sum ^= data[i];
+  }
+  return sum;
+}
+
+void HostPoller::begin() {
+  HostListData list;
+  EEPROM.get(HOSTS_EEPROM_OFFSET, list);
+
+  if (list.magic != HOSTS_MAGIC || list.count > MULTI_HOST_MAX || list.checksum != checksum(list)) {
+    DEBUG_PRINTLN(F("[HOSTS] No extra hosts configured"));
+    hostCount = 0;
+    return;
+  }
+
+  hostCount = list.count;
+  unsigned long now = millis();
+  for (uint8_t i = 0; i < hostCount; i++) {
+    slots[i].entry = list.hosts[i];
+    slots[i].entry.address[sizeof(slots[i].entry.address) - 1] = '\0';
+    // Stagger the polls so sockets don't all open together
+    slots[i].nextPoll = now + (MULTI_HOST_INTERVAL / hostCount) * i;
+    DEBUG_PRINTF("[HOSTS] #%u %s:%u\n", i + 1, slots[i].entry.address, slots[i].entry.port);
+  }
+}
+
+bool HostPoller::saveHostList(const char* text) {
+  HostListData list;
+  memset(&list, 0, sizeof(list));
+  list.magic = HOSTS_MAGIC;
+
+  const char* p = text;
+  while (*p && list.count < MULTI_HOST_MAX) {
+    // Skip separators
+    while (*p == ',' || isspace((unsigned char)*p)) p++;
+    if (!*p) break;
+
+    const char* start = p;
+    while (*p && *p != ',' && !isspace((unsigned char)*p)) p++;
+    size_t len = p - start;
+
+    HostEntry& entry = list.hosts[list.count];
+    entry.port = 8080;
+    const char* colon = (const char*)memchr(start, ':', len);
+    if (colon) {
+      long port = atol(colon + 1);
+      if (port > 0 && port <= 65535) entry.port = port;
+      len = colon - start;
+    }
+    if (len == 0 || len >= sizeof(entry.address)) {
+      DEBUG_PRINTLN(F("[HOSTS] Skipping invalid entry"));
+      continue;
+    }
+    memcpy(entry.address, start, len);
+    list.count++;
+  }
+
+  list.checksum = checksum(list);
+  EEPROM.put(HOSTS_EEPROM_OFFSET, list);
+  bool success = EEPROM.commit();
+  Metrics::recordFlashWrite();
+
+  DEBUG_PRINTF("[HOSTS] Saved %u host(s): %s\n", list.count, success ? "OK" : "FAILED");
+  return success;
+}
+
+uint8_t HostPoller::inflight() const {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < hostCount; i++) {
+    if (slots[i].state != SLOT_IDLE) n++;
+  }
+  return n;
+}
+
+void HostPoller::handle() {
+  if (paused || hostCount == 0 || WiFi.status() != WL_CONNECTED) return;
+
+  unsigned long now = millis();
+  for (uint8_t i = 0; i < hostCount; i++) {
+    Slot& slot = slots[i];
+
+    switch (slot.state) {
+      case SLOT_IDLE:
+        if ((long)(now - slot.nextPoll) >= 0 && inflight() < MAX_INFLIGHT) {
+          start(slot);
+        }
+        break;
+      case SLOT_HEADERS:
+        readHeaders(slot);
+        break;
+      case SLOT_BODY:
+        readBody(slot);
+        break;
+    }
+
+    if (slot.state != SLOT_IDLE && millis() - slot.startedAt > TIMEOUT) {
+      DEBUG_PRINTF("[HOSTS] %s: timeout\n", slot.entry.address);
+      finish(slot, false);
+    }
+  }
+}
+
+void HostPoller::start(Slot& slot) {
+  slot.startedAt = millis();
+  slot.statusOk = false;
+  slot.lineLen = 0;
+  slot.contentLength = -1;
+
+  // connect() waits for the handshake; everything after it is polled
+  slot.client.setTimeout(CONNECT_TIMEOUT);
+  if (!slot.client.connect(slot.entry.address, slot.entry.port)) {
+    DEBUG_PRINTF("[HOSTS] %s: connect failed\n", slot.entry.address);
+    finish(slot, false);
+    return;
+  }
+  slot.client.setNoDelay(true);
+
+  // HTTP/1.0 + close: no chunked encoding, end of body = end of stream
+  char request[128];
+  snprintf_P(request, sizeof(request),
+             PSTR("GET " SYSTEM_INFO_PATH_LOW " HTTP/1.0\r\nHost: %s\r\nConnection: close\r\n\r\n"),
+             slot.entry.address);
+  slot.client.write((const uint8_t*)request, strlen(request));
+  slot.state = SLOT_HEADERS;
+}
+
+// Consume whatever header bytes have arrived, one line at a time
+void HostPoller::readHeaders(Slot& slot) {
+  while (slot.client.available()) {
+    int c = slot.client.read();
+    if (c == '\r') continue;
+
+    if (c == '\n') {
+      slot.line[slot.lineLen] = '\0';
+      if (slot.lineLen == 0) {
+        // Blank line: headers done
+        if (!slot.statusOk) {
+          finish(slot, false);
+          return;
+        }
+        slot.state = SLOT_BODY;
+        readBody(slot);
+        return;
+      }
+      headerLine(slot);
+      if (slot.state == SLOT_IDLE) return;
+      slot.lineLen = 0;
+      continue;
+    }
+
+    if (slot.lineLen < sizeof(slot.line) - 1) {
+      slot.line[slot.lineLen++] = c;
+    }
+  }
+
+  if (!slot.client.connected()) {
+    finish(slot, false);
+  }
+}
+
+void HostPoller::headerLine(Slot& slot) {
+  if (strncmp(slot.line, "HTTP/", 5) == 0) {
+    slot.statusOk = strstr(slot.line, " 200") != nullptr;
+  } else if (strncasecmp(slot.line, "Content-Length:", 15) == 0) {
+    slot.contentLength = atol(slot.line + 15);
+    if (slot.contentLength > MAX_BODY) {
+      DEBUG_PRINTF("[HOSTS] %s: reply too large (%d)\n", slot.entry.address, slot.contentLength);
+      finish(slot, false);
+    }
+  }
+}
+
+// Parse only once the whole body is buffered, so deserializeJson never waits
+void HostPoller::readBody(Slot& slot) {
+  int avail = slot.client.available();
+  // No Content-Length: the body ends at the server's FIN. connected() stays true
+  // while unread bytes remain, so check the TCP state: once the peer has closed,
+  // everything it sent is already buffered for deserializeJson to drain.
+  bool complete = slot.contentLength >= 0 ? avail >= slot.contentLength
+                                          : slot.client.status() != ESTABLISHED;
+  if (!complete) {
+    if (avail > MAX_BODY) finish(slot, false);
+    return;
+  }
+
+  StaticJsonDocument<SystemDataJson::FILTER_CAPACITY> filter;
+  SystemDataJson::buildFilter(filter);
+  DynamicJsonDocument doc(JSON_POOL_LOW);
+
+  slot.client.setTimeout(50);  // Data is already here
+  DeserializationError error = deserializeJson(doc, slot.client, DeserializationOption::Filter(filter));
+  if (error) {
+    DEBUG_PRINTF("[HOSTS] %s: JSON error %s\n", slot.entry.address, error.c_str());
+    finish(slot, false);
+    return;
+  }
+
+  SystemData& data = slot.data;
+  SystemDataJson::parse(doc, data);
+  clip(data.hostName);
+  clip(data.cpuName);
+  clip(data.gpuName);
+  finish(slot, true);
+}
+
+void HostPoller::finish(Slot& slot, bool ok) {
+  slot.client.stop();
+  slot.state = SLOT_IDLE;
+
+  unsigned long elapsed = millis() - slot.startedAt;
+  slot.latencyMs = elapsed > 0xFFFF ? 0xFFFF : elapsed;
+
+  if (ok) {
+    slot.failures = 0;
+    slot.updated = true;
+    slot.nextPoll = slot.startedAt + MULTI_HOST_INTERVAL;
+    return;
+  }
+
+  if (slot.failures < 0xFF) slot.failures++;
+  if (slot.failures == OFFLINE_AFTER && slot.data.hasData) {
+    slot.data.hasData = false;
+    slot.updated = true;  // Show it offline
+  }
+  uint8_t backoff = slot.failures < BACKOFF_MAX ? slot.failures : BACKOFF_MAX;
+  slot.nextPoll = slot.startedAt + MULTI_HOST_INTERVAL * backoff;
+}
+
+void HostPoller::setPaused(bool p) {
+  if (p == paused) return;
+  paused = p;
+
+  if (paused) {
+    for (uint8_t i = 0; i < hostCount; i++) {
+      if (slots[i].state != SLOT_IDLE) {
+        slots[i].client.stop();
+        slots[i].state = SLOT_IDLE;
+      }
+    }
+  }
+  DEBUG_PRINTF("[HOSTS] Polling %s\n", paused ? "paused (low memory)" : "resumed");
+}
+
+// Copy into a right-sized buffer (assigning a long String keeps its capacity)
+void HostPoller::clip(String& s) {
+  if (s.length() > NAME_MAX) {
+    s = s.substring(0, NAME_MAX);
+  }
+}
+
+const char* HostPoller::getLabel(uint8_t i) const {
+  const Slot& slot = slots[i];
+  return slot.data.hostName.length() > 0 ? slot.data.hostName.c_str() : slot.entry.address;
+}
+
+bool HostPoller::isOnline(uint8_t i) const {
+  return slots[i].data.hasData;
+}
+
+// Upper bound: strings of up to 10 chars live inside the String object (SSO)
+size_t HostPoller::getMemoryUsage(uint8_t i) const {
+  const SystemData& data = slots[i].data;
+  size_t bytes = sizeof(Slot);
+  const String* strings[] = { &data.hostName, &data.cpuName, &data.gpuName };
+  for (const String* s : strings) {
+    if (s->length() > 0) bytes += s->length() + 1;
+  }
+  return bytes;
+}
+
+size_t HostPoller::getMemoryUsage() const {
+  size_t bytes = 0;
+  for (uint8_t i = 0; i < hostCount; i++) {
+    bytes += getMemoryUsage(i);
+  }
+  return bytes;
+}
+
+bool HostPoller::takeUpdate(uint8_t i) {
+  bool updated = slots[i].updated;
+  slots[i].updated = false;
+  return updated;
+}
@@ -0,0 +1,235 @@
+/*
+ * Layout Store Implementation
+ */
+
+#include "config.h"
+#include "layout_store.h"
+#include "push_metrics.h"   // PUSH_NAME_LEN
+#include "metrics.h"
+#include <flash_hal.h>       // FS_PHYS_ADDR / FS_PHYS_SIZE
+#include <stddef.h>
+
+static constexpr uint32_t STORE_MAGIC = 0x4C59544C;  // "LTYL"
+static constexpr size_t HEADER_LEN = 6;             // 'H' 'L' version cols rows count
+static constexpr size_t TILE_LEN = 7;               // kind col row colSpan rowSpan style nameLen
+
+// Flash copy: header + descriptor, padded to whole words
+struct StoredLayout {
+  uint32_t magic;
+  uint16_t length;
+  uint16_t pinned;    // Set on the panel (POST /layout), not by the bridge
+  uint32_t crc;
+  uint8_t data[(LAYOUT_DESC_MAX + 3) & ~3];
+};
+
+// Descriptor style index -> frame color (0 = the tile's own color)
+static const uint16_t PALETTE[] = {
+  0, COLOR_CPU, COLOR_RAM, COLOR_GPU, COLOR_DISK, COLOR_NET, COLOR_VRAM, COLOR_HEADER, COLOR_TEXT, COLOR_ALERT
+};
+static constexpr uint8_t PALETTE_SIZE = sizeof(PALETTE) / sizeof(PALETTE[0]);
+
+static const char* const KIND_NAMES[TILE_KIND_COUNT] = {
+  "cpu", "ram", "gpu", "vram", "storage", "net", "net_up", "net_down", "cores", "push"
+};
+
+LayoutStore::LayoutStore()
+  : desc(), descLen(0), slots(), count(0), id(0), changed(false), pinned(false), error(nullptr), sectorAddr(0) {
+  useBuiltin();
+}
+
+void LayoutStore::useBuiltin() {
+  count = DASHBOARD_TILE_COUNT < LAYOUT_TILE_MAX ? DASHBOARD_TILE_COUNT : LAYOUT_TILE_MAX;
+  memcpy(slots, DASHBOARD_LAYOUT, count * sizeof(TileSlot));
+  descLen = 0;
+  id = 0;
+}
+
+void LayoutStore::begin() {
+  #if LAYOUT_FLASH
+  if (FS_PHYS_SIZE >= 2 * FLASH_SECTOR_SIZE) {
+    sectorAddr = FS_PHYS_ADDR + FS_PHYS_SIZE - 2 * FLASH_SECTOR_SIZE;  // Last sector is CrashLog's
+  }
+  #endif
+  if (sectorAddr == 0) return;
+
+  StoredLayout stored;
+  if (!ESP.flashRead(sectorAddr, reinterpret_cast<uint32_t*>(&stored), sizeof(stored))) return;
+  if (stored.magic != STORE_MAGIC || stored.length > LAYOUT_DESC_MAX ||
+      stored.crc != crc32(stored.data, stored.length)) {
+    return;  // Erased or never written: built-in layout
+  }
+
+  if (apply(stored.data, stored.length, stored.pinned == 1)) {
+    DEBUG_PRINTF("[LAYOUT] Loaded %u tiles (%08x)\n", count, id);
+  } else {
+    DEBUG_PRINTF("[LAYOUT] Saved layout rejected: %s\n", error);
+  }
+  changed = false;  // Nothing drawn yet
+}
+
+bool LayoutStore::compile(const uint8_t* data, size_t len, TileSlot* out, uint8_t& n) {
+  if (len < HEADER_LEN || data[0] != 'H' || data[1] != 'L' || data[2] != VERSION) {
+    error = "bad header";
+    return false;
+  }
+  uint8_t cols = data[3], rows = data[4];
+  n = data[5];
+  if (cols == 0 || rows == 0 || cols > GRID_MAX || rows > GRID_MAX) {
+    error = "bad grid";
+    return false;
+  }
+  if (n == 0 || n > LAYOUT_TILE_MAX) {
+    error = "bad tile count";
+    return false;
+  }
+
+  // Cell size for this screen, computed once here (never per frame)
+  const int16_t cellW = DashboardLayout::gridW(cols);
+  const int16_t cellH = DashboardLayout::gridH(rows);
+  if (cellW < CELL_MIN_W || cellH < CELL_MIN_H) {
+    error = "grid too fine for this screen";
+    return false;
+  }
+
+  uint64_t used = 0;  // Occupied cells, bit row * GRID_MAX + col
+  size_t pos = HEADER_LEN;
+  for (uint8_t i = 0; i < n; i++) {
+    if (pos + TILE_LEN > len) {
+      error = "truncated";
+      return false;
+    }
+    const uint8_t* t = data + pos;
+    uint8_t kind = t[0], col = t[1], row = t[2], colSpan = t[3], rowSpan = t[4], style = t[5], nameLen = t[6];
+    pos += TILE_LEN;
+
+    const char* metric = nullptr;
+    if (nameLen > 0) {
+      if (nameLen >= PUSH_NAME_LEN || pos + nameLen + 1 > len || data[pos + nameLen] != '\0') {
+        error = "bad metric name";
+        return false;
+      }
+      metric = reinterpret_cast<const char*>(data + pos);
+      pos += nameLen + 1;
+    }
+
+    if (kind >= TILE_KIND_COUNT) {
+      error = "unknown tile kind";
+      return false;
+    }
+    if (kind == TILE_PUSH && !metric) {
+      error = "push tile without a metric";
+      return false;
+    }
+    if (style >= PALETTE_SIZE) {
+      error = "unknown style";
+      return false;
+    }
+    if (colSpan == 0 || rowSpan == 0 || col + colSpan > cols || row + rowSpan > rows) {
+      error = "tile off the grid";
+      return false;
+    }
+    for (uint8_t r = row; r < row + rowSpan; r++) {
+      for (uint8_t c = col; c < col + colSpan; c++) {
+        uint64_t bit = 1ULL << (r * GRID_MAX + c);
+        if (used & bit) {
+          error = "tiles overlap";
+          return false;
+        }
+        used |= bit;
+      }
+    }
+
+    out[i] = TileSlot{ (TileKind)kind,
+                       (int16_t)(DashboardLayout::MARGIN + col * (cellW + DashboardLayout::SPACING)),
+                       (int16_t)(DashboardLayout::TOP + row * (cellH + DashboardLayout::SPACING)),
+                       (int16_t)(colSpan * cellW + (colSpan - 1) * DashboardLayout::SPACING),
+                       (int16_t)(rowSpan * cellH + (rowSpan - 1) * DashboardLayout::SPACING),
+                       kind == TILE_PUSH ? metric : nullptr, PALETTE[style] };
+  }
+  if (pos != len) {
+    error = "trailing bytes";
+    return false;
+  }
+  return true;
+}
+
+bool LayoutStore::apply(const uint8_t* data, size_t len, bool pin) {
+  if (len > LAYOUT_DESC_MAX) {
+    error = "too large";
+    return false;
+  }
+
+  TileSlot staged[LAYOUT_TILE_MAX];
+  uint8_t n;
+  if (!compile(data, len, staged, n)) return false;
+
+  // Keep the descriptor: metric names move from data into desc
+  memmove(desc, data, len);
+  for (uint8_t i = 0; i < n; i++) {
+    if (staged[i].metric) {
+      staged[i].metric = reinterpret_cast<const char*>(desc) +
+                         (staged[i].metric - reinterpret_cast<const char*>(data));
+    }
+  }
+  memcpy(slots, staged, n * sizeof(TileSlot));
+  count = n;
+  descLen = len;
+  id = crc32(desc, len);
+  if (id == 0) id = 1;  // 0 means built-in
+  pinned = pin;
+  error = nullptr;
+  changed = true;
+  return true;
+}
+
+bool LayoutStore::save() {
+  if (sectorAddr == 0 || descLen == 0) return false;
+
+  StoredLayout stored;
+  memset(&stored, 0xFF, sizeof(stored));
+  stored.magic = STORE_MAGIC;
+  stored.length = descLen;
+  stored.pinned = pinned ? 1 : 0;
+  stored.crc = crc32(desc, descLen);
+  memcpy(stored.data, desc, descLen);
+
+  size_t bytes = (offsetof(StoredLayout, data) + descLen + 3) & ~3;  // Whole words
+  bool ok = ESP.flashEraseSector(sectorAddr / FLASH_SECTOR_SIZE) &&
+            ESP.flashWrite(sectorAddr, reinterpret_cast<uint32_t*>(&stored), bytes);
+  Metrics::recordFlashWrite();
+  DEBUG_PRINTF("[LAYOUT] Saved %u bytes: %s\n", descLen, ok ? "ok" : "failed");
+  return ok;
+}
+
+void LayoutStore::reset() {
+  if (sectorAddr != 0 && isCustom()) {
+    ESP.flashEraseSector(sectorAddr / FLASH_SECTOR_SIZE);
+    Metrics::recordFlashWrite();
+  }
+  useBuiltin();
+  pinned = false;
+  error = nullptr;
+  changed = true;
+}
+
+bool LayoutStore::takeChanged() {
+  bool was = changed;
+  changed = false;
+  return was;
+}
+
+// Standard CRC-32 (same as Python's zlib.crc32, so the bridge can announce it)
+uint32_t LayoutStore::crc32(const uint8_t* data, size_t len) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+const char* LayoutStore::kindName(uint8_t kind) {
+  return kind < TILE_KIND_COUNT ? KIND_NAMES[kind] : "?";
+}
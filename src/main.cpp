@@ -29,6 +29,19 @@
 #include "config_manager.h"
 #include "settings_manager.h"
 #include "menu_manager.h"
+#include "adaptive_refresh.h"
+#include "power_manager.h"
+#include "firmware_updater.h"
+#include "metrics.h"
+#include "heap_guard.h"
+#include "health_log.h"
+#include "crash_log.h"
+#include "host_poller.h"
+#include "bridge_discovery.h"
+#include "recovery_policy.h"
+#include "alert_engine.h"
+#include "push_metrics.h"
+#include "layout_store.h"
 
 // Khởi tạo các manager
 ConfigManager configMgr("ESP8266-Config", "82668266");  // AP name & password
@@ -40,23 +53,201 @@ OTAManager ota(OTA_HOSTNAME, OTA_PASSWORD);
 OTAWebManager otaWeb;
 MenuManager* menu = nullptr;  // Khởi tạo sau khi có display
 SystemData sysData;
+AdaptiveRefresh adaptiveRefresh;
+PowerManager power(WIFI_SLEEP_MODE, BUTTON_PIN);
+FirmwareUpdater fwUpdater;
+MetricsServer metricsServer;
+HeapGuard heapGuard;
+HostPoller hosts;
+BridgeDiscovery discovery;
+RecoveryPolicy recovery;
+AlertEngine alerts;
+PushMetrics pushed;  // POST /push table (PUSH_ENABLED)
+LayoutStore layouts;  // Dashboard tile layout (flash / bridge / POST /layout)
+uint32_t rejectedLayout = 0;  // Bridge layout the panel refused - not fetched again
+uint8_t layoutFetchFailures = 0;
+unsigned long layoutRetryAt = 0;
 
 // Global flags
 bool forceRefreshSystemInfo = false;
 
+// Carousel: page 0 = primary bridge, 1..N = extra hosts, N+1 = summary
+uint8_t carouselPage = 0;
+unsigned long carouselShownAt = 0;
+
+uint8_t carouselPages() {
+  return hosts.count() > 0 ? hosts.count() + 2 : 1;
+}
+
+bool onSummaryPage() {
+  return hosts.count() > 0 && carouselPage == hosts.count() + 1;
+}
+
+void drawHostSummary() {
+  HostSummaryRow rows[MULTI_HOST_MAX + 1];
+  rows[0] = { sysData.hostName.length() > 0 ? sysData.hostName.c_str() : "Primary",
+              &sysData, sysData.hasData && recovery.getTier() < RECOVERY_BACKOFF, 0, 0 };
+  for (uint8_t i = 0; i < hosts.count(); i++) {
+    rows[i + 1] = { hosts.getLabel(i), &hosts.getData(i), hosts.isOnline(i),
+                    hosts.getLatency(i), (uint16_t)hosts.getMemoryUsage(i) };
+  }
+  display.displayHostSummary(rows, hosts.count() + 1);
+}
+
+void drawCarouselPage() {
+  if (carouselPage == 0) {
+    display.displaySystemInfo(sysData, "SYS", alerts.getHighlightMask());
+    if (recovery.isDegraded()) {
+      display.drawStaleBadge(recovery.getDataAgeMs() / 1000, configMgr.isRecoveryAP());
+    }
+  } else if (onSummaryPage()) {
+    drawHostSummary();
+  } else {
+    uint8_t i = carouselPage - 1;
+    if (hosts.isOnline(i)) {
+      display.displaySystemInfo(hosts.getData(i), hosts.getLabel(i));
+    } else {
+      HostSummaryRow row = { hosts.getLabel(i), &hosts.getData(i), false, 0,
+                             (uint16_t)hosts.getMemoryUsage(i) };
+      display.displayHostSummary(&row, 1);
+    }
+  }
+}
+
+// Escalate alerts that just tripped, keep the pulse in sync with active rules.
+// True = flash/pulse woke the screen from off (redraw needed).
+bool applyAlerts() {
+  uint8_t raised = alerts.getRaisedActions();
+  bool woke = false;
+  if (raised & (ALERT_FLASH | ALERT_PULSE)) {
+    woke = display.noteActivity();  // Bring a dimmed or dark screen back before flashing
+  }
+  if (raised & ALERT_FLASH) {
+    display.flashAlert();
+  }
+  display.setAlertPulse(alerts.getActions() & ALERT_PULSE);
+  
+  for (uint8_t i = 0; i < alerts.getRuleCount(); i++) {
+    if (!alerts.isEnabled(i)) continue;
+    DEBUG_PRINTF("[ALERT] Rule %u (%s): %s\n", i, AlertEngine::metricName(alerts.getRule(i).metric),
+                 alerts.isActive(i) ? "active" : "clear");
+  }
+  return woke;
+}
+
+// Hand a new layout to the renderer. True = redraw needed.
+bool syncLayout() {
+  if (!layouts.takeChanged()) return false;
+  display.setLayout(layouts.getSlots(), layouts.getCount());
+  return true;
+}
+
+// Bridge announces a layout (CRC in /system-info) we don't have: fetch, apply, persist.
+// A layout POSTed to the panel itself is pinned and wins until POST /layout?reset=1.
+void fetchBridgeLayout() {
+  uint32_t wanted = sysData.layoutId;
+  if (wanted == 0 || layouts.isPinned() || wanted == layouts.getId() || wanted == rejectedLayout) return;
+  if (layoutFetchFailures > 0 && (long)(millis() - layoutRetryAt) < 0) return;
+  
+  uint8_t buf[LAYOUT_DESC_MAX];
+  size_t len;
+  if (!network->fetchLayout(buf, sizeof(buf), len)) {
+    // Network hiccup, not a bad layout: try again later (10s, 20s, ... up to 32x)
+    uint8_t shift = layoutFetchFailures < 5 ? layoutFetchFailures : 5;
+    layoutRetryAt = millis() + (LayoutStore::RETRY_MS << shift);
+    layoutFetchFailures++;
+    DEBUG_PRINTF("[LAYOUT] Bridge layout %08x: fetch failed (%u)\n", wanted, layoutFetchFailures);
+    return;
+  }
+  layoutFetchFailures = 0;
+  
+  if (!layouts.apply(buf, len)) {
+    rejectedLayout = wanted;
+    DEBUG_PRINTF("[LAYOUT] Bridge layout %08x rejected: %s\n", wanted, layouts.getError());
+    return;
+  }
+  layouts.save();
+  DEBUG_PRINTF("[LAYOUT] Bridge layout %08x: %u tiles\n", layouts.getId(), layouts.getCount());
+}
+
+void nextCarouselPage() {
+  carouselPage = (carouselPage + 1) % carouselPages();
+  carouselShownAt = millis();
+  drawCarouselPage();
+}
+
+// Auto-advance + redraw the visible page when its host reports in
+void handleCarousel() {
+  bool redraw = false;
+  for (uint8_t i = 0; i < hosts.count(); i++) {
+    if (hosts.takeUpdate(i) && (carouselPage == i + 1 || onSummaryPage())) {
+      redraw = true;
+    }
+  }
+  
+  if (CAROUSEL_INTERVAL > 0 && millis() - carouselShownAt >= CAROUSEL_INTERVAL) {
+    nextCarouselPage();
+  } else if (redraw) {
+    drawCarouselPage();
+  }
+}
+
+// Disks/NICs that don't fit their tile rotate in place on the visible dashboard
+void advanceTilePages() {
+  if (carouselPage == 0) {
+    display.advanceTilePage(sysData);
+  } else if (!onSummaryPage() && hosts.isOnline(carouselPage - 1)) {
+    display.advanceTilePage(hosts.getData(carouselPage - 1));
+  }
+}
+
 // Menu exit callback
 void onMenuExit() {
   forceRefreshSystemInfo = true;
-  // Reset reconnect fail counter after menu (not a WiFi issue)
-  configMgr.reportServerSuccess();
   DEBUG_PRINTLN(F("[MAIN] Menu exit - forcing refresh"));
 }
 
+// Heap guard level changed - switch memory-hungry features on/off
+void applyHeapLevel() {
+  bool degraded = heapGuard.isDegraded();
+  display.setPlainRendering(degraded);
+  if (network) {
+    network->setLowMemory(degraded);
+  }
+  hosts.setPaused(degraded);
+  Metrics::setHeapLevel(heapGuard.getLevel());
+  DEBUG_PRINTF("[HEAP] Level: %s\n", heapGuard.getLevelText());
+}
+
+// Stored server address changed - point the fetchers at it
+void applyServerAddress() {
+  network->setServer(configMgr.getServerIP().c_str(), configMgr.getServerPort());
+  fwUpdater.setServer(configMgr.getServerIP(), configMgr.getServerPort());
+}
+
+// mDNS found the bridge - switch to its (new) address right away.
+// A configured hostname that DNS still resolves is kept (only the port may
+// change); an IP literal or a name DNS no longer knows is replaced.
+void applyDiscoveredBridge() {
+  IPAddress ip;
+  uint16_t port;
+  if (!discovery.takeResult(ip, port)) return;
+  
+  String host = network->refreshServerName() ? configMgr.getServerIP() : ip.toString();
+  if (configMgr.updateServerAddress(host.c_str(), port)) {
+    applyServerAddress();
+  }
+  forceRefreshSystemInfo = true;  // Retry now instead of waiting out the interval
+}
+
 // Callbacks
 void onButtonShortPress() {
   // Short press = Navigate menu (if active)
   if (menu && menu->isActive()) {
     menu->next();
+  } else if (hosts.count() > 0) {
+    // Dashboard: next carousel page
+    nextCarouselPage();
   }
 }
 
@@ -81,6 +272,10 @@ void setup() {
   Serial.setDebugOutput(false);
   WiFi.setOutputPower(20.5);  // Max WiFi power
   
+  // Reset reason + last state of the previous run, then the heap event ring
+  CrashLog::begin();
+  HealthLog::begin();
+  
   // Print version info
   #ifdef DEBUG_MODE
   Serial.println(F("\n========================================"));
@@ -99,6 +294,12 @@ void setup() {
   
   // Init settings manager (before menu)
   settingsMgr.begin();
+  display.setBrightness(settingsMgr.getBacklightFull(), settingsMgr.getBacklightDim());
+  alerts.setRules(settingsMgr.getAlertRules(), ALERT_RULE_MAX);
+  
+  // Saved dashboard layout (built-in one if none)
+  layouts.begin();
+  display.setLayout(layouts.getSlots(), layouts.getCount());
   
   // Init button FIRST - có thể dùng bất cứ lúc nào
   button.begin();
@@ -111,6 +312,7 @@ void setup() {
   // Init config manager
   configMgr.setDisplayManager(&display);
   configMgr.setButtonHandler(&button);  // Pass display for reconnect feedback
+  configMgr.setDiscovery(&discovery);   // Portal: empty server address = mDNS lookup
   configMgr.begin();
   
   // Check if in config mode (no valid config or user reset)
@@ -127,13 +329,16 @@ void setup() {
   network = new NetworkManager(
     configMgr.getWiFiSSID().c_str(),
     configMgr.getWiFiPassword().c_str(),
-    configMgr.getServerURL(),
+    configMgr.getServerIP().c_str(),
+    configMgr.getServerPort(),
     settingsMgr.getRefreshInterval()  // Use saved refresh rate
   );
   
   // Init menu manager (after all dependencies ready)
   menu = new MenuManager(&display, &settingsMgr, &configMgr, &otaWeb);
   menu->setExitCallback(onMenuExit);  // Force refresh on menu exit
+  menu->setAdaptiveRefresh(&adaptiveRefresh);
+  menu->setPowerManager(&power);
   
   display.showWiFiConnecting();
   
@@ -157,18 +362,54 @@ void setup() {
     DEBUG_PRINTLN(F("[WIFI] Connection failed - will retry in loop"));
   }
   
+  // WiFi sleep between fetches (no-op in POWER_MODE_OFF)
+  power.begin();
+  
   // Init OTA with display feedback
   #if OTA_ENABLED
   ota.setDisplayManager(&display);
   ota.begin();
   DEBUG_PRINTLN(F("[OTA] Ready for wireless updates"));
   #endif
+  
+  // Pull-based updates from the PC bridge (same host as /system-info)
+  fwUpdater.setServer(configMgr.getServerIP(), configMgr.getServerPort());
+  fwUpdater.setDisplayManager(&display);
+  
+  // Re-find the bridge via mDNS if its IP changes (after OTA - shares the responder)
+  discovery.begin(OTA_HOSTNAME);
+  
+  // Extra hosts for the carousel (saved from the config portal)
+  hosts.begin();
+  
+  // Health counters + /metrics endpoint
+  Metrics::setHostPoller(&hosts);
+  Metrics::setAlertEngine(&alerts);
+  Metrics::begin();
+  metricsServer.setAlerts(&alerts, &settingsMgr);
+  metricsServer.setPushMetrics(&pushed);
+  display.setPushMetrics(&pushed);
+  metricsServer.setLayoutStore(&layouts);
+  metricsServer.begin();
 }
 
 void loop() {
+  CrashLog::stage(STAGE_INPUT);
+  
+  // Any press restarts the backlight idle timeline (full -> dim -> off)
+  if (button.isPressed() && display.noteActivity()) {
+    forceRefreshSystemInfo = true;  // Screen was off - content is stale
+  }
+  display.updateBacklight();
+  
   // Button ALWAYS active - can reset anytime
   button.update();
   
+  // Heap watchdog - degrade before running out of memory
+  if (heapGuard.update()) {
+    applyHeapLevel();
+  }
+  
   // Update menu (handle timeout)
   if (menu) {
     menu->update();
@@ -176,17 +417,21 @@ void loop() {
   
   // Nếu đang ở menu mode - skip system info update
   if (menu && menu->isActive()) {
+    CrashLog::stage(STAGE_MENU);
     return;
   }
   
   // Nếu đang ở OTA mode - handle web server (non-blocking!)
   if (otaWeb.active()) {
+    CrashLog::stage(STAGE_OTA_WEB);
+    fwUpdater.abort();  // Web upload needs the Updater
     otaWeb.handle();
     return;
   }
   
   // Nếu đang ở config mode, chỉ handle web requests
   if (configMgr.isConfigMode()) {
+    CrashLog::stage(STAGE_CONFIG);
     configMgr.handleClient();
     return;
   }
@@ -198,6 +443,7 @@ void loop() {
   
   // Check WiFi - shouldFallbackToConfig() handles display & reset
   if (!network->isConnected()) {
+    CrashLog::stage(STAGE_WIFI);
     if (configMgr.shouldFallbackToConfig()) {
       configMgr.resetConfig();
       ESP.restart();
@@ -207,25 +453,138 @@ void loop() {
   
   // Handle OTA updates
   #if OTA_ENABLED
+  CrashLog::stage(STAGE_OTA);
   ota.handle();
   #endif
   
-  // Update system data (only if WiFi connected and display on)
-  // Force update if menu just exited OR normal refresh interval passed
-  if (display.isOn() && (forceRefreshSystemInfo || network->shouldUpdate())) {
-    // Update network refresh interval from settings (in case changed via menu)
-    network->setUpdateInterval(settingsMgr.getRefreshInterval());
+  // Background firmware check/download (a few KB per loop)
+  // (no new checks while the heap is critical)
+  if (heapGuard.getLevel() != HEAP_CRITICAL || fwUpdater.isDownloading()) {
+    CrashLog::stage(STAGE_FW_UPDATE);
+    fwUpdater.handle();
+  }
+  CrashLog::stage(STAGE_METRICS);
+  metricsServer.handle();
+  if (syncLayout()) {
+    forceRefreshSystemInfo = true;  // POST /layout - redraw with the new tiles
+  }
+  
+  // Bridge lookup running in the background (started by a failed fetch)
+  if (discovery.isSearching()) {
+    CrashLog::stage(STAGE_DISCOVERY);
+    discovery.handle();
+  }
+  applyDiscoveredBridge();
+  
+  // Long outage: temporary AP to fix the server address (dashboard keeps running)
+  if (configMgr.isRecoveryAP()) {
+    CrashLog::stage(STAGE_CONFIG);
+    if (configMgr.handleRecoveryAP()) {
+      applyServerAddress();
+      forceRefreshSystemInfo = true;
+    }
+  }
+  
+  // Extra hosts: non-blocking socket polls + carousel paging (drawing is skipped while dark)
+  if (hosts.count() > 0 && display.isEnabled()) {
+    CrashLog::stage(STAGE_HOSTS);
+    hosts.handle();
+    handleCarousel();
+  }
+  
+  if (display.isOn()) {
+    CrashLog::stage(STAGE_RENDER);
+    advanceTilePages();
+  }
+  
+  // Update system data (only if WiFi connected and display enabled)
+  // Force update if menu just exited OR normal refresh interval passed.
+  // Keeps fetching while the idle backlight is off: alerts, recovery and the
+  // fetch metrics stay live, displaySystemInfo() skips the SPI work.
+  if (display.isEnabled() && (forceRefreshSystemInfo || network->shouldUpdate())) {
+    CrashLog::stage(STAGE_FETCH);
+    bool forced = forceRefreshSystemInfo;
+    power.beginFetch();
+    bool fetched = network->fetchSystemData(sysData);
+    power.endFetch();
     
-    if (network->fetchSystemData(sysData)) {
-      display.displaySystemInfo(sysData);
-      configMgr.reportServerSuccess();  // Reset server fail counter
+    if (fetched) {
+      // Next interval: adaptive (volatility-driven) or fixed from settings
+      // (re-read every fetch in case it was changed via menu)
+      if (settingsMgr.isAdaptiveRefresh()) {
+        adaptiveRefresh.setBounds(settingsMgr.getAdaptiveMinInterval(), settingsMgr.getAdaptiveMaxInterval());
+        network->setUpdateInterval(adaptiveRefresh.update(sysData, millis()));
+      } else {
+        network->setUpdateInterval(settingsMgr.getRefreshInterval());
+      }
+      
+      // Threshold alerts (primary host only), on every sample even while the screen is dark -
+      // before drawing so the borders are current
+      if (alerts.update(sysData, millis()) && applyAlerts()) {
+        forced = true;
+      }
+      
+      // Bridge layout changed - swap tiles before this frame (no reboot)
+      fetchBridgeLayout();
+      if (syncLayout()) {
+        forced = true;
+      }
+      
+      #ifdef DEBUG_PERF
+      uint32_t renderStart = ESP.getCycleCount();
+      #endif
+      
+      // Primary data is only on page 0 and the summary (after the menu: redraw whatever page)
+      if (carouselPage == 0 || onSummaryPage() || forced) {
+        CrashLog::stage(STAGE_RENDER);
+        uint32_t renderStartUs = micros();
+        drawCarouselPage();
+        Metrics::recordRender(micros() - renderStartUs);
+      }
+      
+      #ifdef DEBUG_PERF
+      DEBUG_PRINTF("[PERF] Render: %u cycles\n", ESP.getCycleCount() - renderStart);
+      #endif
+      if (recovery.reportSuccess()) {
+        configMgr.stopRecoveryAP();     // Back to normal - no AP needed any more
+      }
+      discovery.rememberBridge(sysData.hostName);  // Rediscover this PC, not another bridge
       forceRefreshSystemInfo = false;   // Clear force refresh flag
     } else {
-      // Fetch failed - report to config manager
+      // Fetch failed - degrade step by step, stored config stays intact
       DEBUG_PRINTLN(F("[DATA] Failed to fetch system data"));
-      configMgr.reportServerFailure();  // Track server failures
+      recovery.reportFailure();
+      if (recovery.getTier() >= RECOVERY_REDISCOVER) {
+        discovery.request();            // Maybe the PC got a new IP - look it up in the background
+      }
+      if (recovery.getTier() == RECOVERY_AP) {
+        configMgr.startRecoveryAP();
+      }
+      
+      // Keep the last data up, marked stale (redraw everything right after the menu)
+      if (forced) {
+        drawCarouselPage();
+      } else if (carouselPage == 0) {
+        display.drawStaleBadge(recovery.getDataAgeMs() / 1000, configMgr.isRecoveryAP());
+      }
+      
+      network->setUpdateInterval(recovery.getRetryInterval(settingsMgr.isAdaptiveRefresh()
+                                   ? settingsMgr.getAdaptiveMaxInterval()   // Don't hammer a dead server
+                                   : settingsMgr.getRefreshInterval()));
       forceRefreshSystemInfo = false;   // Clear flag even on failure
     }
   }
+  
+  // Last resort: still critical after degrading - restart between fetches
+  if (heapGuard.restartDue() && !fwUpdater.isDownloading()) {
+    heapGuard.restart();
+  }
+  
+  // Nothing to do until the next fetch - let the radio/CPU sleep
+  // (no sleeping while a firmware download is streaming)
+  if (!fwUpdater.isDownloading()) {
+    CrashLog::stage(STAGE_IDLE);
+    power.idle(display.isEnabled() ? network->getTimeUntilUpdate() : PowerManager::IDLE_SLICE * 2);
+  }
 }
 
@@ -8,10 +8,13 @@
 #include "settings_manager.h"
 #include "config_manager.h"
 #include "ota_web_manager.h"
+#include "adaptive_refresh.h"
+#include "power_manager.h"
+#include "crash_log.h"
 
 MenuManager::MenuManager(DisplayManager* disp, SettingsManager* sets, ConfigManager* cfg, OTAWebManager* ota)
-  : display(disp), settings(sets), config(cfg), otaWeb(ota),
-    currentState(MENU_SYSTEM_INFO), subMenuState(SUBMENU_NONE),
+  : display(disp), settings(sets), config(cfg), otaWeb(ota), adaptive(nullptr), power(nullptr),
+    currentState(MENU_SYSTEM_INFO), subMenuState(SUBMENU_NONE), resetLogPage(0),
     menuActive(false), menuEnterTime(0), lastInteractionTime(0), onExitCallback(nullptr) {}
 
 void MenuManager::enter() {
@@ -71,18 +74,43 @@ void MenuManager::select() {
   if (subMenuState != SUBMENU_NONE) {
     switch (subMenuState) {
       case SUBMENU_REFRESH_SELECT:
-        // Cycle refresh rate
+        // Cycle refresh rate (Auto comes in a few min-max bounds)
         settings->cycleRefreshRate();
         settings->save();
+        if (adaptive && settings->isAdaptiveRefresh()) {
+          // New Auto bounds: start over so polls/min covers this mode only
+          adaptive->setBounds(settings->getAdaptiveMinInterval(), settings->getAdaptiveMaxInterval());
+          adaptive->reset(millis());
+        }
         handleRefreshRateMenu();
         break;
         
+      case SUBMENU_BRIGHTNESS_SELECT:
+        // Cycle brightness (applied immediately)
+        settings->cycleBrightness();
+        settings->save();
+        if (display) {
+          display->setBrightness(settings->getBacklightFull(), settings->getBacklightDim());
+        }
+        handleBrightnessMenu();
+        break;
+        
       case SUBMENU_NETWORK_DISPLAY:
         // Exit network info
         subMenuState = SUBMENU_NONE;
         drawMainMenu();
         break;
         
+      case SUBMENU_RESET_LOG_DISPLAY:
+        // Next (older) record, back to menu after the last one
+        if (++resetLogPage < CrashLog::count()) {
+          handleResetLogMenu();
+        } else {
+          subMenuState = SUBMENU_NONE;
+          drawMainMenu();
+        }
+        break;
+        
       case SUBMENU_CONFIRM_RESET:
         // Factory reset confirmed (ALL)
         DEBUG_PRINTLN(F("[MENU] Factory reset confirmed!"));
@@ -155,12 +183,25 @@ void MenuManager::select() {
       handleRefreshRateMenu();
       break;
       
+    case MENU_BRIGHTNESS:
+      // Enter brightness submenu
+      subMenuState = SUBMENU_BRIGHTNESS_SELECT;
+      handleBrightnessMenu();
+      break;
+      
     case MENU_NETWORK_INFO:
       // Show network info
       subMenuState = SUBMENU_NETWORK_DISPLAY;
       handleNetworkInfoMenu();
       break;
       
+    case MENU_RESET_LOG:
+      // Show newest reset record first
+      subMenuState = SUBMENU_RESET_LOG_DISPLAY;
+      resetLogPage = 0;
+      handleResetLogMenu();
+      break;
+      
     case MENU_SERVER_CONFIG:
       // Start server config portal
       DEBUG_PRINTLN(F("[MENU] Starting server config..."));
@@ -278,6 +319,35 @@ void MenuManager::handleRefreshRateMenu() {
   display->drawText(20, 40, "Current:", ST77XX_WHITE, 1);
   display->drawText(20, 60, settings->getRefreshRateText(), ST77XX_YELLOW, 2);
   
+  // Adaptive mode: bounds + measured poll rate
+  if (settings->isAdaptiveRefresh()) {
+    char line[24];
+    snprintf(line, sizeof(line), "%u-%ums", settings->getAdaptiveMinInterval(), settings->getAdaptiveMaxInterval());
+    display->drawText(20, 80, line, ST77XX_WHITE, 1);
+    
+    if (adaptive) {
+      char rate[8];
+      Fixed10::format(rate, sizeof(rate), adaptive->getPollsPerMinute(millis()));
+      snprintf(line, sizeof(line), "%s polls/min", rate);
+      display->drawText(20, 90, line, ST77XX_CYAN, 1);
+    }
+  }
+  
+  // Instructions
+  display->drawText(10, 100, "Press: Change", ST77XX_GREEN, 1);
+  display->drawText(10, 115, "Wait: Back", ST77XX_WHITE, 1);
+}
+
+void MenuManager::handleBrightnessMenu() {
+  if (!display || !settings) return;
+  
+  display->clear();
+  display->drawText(20, 10, "BRIGHTNESS", ST77XX_CYAN, 1);
+  
+  // Show current level
+  display->drawText(20, 40, "Current:", ST77XX_WHITE, 1);
+  display->drawText(20, 60, settings->getBrightnessText(), ST77XX_YELLOW, 2);
+  
   // Instructions
   display->drawText(10, 100, "Press: Change", ST77XX_GREEN, 1);
   display->drawText(10, 115, "Wait: Back", ST77XX_WHITE, 1);
@@ -302,11 +372,61 @@ void MenuManager::handleNetworkInfoMenu() {
   display->drawText(5, 110, rssi, ST77XX_CYAN, 1);
   
   // Uptime
-  display->drawText(5, 130, "Uptime:", ST77XX_WHITE, 1);
   unsigned long uptime = millis() / 1000;
-  char uptimeStr[16];
-  snprintf(uptimeStr, sizeof(uptimeStr), "%lum %lus", uptime / 60, uptime % 60);
-  display->drawText(5, 145, uptimeStr, ST77XX_WHITE, 1);
+  char uptimeStr[24];
+  snprintf(uptimeStr, sizeof(uptimeStr), "Up: %lum %lus", uptime / 60, uptime % 60);
+  display->drawText(5, 130, uptimeStr, ST77XX_WHITE, 1);
+  
+  // Estimated radio-on share (WiFi sleep mode)
+  if (power) {
+    char duty[8];
+    char radioStr[24];
+    Fixed10::format(duty, sizeof(duty), power->getRadioDutyPercent());
+    snprintf(radioStr, sizeof(radioStr), "Radio: %s%% on", duty);
+    display->drawText(5, 145, radioStr, ST77XX_CYAN, 1);
+  }
+}
+
+void MenuManager::handleResetLogMenu() {
+  if (!display) return;
+  
+  CrashRecord rec;
+  if (!CrashLog::get(resetLogPage, rec)) return;
+  
+  display->clear();
+  
+  char line[24];
+  snprintf(line, sizeof(line), "RESET LOG %u/%u", resetLogPage + 1, CrashLog::count());
+  display->drawText(15, 5, line, ST77XX_CYAN, 1);
+  
+  // Boot number + why it happened
+  snprintf(line, sizeof(line), "#%u", rec.boot);
+  display->drawText(5, 25, line, ST77XX_WHITE, 1);
+  display->drawText(45, 25, CrashLog::reasonName(rec.reason),
+                    CrashLog::isCrash(rec.reason) ? ST77XX_RED : ST77XX_GREEN, 1);
+  
+  // How the previous run ended
+  snprintf(line, sizeof(line), "Ran: %luh %lum", (unsigned long)rec.uptimeS / 3600, (unsigned long)(rec.uptimeS / 60) % 60);
+  display->drawText(5, 45, line, ST77XX_WHITE, 1);
+  snprintf(line, sizeof(line), "Stage: %s", CrashLog::stageName(rec.stage));
+  display->drawText(5, 57, line, ST77XX_YELLOW, 1);
+  snprintf(line, sizeof(line), "Heap: %u", rec.freeHeap);
+  display->drawText(5, 69, line, ST77XX_WHITE, 1);
+  
+  // Exception details + code addresses (decode with addr2line)
+  int16_t y = 89;
+  if (rec.epc1 != 0) {
+    snprintf(line, sizeof(line), "Exc %u @%08x", rec.exccause, (unsigned)rec.epc1);
+    display->drawText(5, y, line, ST77XX_RED, 1);
+    y += 12;
+  }
+  for (uint8_t i = 0; i < rec.depth; i++) {
+    snprintf(line, sizeof(line), "  %08x", (unsigned)rec.stack[i]);
+    display->drawText(5, y, line, ST77XX_CYAN, 1);
+    y += 10;
+  }
+  
+  display->drawText(10, 145, "Hold: Next", ST77XX_GREEN, 1);
 }
 
 void MenuManager::handleConfirmDialog(const char* title, const char* message) {
@@ -327,7 +447,9 @@ const char* MenuManager::getMenuItemText(MenuState state) {
   switch (state) {
     case MENU_SYSTEM_INFO:    return "System Info";
     case MENU_REFRESH_RATE:   return "Refresh Rate";
+    case MENU_BRIGHTNESS:     return "Brightness";
     case MENU_NETWORK_INFO:   return "Network Info";
+    case MENU_RESET_LOG:      return "Reset Log";
     case MENU_SERVER_CONFIG:  return "Server Config";
     case MENU_WIFI_CONFIG:    return "WiFi Config";
     case MENU_OTA_UPDATE:     return "OTA Update";
@@ -343,7 +465,9 @@ const char* MenuManager::getMenuItemIcon(MenuState state) {
   switch (state) {
     case MENU_SYSTEM_INFO:    return "*";
     case MENU_REFRESH_RATE:   return "o";
+    case MENU_BRIGHTNESS:     return "%";
     case MENU_NETWORK_INFO:   return "~";
+    case MENU_RESET_LOG:      return "&";
     case MENU_SERVER_CONFIG:  return "#";
     case MENU_WIFI_CONFIG:    return "@";
     case MENU_OTA_UPDATE:     return "^";
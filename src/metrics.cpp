@@ -0,0 +1,611 @@
+/*
+ * Metrics Implementation
+ */
+
+#include "config.h"
+#include "version.h"
+#include "metrics.h"
+#include "crash_log.h"
+#include "host_poller.h"
+#include "alert_engine.h"
+#include "settings_manager.h"
+#include "push_metrics.h"
+#include "layout_store.h"
+#include <ESP8266WiFi.h>
+#include <stdarg.h>
+
+// ============= MetricsWriter =============
+
+size_t MetricsWriter::write(uint8_t c) {
+  if (used == BUF_SIZE) flush();
+  buf[used++] = (char)c;
+  return 1;
+}
+
+size_t MetricsWriter::write(const uint8_t* data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    write(data[i]);
+  }
+  return len;
+}
+
+void MetricsWriter::flush() {
+  if (used > 0) {
+    sink.write(reinterpret_cast<const uint8_t*>(buf), used);
+    used = 0;
+  }
+}
+
+void MetricsWriter::appendf(const char* fmt, ...) {
+  va_list args, retry;
+  va_start(args, fmt);
+  va_copy(retry, args);
+  int n = vsnprintf(buf + used, BUF_SIZE - used, fmt, args);
+  if (n > 0 && (size_t)n >= BUF_SIZE - used && used > 0) {
+    // Clipped: send what is buffered and format the whole line again
+    flush();
+    n = vsnprintf(buf, BUF_SIZE, fmt, retry);
+  }
+  va_end(retry);
+  va_end(args);
+
+  if (n > 0) {
+    used += min((size_t)n, BUF_SIZE - used - 1);  // Only a single line over BUF_SIZE is cut
+  }
+}
+
+// ============= LatencyHistogram =============
+
+const uint16_t LatencyHistogram::BOUNDS_MS[LatencyHistogram::BUCKETS] = {
+  50, 100, 200, 500, 1000, 2000, 5000
+};
+
+LatencyHistogram::LatencyHistogram() : count(0), sumMs(0) {
+  memset(counts, 0, sizeof(counts));
+}
+
+void LatencyHistogram::record(uint32_t ms) {
+  uint8_t i = 0;
+  while (i < BUCKETS && ms > BOUNDS_MS[i]) i++;
+  counts[i]++;
+  count++;
+  sumMs += ms;
+}
+
+uint32_t LatencyHistogram::getCumulative(uint8_t bucket) const {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i <= bucket && i <= BUCKETS; i++) {
+    total += counts[i];
+  }
+  return total;
+}
+
+// ============= Metrics =============
+
+LatencyHistogram Metrics::fetchLatency;
+uint32_t Metrics::fetchOk = 0;
+uint32_t Metrics::fetchFail = 0;
+uint16_t Metrics::failStreak = 0;
+uint16_t Metrics::failStreakMax = 0;
+uint32_t Metrics::parseLastUs = 0;
+uint32_t Metrics::parseMaxUs = 0;
+uint32_t Metrics::renderLastUs = 0;
+uint32_t Metrics::renderMaxUs = 0;
+uint32_t Metrics::wifiConnects = 0;
+uint32_t Metrics::wifiDisconnects = 0;
+uint32_t Metrics::flashWrites = 0;
+uint32_t Metrics::dnsLookups = 0;
+uint8_t Metrics::recoveryTier = 0;
+uint32_t Metrics::outages = 0;
+uint32_t Metrics::recoveryLastMs = 0;
+uint32_t Metrics::recoveryMaxMs = 0;
+uint32_t Metrics::pushOk = 0;
+uint32_t Metrics::pushRejected = 0;
+uint32_t Metrics::pushValues = 0;
+uint32_t Metrics::pushBytes = 0;
+uint32_t Metrics::pushParseLastUs = 0;
+uint32_t Metrics::pushParseMaxUs = 0;
+uint32_t Metrics::pushParseSumUs = 0;
+uint8_t Metrics::heapLevel = 0;
+const HostPoller* Metrics::hosts = nullptr;
+const AlertEngine* Metrics::alerts = nullptr;
+
+static WiFiEventHandler gotIpHandler;
+static WiFiEventHandler disconnectHandler;
+
+void Metrics::begin() {
+  gotIpHandler = WiFi.onStationModeGotIP([](const WiFiEventStationModeGotIP&) {
+    wifiConnects++;
+  });
+  disconnectHandler = WiFi.onStationModeDisconnected([](const WiFiEventStationModeDisconnected&) {
+    wifiDisconnects++;
+  });
+  
+  // Already connected by the time setup() gets here
+  if (WiFi.status() == WL_CONNECTED) wifiConnects++;
+}
+
+void Metrics::recordFetch(uint32_t latencyMs, bool ok) {
+  fetchLatency.record(latencyMs);
+  
+  if (ok) {
+    fetchOk++;
+    failStreak = 0;
+  } else {
+    fetchFail++;
+    failStreak++;
+    if (failStreak > failStreakMax) failStreakMax = failStreak;
+  }
+}
+
+void Metrics::recordParse(uint32_t us) {
+  parseLastUs = us;
+  if (us > parseMaxUs) parseMaxUs = us;
+}
+
+void Metrics::recordRender(uint32_t us) {
+  renderLastUs = us;
+  if (us > renderMaxUs) renderMaxUs = us;
+}
+
+void Metrics::recordFlashWrite() {
+  flashWrites++;
+}
+
+void Metrics::recordPush(bool ok, uint16_t values, uint32_t bytes, uint32_t us) {
+  if (!ok) {
+    pushRejected++;
+    return;
+  }
+  pushOk++;
+  pushValues += values;
+  pushBytes += bytes;
+  pushParseLastUs = us;
+  pushParseSumUs += us;
+  if (us > pushParseMaxUs) pushParseMaxUs = us;
+}
+
+void Metrics::recordRecovery(uint32_t ms) {
+  outages++;
+  recoveryLastMs = ms;
+  if (ms > recoveryMaxMs) recoveryMaxMs = ms;
+}
+
+// One HELP/TYPE/value triple
+static void promMetric(MetricsWriter& out, const char* name, const char* type,
+                       const char* help, uint32_t value) {
+  out.appendf("# HELP %s %s\n", name, help);
+  out.appendf("# TYPE %s %s\n", name, type);
+  out.appendf("%s %u\n", name, value);
+}
+
+void Metrics::writePrometheus(MetricsWriter& out) {
+  out.appendf("# HELP hwmon_info Firmware build\n# TYPE hwmon_info gauge\n"
+              "hwmon_info{version=\"%s\",chip=\"%06x\"} 1\n", PROJECT_VERSION, ESP.getChipId());
+  
+  promMetric(out, "hwmon_uptime_seconds", "gauge", "Seconds since boot", millis() / 1000);
+  promMetric(out, "hwmon_heap_free_bytes", "gauge", "Free heap", ESP.getFreeHeap());
+  promMetric(out, "hwmon_heap_max_block_bytes", "gauge", "Largest allocatable block", ESP.getMaxFreeBlockSize());
+  promMetric(out, "hwmon_heap_fragmentation_percent", "gauge", "Heap fragmentation", ESP.getHeapFragmentation());
+  promMetric(out, "hwmon_heap_level", "gauge", "Heap guard level (0 ok, 1 low-memory, 2 critical)", heapLevel);
+  
+  out.appendf("# HELP hwmon_fetch_latency_ms Bridge fetch latency (HTTP GET + body)\n"
+              "# TYPE hwmon_fetch_latency_ms histogram\n");
+  for (uint8_t i = 0; i < LatencyHistogram::BUCKETS; i++) {
+    out.appendf("hwmon_fetch_latency_ms_bucket{le=\"%u\"} %u\n",
+                LatencyHistogram::BOUNDS_MS[i], fetchLatency.getCumulative(i));
+  }
+  out.appendf("hwmon_fetch_latency_ms_bucket{le=\"+Inf\"} %u\n", fetchLatency.getCount());
+  out.appendf("hwmon_fetch_latency_ms_sum %u\nhwmon_fetch_latency_ms_count %u\n",
+              fetchLatency.getSumMs(), fetchLatency.getCount());
+  
+  out.appendf("# HELP hwmon_fetch_total Bridge fetches by result\n# TYPE hwmon_fetch_total counter\n"
+              "hwmon_fetch_total{result=\"ok\"} %u\nhwmon_fetch_total{result=\"fail\"} %u\n",
+              fetchOk, fetchFail);
+  promMetric(out, "hwmon_server_fail_streak", "gauge", "Consecutive failed fetches", failStreak);
+  promMetric(out, "hwmon_server_fail_streak_max", "gauge", "Longest failure streak since boot", failStreakMax);
+  promMetric(out, "hwmon_recovery_tier", "gauge", "Server outage handling (0 ok, 1 stale, 2 rediscover, 3 backoff, 4 ap)", recoveryTier);
+  promMetric(out, "hwmon_outages_total", "counter", "Server outages recovered from", outages);
+  promMetric(out, "hwmon_recovery_last_ms", "gauge", "Time to recover from the last outage", recoveryLastMs);
+  promMetric(out, "hwmon_recovery_max_ms", "gauge", "Longest time to recover since boot", recoveryMaxMs);
+  
+  promMetric(out, "hwmon_parse_last_us", "gauge", "Last JSON parse time", parseLastUs);
+  promMetric(out, "hwmon_parse_max_us", "gauge", "Slowest JSON parse since boot", parseMaxUs);
+  promMetric(out, "hwmon_render_last_us", "gauge", "Last dashboard render time", renderLastUs);
+  promMetric(out, "hwmon_render_max_us", "gauge", "Slowest dashboard render since boot", renderMaxUs);
+  
+  out.appendf("# HELP hwmon_wifi_rssi_dbm WiFi signal strength\n# TYPE hwmon_wifi_rssi_dbm gauge\n"
+              "hwmon_wifi_rssi_dbm %d\n", (int)WiFi.RSSI());
+  promMetric(out, "hwmon_wifi_reconnects_total", "counter", "WiFi reconnects since boot", getWiFiReconnects());
+  promMetric(out, "hwmon_wifi_disconnects_total", "counter", "WiFi disconnect events", wifiDisconnects);
+  
+  promMetric(out, "hwmon_flash_writes_total", "counter", "EEPROM/flash commits since boot", flashWrites);
+  promMetric(out, "hwmon_dns_lookups_total", "counter", "Bridge hostname lookups (DNS cache misses)", dnsLookups);
+  
+  // Reset history (CrashLog)
+  CrashRecord rec;
+  uint8_t crashes = 0;
+  for (uint8_t i = 0; CrashLog::get(i, rec); i++) {
+    if (CrashLog::isCrash(rec.reason)) crashes++;
+  }
+  if (CrashLog::get(0, rec)) {
+    out.appendf("# HELP hwmon_reset_info Why this boot happened and where the previous run ended\n"
+                "# TYPE hwmon_reset_info gauge\n");
+    out.appendf("hwmon_reset_info{reason=\"%s\",stage=\"%s\"} 1\n",
+                CrashLog::reasonName(rec.reason), CrashLog::stageName(rec.stage));
+  }
+  promMetric(out, "hwmon_boot_count", "counter", "Boots recorded in the reset log", CrashLog::getBootCount());
+  promMetric(out, "hwmon_recent_crashes", "gauge", "Exception/watchdog resets among the logged boots", crashes);
+  
+  // Extra hosts (HostPoller)
+  if (hosts && hosts->count() > 0) {
+    out.appendf("# HELP hwmon_host_up Extra host answered its last polls\n# TYPE hwmon_host_up gauge\n");
+    for (uint8_t i = 0; i < hosts->count(); i++) {
+      out.appendf("hwmon_host_up{host=\"%s\"} %u\n", hosts->getAddress(i), hosts->isOnline(i) ? 1 : 0);
+    }
+    out.appendf("# HELP hwmon_host_latency_ms Last poll round trip\n# TYPE hwmon_host_latency_ms gauge\n");
+    for (uint8_t i = 0; i < hosts->count(); i++) {
+      out.appendf("hwmon_host_latency_ms{host=\"%s\"} %u\n", hosts->getAddress(i), hosts->getLatency(i));
+    }
+    out.appendf("# HELP hwmon_host_memory_bytes Heap held for the host's cached data\n# TYPE hwmon_host_memory_bytes gauge\n");
+    for (uint8_t i = 0; i < hosts->count(); i++) {
+      out.appendf("hwmon_host_memory_bytes{host=\"%s\"} %u\n", hosts->getAddress(i), hosts->getMemoryUsage(i));
+    }
+  }
+  
+  // Push ingest (values / parse_us_sum = parse throughput)
+  if (PUSH_ENABLED) {
+    out.appendf("# HELP hwmon_push_requests_total POST /push requests by result\n# TYPE hwmon_push_requests_total counter\n"
+                "hwmon_push_requests_total{result=\"ok\"} %u\nhwmon_push_requests_total{result=\"rejected\"} %u\n",
+                pushOk, pushRejected);
+    promMetric(out, "hwmon_push_values_total", "counter", "Pushed values stored", pushValues);
+    promMetric(out, "hwmon_push_bytes_total", "counter", "Accepted push body bytes", pushBytes);
+    promMetric(out, "hwmon_push_parse_last_us", "gauge", "Last push body parse time", pushParseLastUs);
+    promMetric(out, "hwmon_push_parse_max_us", "gauge", "Slowest push body parse since boot", pushParseMaxUs);
+    promMetric(out, "hwmon_push_parse_us_total", "counter", "Time spent parsing push bodies", pushParseSumUs);
+  }
+  
+  // Alert rules (AlertEngine), enabled slots only
+  if (alerts) {
+    out.appendf("# HELP hwmon_alert_active Alert rule tripped\n# TYPE hwmon_alert_active gauge\n");
+    for (uint8_t i = 0; i < alerts->getRuleCount(); i++) {
+      if (!alerts->isEnabled(i)) continue;
+      out.appendf("hwmon_alert_active{rule=\"%u\",metric=\"%s\"} %u\n", i,
+                  AlertEngine::metricName(alerts->getRule(i).metric), alerts->isActive(i) ? 1 : 0);
+    }
+  }
+}
+
+void Metrics::writeJson(MetricsWriter& out) {
+  out.appendf("{\"version\":\"%s\",\"chip\":\"%06x\",\"uptime_s\":%lu,",
+              PROJECT_VERSION, ESP.getChipId(), millis() / 1000);
+  out.appendf("\"heap\":{\"free\":%u,\"max_block\":%u,\"fragmentation\":%u,\"level\":%u},",
+              ESP.getFreeHeap(), ESP.getMaxFreeBlockSize(), ESP.getHeapFragmentation(), heapLevel);
+  
+  out.appendf("\"recovery\":{\"tier\":%u,\"outages\":%u,\"last_ms\":%u,\"max_ms\":%u},",
+              recoveryTier, outages, recoveryLastMs, recoveryMaxMs);
+  out.appendf("\"fetch\":{\"ok\":%u,\"fail\":%u,\"fail_streak\":%u,\"fail_streak_max\":%u,",
+              fetchOk, fetchFail, failStreak, failStreakMax);
+  out.appendf("\"latency_ms\":{\"count\":%u,\"sum\":%u,\"buckets\":{",
+              fetchLatency.getCount(), fetchLatency.getSumMs());
+  for (uint8_t i = 0; i < LatencyHistogram::BUCKETS; i++) {
+    out.appendf("\"%u\":%u,", LatencyHistogram::BOUNDS_MS[i], fetchLatency.getCumulative(i));
+  }
+  out.appendf("\"+Inf\":%u}}},", fetchLatency.getCount());
+  
+  out.appendf("\"parse_us\":{\"last\":%u,\"max\":%u},\"render_us\":{\"last\":%u,\"max\":%u},",
+              parseLastUs, parseMaxUs, renderLastUs, renderMaxUs);
+  out.appendf("\"wifi\":{\"rssi\":%d,\"reconnects\":%u,\"disconnects\":%u},",
+              (int)WiFi.RSSI(), getWiFiReconnects(), wifiDisconnects);
+  out.appendf("\"flash_writes\":%u,\"dns_lookups\":%u,\"resets\":[", flashWrites, dnsLookups);
+  
+  CrashRecord rec;
+  for (uint8_t i = 0; CrashLog::get(i, rec); i++) {
+    out.appendf("%s{\"boot\":%u,\"reason\":\"%s\",\"stage\":\"%s\",\"uptime_s\":%u,\"heap\":%u,",
+                i > 0 ? "," : "", rec.boot, CrashLog::reasonName(rec.reason),
+                CrashLog::stageName(rec.stage), rec.uptimeS, rec.freeHeap);
+    out.appendf("\"exccause\":%u,\"epc1\":\"0x%08x\",\"excvaddr\":\"0x%08x\",\"stack\":[",
+                rec.exccause, rec.epc1, rec.excvaddr);
+    for (uint8_t d = 0; d < rec.depth; d++) {
+      out.appendf("%s\"0x%08x\"", d > 0 ? "," : "", rec.stack[d]);
+    }
+    out.appendf("]}");
+  }
+  out.appendf("]");
+  
+  if (hosts) {
+    out.appendf(",\"hosts\":[");
+    for (uint8_t i = 0; i < hosts->count(); i++) {
+      out.appendf("%s{\"address\":\"%s\",\"name\":\"%s\",\"up\":%s,\"latency_ms\":%u,\"memory_bytes\":%u}",
+                  i > 0 ? "," : "", hosts->getAddress(i), hosts->getLabel(i),
+                  hosts->isOnline(i) ? "true" : "false", hosts->getLatency(i), hosts->getMemoryUsage(i));
+    }
+    out.appendf("]");
+  }
+  if (PUSH_ENABLED) {
+    out.appendf(",\"push\":{\"ok\":%u,\"rejected\":%u,\"values\":%u,\"bytes\":%u,"
+                "\"parse_us\":{\"last\":%u,\"max\":%u,\"sum\":%u}}",
+                pushOk, pushRejected, pushValues, pushBytes, pushParseLastUs, pushParseMaxUs, pushParseSumUs);
+  }
+  if (alerts) {
+    out.appendf(",\"alerts\":");
+    writeAlerts(out);
+  }
+  out.appendf("}");
+}
+
+void Metrics::writeAlerts(MetricsWriter& out) {
+  static const char* const ACTION_NAMES[] = { "highlight", "flash", "pulse" };
+  
+  out.appendf("[");
+  for (uint8_t i = 0; alerts && i < alerts->getRuleCount(); i++) {
+    const AlertRule& rule = alerts->getRule(i);
+    char raise[12], clear[12];
+    Fixed10::format(raise, sizeof(raise), rule.raiseAt);
+    Fixed10::format(clear, sizeof(clear), rule.clearAt);
+    out.appendf("%s{\"rule\":%u,\"metric\":\"%s\",\"raise\":%s,\"clear\":%s,\"sustain_s\":%u,\"actions\":[",
+                i > 0 ? "," : "", i, AlertEngine::metricName(rule.metric), raise, clear, rule.sustainS);
+    bool first = true;
+    for (uint8_t a = 0; a < 3; a++) {
+      if (!(rule.actions & (1 << a))) continue;
+      out.appendf("%s\"%s\"", first ? "" : ",", ACTION_NAMES[a]);
+      first = false;
+    }
+    out.appendf("],\"active\":%s}", alerts->isActive(i) ? "true" : "false");
+  }
+  out.appendf("]");
+}
+
+// ============= MetricsServer =============
+
+MetricsServer::MetricsServer(uint16_t port)
+  : server(port), started(false), alertEngine(nullptr), settings(nullptr), pushed(nullptr), layouts(nullptr) {}
+
+void MetricsServer::setAlerts(AlertEngine* engine, SettingsManager* store) {
+  alertEngine = engine;
+  settings = store;
+}
+
+void MetricsServer::begin() {
+  if (!METRICS_ENABLED || started) return;
+  
+  server.on("/metrics", HTTP_GET, [this]() { serve(false); });
+  server.on("/metrics.json", HTTP_GET, [this]() { serve(true); });
+  if (alertEngine && settings) {
+    server.on("/alerts", HTTP_GET, [this]() { serveAlerts(); });
+    server.on("/alerts", HTTP_POST, [this]() { updateAlert(); });
+  }
+  if (PUSH_ENABLED && pushed) {
+    static const char* headers[] = { "Content-Type" };
+    server.collectHeaders(headers, 1);
+    server.on("/push", HTTP_GET, [this]() { servePush(); });
+    server.on("/push", HTTP_POST, [this]() { ingestPush(); }, [this]() { receiveBody(PUSH_BODY_MAX); });
+  }
+  if (layouts) {
+    server.on("/layout", HTTP_GET, [this]() { serveLayout(); });
+    server.on("/layout", HTTP_POST, [this]() { updateLayout(); }, [this]() { receiveBody(LAYOUT_DESC_MAX); });
+  }
+  server.begin();
+  started = true;
+  
+  DEBUG_PRINTF("[METRICS] Serving on port %u\n", METRICS_PORT);
+}
+
+void MetricsServer::handle() {
+  if (started) server.handleClient();
+}
+
+// Bypass send()/String: raw headers + body straight onto the socket
+void MetricsServer::serve(bool json) {
+  WiFiClient& client = server.client();
+  
+  client.print(F("HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Type: "));
+  client.print(json ? F("application/json") : F("text/plain; version=0.0.4"));
+  client.print(F("\r\n\r\n"));
+  
+  {
+    MetricsWriter out(client);
+    if (json) {
+      Metrics::writeJson(out);
+    } else {
+      Metrics::writePrometheus(out);
+    }
+  }
+  
+  client.stop();
+}
+
+void MetricsServer::serveAlerts() {
+  WiFiClient& client = server.client();
+  
+  client.print(F("HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Type: application/json\r\n\r\n"));
+  {
+    MetricsWriter out(client);
+    Metrics::writeAlerts(out);
+  }
+  client.stop();
+}
+
+// POST /push, /alerts and /layout need ?token=<PUSH_TOKEN> when one is set
+bool MetricsServer::checkToken() {
+  if (strlen(PUSH_TOKEN) == 0 || server.arg("token") == PUSH_TOKEN) return true;
+  server.send(401, "text/plain", "Bad token\n");
+  return false;
+}
+
+// POST /alerts?rule=0&metric=cpu_temp&raise=90&clear=85&sustain=10&actions=highlight,flash
+// (actions=none empties the slot). Saved to EEPROM, applied right away.
+void MetricsServer::updateAlert() {
+  if (!checkToken()) return;
+
+  long slot = server.arg("rule").toInt();
+  int8_t metric = AlertEngine::metricFromName(server.arg("metric").c_str());
+  fixed10_t raise = 0, clear = 0;
+  bool valid = server.hasArg("rule") && slot >= 0 && slot < ALERT_RULE_MAX && metric >= 0 &&
+               Fixed10::parse(server.arg("raise").c_str(), raise);
+  if (valid && server.hasArg("clear")) {
+    valid = Fixed10::parse(server.arg("clear").c_str(), clear);
+  } else {
+    clear = raise;  // No hysteresis
+  }
+  long sustain = server.arg("sustain").toInt();
+  valid = valid && raise >= INT16_MIN && raise <= INT16_MAX && clear >= INT16_MIN && clear <= INT16_MAX &&
+          sustain >= 0 && sustain <= 255;
+  
+  uint8_t actions = 0;
+  String list = server.hasArg("actions") ? server.arg("actions") : String("highlight");
+  if (list.indexOf("highlight") >= 0) actions |= ALERT_HIGHLIGHT;
+  if (list.indexOf("flash") >= 0) actions |= ALERT_FLASH;
+  if (list.indexOf("pulse") >= 0) actions |= ALERT_PULSE;
+  if (actions == 0 && list != "none") valid = false;
+  
+  if (!valid) {
+    server.send(400, "text/plain", "Need rule=0..N, metric=<name>, raise=<value> [clear, sustain, actions]\n");
+    return;
+  }
+  
+  AlertRule rule = { (uint8_t)metric, actions, (int16_t)raise, (int16_t)clear, (uint8_t)sustain };
+  settings->setAlertRule((uint8_t)slot, rule);
+  if (!settings->saveAlerts()) {
+    server.send(500, "text/plain", "EEPROM write failed\n");
+    return;
+  }
+  alertEngine->setRules(settings->getAlertRules(), ALERT_RULE_MAX);
+  DEBUG_PRINTF("[ALERT] Rule %ld set: %s\n", slot, AlertEngine::metricName(metric));
+  serveAlerts();
+}
+
+// ============= POST bodies =============
+
+// Request body (/push, /layout) lands here chunk by chunk, then is parsed in place
+static constexpr size_t BODY_MAX = (PUSH_ENABLED && PUSH_BODY_MAX > LAYOUT_DESC_MAX) ? PUSH_BODY_MAX : LAYOUT_DESC_MAX;
+static char body[BODY_MAX + 1];
+static size_t bodyLen = 0;
+static bool bodyTooLarge = false;
+
+void MetricsServer::receiveBody(size_t limit) {
+  HTTPRaw& raw = server.raw();
+  if (raw.status == RAW_START) {
+    bodyLen = 0;
+    bodyTooLarge = false;
+  } else if (raw.status == RAW_WRITE) {
+    if (bodyLen + raw.currentSize > limit) {
+      bodyTooLarge = true;  // Keep draining, answer 413 at the end
+    } else {
+      memcpy(body + bodyLen, raw.buf, raw.currentSize);
+      bodyLen += raw.currentSize;
+    }
+  }
+}
+
+// ============= Push API =============
+
+void MetricsServer::servePush() {
+  WiFiClient& client = server.client();
+  unsigned long now = millis();
+  
+  client.print(F("HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Type: application/json\r\n\r\n"));
+  {
+    MetricsWriter out(client);
+    out.appendf("[");
+    for (uint8_t i = 0; i < pushed->count(); i++) {
+      const PushMetric& m = pushed->at(i);
+      char value[12];
+      Fixed10::format(value, sizeof(value), m.value);
+      out.appendf("%s{\"name\":\"%s\",\"value\":%s,\"age_s\":%lu}",
+                  i > 0 ? "," : "", m.name, value, (now - m.updatedAt) / 1000);
+    }
+    out.appendf("]");
+  }
+  client.stop();
+}
+
+// POST /push[?token=...] with a JSON object or Content-Type: application/octet-stream
+void MetricsServer::ingestPush() {
+  if (!checkToken()) {
+    bodyLen = 0;  // Drop the rejected body
+    bodyTooLarge = false;
+    Metrics::recordPush(false, 0, 0, 0);
+    return;
+  }
+  if (bodyTooLarge) {
+    bodyLen = 0;
+    bodyTooLarge = false;
+    Metrics::recordPush(false, 0, 0, 0);
+    server.send(413, "text/plain", "Body too large\n");
+    return;
+  }
+  
+  bool binary = server.header("Content-Type").startsWith("application/octet-stream");
+  uint32_t start = micros();
+  int16_t stored = binary ? pushed->ingestBinary((const uint8_t*)body, bodyLen, millis())
+                          : pushed->ingestJson(body, bodyLen, millis());
+  uint32_t us = micros() - start;
+  size_t bytes = bodyLen;
+  bodyLen = 0;  // A bodiless POST never gets RAW_START
+  
+  if (stored < 0) {
+    Metrics::recordPush(false, 0, 0, 0);
+    server.send(400, "text/plain", binary ? "Bad binary frame\n" : "Bad JSON\n");
+    return;
+  }
+  Metrics::recordPush(true, stored, bytes, us);
+  
+  char reply[48];
+  snprintf(reply, sizeof(reply), "{\"stored\":%d,\"parse_us\":%u}\n", stored, us);
+  server.send(200, "application/json", reply);
+}
+
+// ============= Layout =============
+
+void MetricsServer::serveLayout() {
+  WiFiClient& client = server.client();
+  
+  client.print(F("HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Type: application/json\r\n\r\n"));
+  {
+    MetricsWriter out(client);
+    out.appendf("{\"id\":\"%08x\",\"custom\":%s,\"pinned\":%s,\"tiles\":[",
+                layouts->getId(), layouts->isCustom() ? "true" : "false", layouts->isPinned() ? "true" : "false");
+    const TileSlot* slots = layouts->getSlots();
+    for (uint8_t i = 0; i < layouts->getCount(); i++) {
+      const TileSlot& t = slots[i];
+      out.appendf("%s{\"tile\":\"%s\",\"x\":%d,\"y\":%d,\"w\":%d,\"h\":%d",
+                  i > 0 ? "," : "", LayoutStore::kindName(t.kind), t.x, t.y, t.w, t.h);
+      if (t.metric) out.appendf(",\"metric\":\"%s\"", t.metric);
+      out.appendf("}");
+    }
+    out.appendf("]}");
+  }
+  client.stop();
+}
+
+// POST /layout with a descriptor (server/layout_compiler.py), or /layout?reset=1
+// for the built-in one. Saved to flash, drawn on the next frame. A POSTed layout
+// is pinned: the bridge's LAYOUT_FILE no longer replaces it until the reset.
+void MetricsServer::updateLayout() {
+  if (!checkToken()) {
+    bodyLen = 0;
+    bodyTooLarge = false;
+    return;
+  }
+  size_t len = bodyLen;
+  bodyLen = 0;
+  if (bodyTooLarge) {
+    bodyTooLarge = false;
+    server.send(413, "text/plain", "Layout too large\n");
+    return;
+  }
+  
+  if (server.arg("reset") == "1") {
+    layouts->reset();
+  } else if (!layouts->apply((const uint8_t*)body, len, true)) {
+    char reply[64];
+    snprintf(reply, sizeof(reply), "Bad layout: %s\n", layouts->getError());
+    server.send(400, "text/plain", reply);
+    return;
+  } else if (!layouts->save()) {
+    DEBUG_PRINTLN(F("[LAYOUT] Not saved - active until reboot"));
+  }
+  DEBUG_PRINTF("[LAYOUT] %u tiles (%08x)\n", layouts->getCount(), layouts->getId());
+  serveLayout();
+}
@@ -4,11 +4,40 @@
 
 #include "config.h"
 #include "network_manager.h"
+#include "metrics.h"
+#include "system_data_json.h"
 #include <ArduinoJson.h>
 
-NetworkManager::NetworkManager(const char* wifiSsid, const char* wifiPass, String serverURL, unsigned long interval)
-  : ssid(wifiSsid), password(wifiPass), serverUrl(serverURL), 
-    lastUpdate(0), updateInterval(interval) {}
+NetworkManager::NetworkManager(const char* wifiSsid, const char* wifiPass, const char* serverHost,
+                               uint16_t serverPort, unsigned long interval)
+  : ssid(wifiSsid), password(wifiPass),
+    targetPort(0), lastUpdate(0), updateInterval(interval), lowMemory(false) {
+  setServer(serverHost, serverPort);
+}
+
+void NetworkManager::setServer(const char* host, uint16_t port) {
+  targetHost = host;
+  targetPort = port;
+  buildRequest();
+}
+
+bool NetworkManager::refreshServerName() {
+  if (server.isLiteral()) return false;
+  server.invalidate();  // No serve-stale: only a fresh answer counts
+  IPAddress ip;
+  return server.resolve(ip);
+}
+
+// Low-memory mode also asks for shorter disk/NIC lists
+void NetworkManager::setLowMemory(bool on) {
+  if (on == lowMemory) return;
+  lowMemory = on;
+  buildRequest();
+}
+
+void NetworkManager::buildRequest() {
+  server.set(targetHost.c_str(), targetPort, lowMemory ? SYSTEM_INFO_PATH_LOW : SYSTEM_INFO_PATH);
+}
 
 bool NetworkManager::connectWiFi(int maxAttempts) {
   // Always use password from EEPROM
@@ -52,82 +81,176 @@ void NetworkManager::reconnect() {
   delay(3000);
 }
 
+// Status code of the reply; leaves the stream at the first body byte
+int NetworkManager::readResponseHead(int32_t& contentLength) {
+  char line[64];
+  contentLength = -1;
+  
+  size_t n = wifiClient.readBytesUntil('\n', line, sizeof(line) - 1);
+  line[n] = '\0';
+  const char* code = strchr(line, ' ');
+  if (strncmp(line, "HTTP/", 5) != 0 || !code) return -1;
+  int status = atoi(code + 1);
+  
+  // Headers until the blank line (only Content-Length matters)
+  while (true) {
+    n = wifiClient.readBytesUntil('\n', line, sizeof(line) - 1);
+    if (n == 0) return -1;  // Timeout / closed mid-header
+    line[n] = '\0';
+    if (line[n - 1] == '\r') line[--n] = '\0';
+    if (n == 0) break;
+    if (strncasecmp(line, "Content-Length:", 15) == 0) {
+      contentLength = atol(line + 15);
+    }
+  }
+  return status;
+}
+
+// Read the whole body (Content-Length, or until the server closes)
+bool NetworkManager::readBody(String& payload, int32_t contentLength) {
+  payload.reserve(contentLength > 0 ? contentLength : 1024);
+  
+  char chunk[128];
+  unsigned long lastData = millis();
+  while (contentLength < 0 || (int32_t)payload.length() < contentLength) {
+    int n = wifiClient.read((uint8_t*)chunk, sizeof(chunk));
+    if (n > 0) {
+      payload.concat(chunk, n);
+      lastData = millis();
+    } else if (!wifiClient.connected()) {
+      break;
+    } else if (millis() - lastData > HTTP_TIMEOUT) {
+      return false;
+    } else {
+      delay(1);
+    }
+  }
+  return contentLength < 0 || (int32_t)payload.length() >= contentLength;
+}
+
 bool NetworkManager::fetchSystemData(SystemData& data) {
   if (!isConnected()) {
     return false;
   }
   
-  HTTPClient http;
-  http.begin(wifiClient, serverUrl.c_str());
-  http.setTimeout(5000);
-  
-  int httpCode = http.GET();
+  unsigned long fetchStart = millis();
   bool success = false;
+  int status = -1;
   
-  if (httpCode == HTTP_CODE_OK) {
-    String payload = http.getString();
-    
-    DynamicJsonDocument doc(2048);
-    DeserializationError error = deserializeJson(doc, payload);
+  // Cached address + prebuilt request: no DNS, no URL String per fetch
+  IPAddress ip;
+  wifiClient.setTimeout(HTTP_TIMEOUT);
+  if (!server.resolve(ip)) {
+    #ifdef DEBUG_NETWORK
+    DEBUG_PRINTLN(F("[NET] Cannot resolve server"));
+    #endif
+  } else if (!wifiClient.connect(ip, server.getPort())) {
+    server.invalidate();  // Maybe it moved - ask DNS next time
+    #ifdef DEBUG_NETWORK
+    DEBUG_PRINTLN(F("[NET] Connect failed"));
+    #endif
+  } else {
+    wifiClient.setNoDelay(true);
+    wifiClient.write((const uint8_t*)server.getRequest(), server.getRequestLength());
+    int32_t contentLength;
+    status = readResponseHead(contentLength);
     
-    if (!error) {
-      // Parse CPU
-      data.cpuName = doc["cpu"]["name"].as<String>();
-      data.cpuTemp = doc["cpu"]["temp"].as<float>();
-      data.cpuLoad = doc["cpu"]["load"].as<float>();
-      data.cpuPower = doc["cpu"]["power"].as<float>();
+    if (status == 200) {
+      DynamicJsonDocument doc(lowMemory ? JSON_POOL_LOW : JSON_POOL_SIZE);
+      DeserializationError error = DeserializationError::IncompleteInput;
+      unsigned long latency;
+      uint32_t parseStartUs;
       
-      // Parse RAM
-      data.ramUsed = doc["ram"]["used"].as<float>();
-      data.ramTotal = doc["ram"]["total"].as<float>();
-      data.ramPercent = doc["ram"]["percent"].as<float>();
-      
-      // Parse GPU
-      data.gpuName = doc["gpu_discrete"]["name"].as<String>();
-      data.gpuTemp = doc["gpu_discrete"]["temp"].as<float>();
-      data.gpuLoad = doc["gpu_discrete"]["load"].as<float>();
-      data.gpuPower = doc["gpu_discrete"]["power"].as<float>();
-      data.gpuMemUsed = doc["gpu_discrete"]["mem_used"].as<int>();
-      data.gpuMemTotal = doc["gpu_discrete"]["mem_total"].as<int>();
+      #ifdef DEBUG_PERF
+      uint32_t parseStart;
+      #endif
       
-      // Parse Disks
-      JsonArray disks = doc["disk"].as<JsonArray>();
-      if (disks.size() > 0) {
-        data.disk1Name = disks[0]["name"].as<String>();
-        data.disk1Temp = disks[0]["temp"].as<float>();
-        data.disk1Load = disks[0]["load"].as<float>();
+      if (lowMemory) {
+        // Parse while receiving: no payload String, unused fields never stored
+        // (parse time then includes the transfer)
+        StaticJsonDocument<SystemDataJson::FILTER_CAPACITY> filter;
+        SystemDataJson::buildFilter(filter);
+        parseStartUs = micros();
+        #ifdef DEBUG_PERF
+        parseStart = ESP.getCycleCount();
+        #endif
+        error = deserializeJson(doc, wifiClient, DeserializationOption::Filter(filter));
+        latency = millis() - fetchStart;
+      } else {
+        String payload;
+        bool complete = readBody(payload, contentLength);
+        latency = millis() - fetchStart;
+        parseStartUs = micros();
+        #ifdef DEBUG_PERF
+        parseStart = ESP.getCycleCount();
+        #endif
+        if (complete) {
+          error = deserializeJson(doc, payload);
+        }
       }
-      if (disks.size() > 1) {
-        data.disk2Name = disks[1]["name"].as<String>();
-        data.disk2Temp = disks[1]["temp"].as<float>();
-        data.disk2Load = disks[1]["load"].as<float>();
-      }
-      
-      // Parse Network
-      data.netName = doc["network"]["name"].as<String>();
-      data.netDown = doc["network"]["download"].as<float>();
-      data.netUp = doc["network"]["upload"].as<float>();
       
-      data.hasData = true;
-      success = true;
-    } else {
-      data.hasData = false;
-      #ifdef DEBUG_NETWORK
-      DEBUG_PRINTLN(F("[NET] JSON parse error!"));
-      #endif
+      if (!error) {
+        SystemDataJson::parse(doc, data);
+        success = true;
+        Metrics::recordParse(micros() - parseStartUs);
+        
+        #ifdef DEBUG_PERF
+        DEBUG_PRINTF("[PERF] Parse: %u cycles\n", ESP.getCycleCount() - parseStart);
+        #endif
+      } else {
+        #ifdef DEBUG_NETWORK
+        DEBUG_PRINT(F("[NET] JSON parse error: "));
+        DEBUG_PRINTLN(error.c_str());
+        #endif
+      }
+      Metrics::recordFetch(latency, success);
     }
-  } else {
-    data.hasData = false;
+    wifiClient.stop();
+  }
+  
+  if (status != 200) {
     #ifdef DEBUG_NETWORK
     DEBUG_PRINT(F("[NET] HTTP error: "));
-    DEBUG_PRINTLN(httpCode);
+    DEBUG_PRINTLN(status);
     #endif
+    Metrics::recordFetch(millis() - fetchStart, false);
   }
-  
-  http.end();
+  // On failure the last good sample stays (hasData too): RecoveryPolicy owns the outage state
   return success;
 }
 
+bool NetworkManager::fetchLayout(uint8_t* buf, size_t cap, size_t& len) {
+  if (!isConnected()) {
+    return false;
+  }
+  
+  IPAddress ip;
+  wifiClient.setTimeout(HTTP_TIMEOUT);
+  if (!server.resolve(ip) || !wifiClient.connect(ip, server.getPort())) {
+    return false;
+  }
+  
+  char request[128];
+  int n = snprintf(request, sizeof(request), "GET /layout HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n",
+                   server.getHost());
+  wifiClient.write((const uint8_t*)request, n);
+  
+  int32_t contentLength;
+  int status = readResponseHead(contentLength);
+  bool ok = status == 200 && contentLength > 0 && (size_t)contentLength <= cap &&
+            wifiClient.readBytes((char*)buf, contentLength) == (size_t)contentLength;
+  wifiClient.stop();
+  
+  #ifdef DEBUG_NETWORK
+  if (!ok) {
+    DEBUG_PRINT(F("[NET] Layout fetch failed: "));
+    DEBUG_PRINTLN(status);
+  }
+  #endif
+  len = ok ? contentLength : 0;
+  return ok;
+}
+
 bool NetworkManager::shouldUpdate() {
   unsigned long currentMillis = millis();
   if (currentMillis - lastUpdate >= updateInterval) {
@@ -137,6 +260,11 @@ bool NetworkManager::shouldUpdate() {
   return false;
 }
 
+unsigned long NetworkManager::getTimeUntilUpdate() const {
+  unsigned long elapsed = millis() - lastUpdate;
+  return (elapsed >= updateInterval) ? 0 : updateInterval - elapsed;
+}
+
 void NetworkManager::resetUpdateTimer() {
   lastUpdate = millis();
 }
@@ -0,0 +1,169 @@
+/*
+ * OTA Session Implementation
+ */
+
+#include "config.h"
+#include "ota_session.h"
+#include <Updater.h>
+
+OtaSession::OtaSession()
+  : state(OTA_IDLE), size(0), rawSize(0), received(0),
+    firstByteMs(0), lastByteMs(0), error("") {
+  memset(expected, 0, sizeof(expected));
+}
+
+bool OtaSession::parseHex(const char* hex, uint8_t* out, size_t outLen) {
+  if (hex == nullptr || strlen(hex) != outLen * 2) return false;
+
+  for (size_t i = 0; i < outLen * 2; i++) {
+    char c = hex[i];
+    uint8_t nibble;
+    if (c >= '0' && c <= '9')      nibble = c - '0';
+    else if (c >= 'a' && c <= 'f') nibble = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F') nibble = c - 'A' + 10;
+    else return false;
+
+    if (i & 1) out[i / 2] |= nibble;
+    else       out[i / 2] = nibble << 4;
+  }
+  return true;
+}
+
+bool OtaSession::begin(uint32_t imageSize, const char* sha256Hex, uint32_t imageRawSize) {
+  uint8_t digest[DIGEST_LEN];
+  if (imageSize == 0 || !parseHex(sha256Hex, digest, DIGEST_LEN)) {
+    fail("bad manifest");
+    return false;
+  }
+
+  // Same image still in flight -> resume where we left off
+  if (state == OTA_RECEIVING && imageSize == size &&
+      memcmp(digest, expected, DIGEST_LEN) == 0) {
+    DEBUG_PRINTF("[OTA] Resuming at %u/%u\n", received, size);
+    return true;
+  }
+
+  abort();
+
+  uint32_t maxSketchSpace = (ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000;
+  if (imageSize > maxSketchSpace || !Update.begin(imageSize)) {
+    Update.printError(Serial);
+    fail("image too large");
+    return false;
+  }
+
+  memcpy(expected, digest, DIGEST_LEN);
+  br_sha256_init(&sha);
+  size = imageSize;
+  rawSize = imageRawSize;
+  received = 0;
+  firstByteMs = 0;
+  lastByteMs = 0;
+  error = "";
+  state = OTA_RECEIVING;
+
+  DEBUG_PRINTF("[OTA] Session started: %u bytes%s\n", size, isCompressed() ? " (gzip)" : "");
+  return true;
+}
+
+OtaWriteResult OtaSession::write(uint32_t offset, const uint8_t* data, size_t len) {
+  if (state != OTA_RECEIVING) return OTA_WRITE_ERROR;
+  if (offset > received) return OTA_WRITE_GAP;
+
+  // Skip whatever part of this piece we already have
+  uint32_t overlap = received - offset;
+  if (overlap >= len) return OTA_WRITE_DUPLICATE;
+  data += overlap;
+  len -= overlap;
+
+  if (received + len > size) {
+    fail("image larger than manifest");
+    return OTA_WRITE_ERROR;
+  }
+
+  unsigned long now = millis();
+  if (firstByteMs == 0) firstByteMs = now;
+  lastByteMs = now;
+
+  br_sha256_update(&sha, data, len);
+
+  // Final piece: verify before it reaches flash
+  if (received + len == size) {
+    return finish(data, len) ? OTA_WRITE_OK : OTA_WRITE_ERROR;
+  }
+
+  if (Update.write(const_cast<uint8_t*>(data), len) != len) {
+    Update.printError(Serial);
+    fail("flash write failed");
+    return OTA_WRITE_ERROR;
+  }
+
+  received += len;
+  return OTA_WRITE_OK;
+}
+
+bool OtaSession::finish(const uint8_t* tail, size_t len) {
+  uint8_t digest[DIGEST_LEN];
+  br_sha256_out(&sha, digest);
+
+  if (memcmp(digest, expected, DIGEST_LEN) != 0) {
+    fail("sha256 mismatch");
+    return false;
+  }
+
+  if (Update.write(const_cast<uint8_t*>(tail), len) != len || !Update.end()) {
+    Update.printError(Serial);
+    fail("flash commit failed");
+    return false;
+  }
+
+  received += len;
+  state = OTA_VERIFIED;
+
+  DEBUG_PRINTF("[OTA] Verified %u bytes @ %u.%u KB/s\n",
+               size, getRateKBps10() / 10, getRateKBps10() % 10);
+  return true;
+}
+
+void OtaSession::fail(const char* reason) {
+  DEBUG_PRINT(F("[OTA] Session failed: "));
+  DEBUG_PRINTLN(reason);
+
+  // Unfinished Updater -> end(false) discards it, boot image is unchanged
+  if (state == OTA_RECEIVING) {
+    Update.end(false);
+  }
+  state = OTA_FAILED;
+  error = reason;
+}
+
+void OtaSession::abort() {
+  if (state == OTA_RECEIVING) {
+    Update.end(false);
+    DEBUG_PRINTLN(F("[OTA] Session aborted"));
+  }
+  state = OTA_IDLE;
+  size = 0;
+  rawSize = 0;
+  received = 0;
+  error = "";
+}
+
+uint8_t OtaSession::getPercent() const {
+  if (size == 0) return 0;
+  return (uint8_t)((uint64_t)received * 100 / size);
+}
+
+uint32_t OtaSession::getRateKBps10() const {
+  unsigned long elapsed = lastByteMs - firstByteMs;
+  if (firstByteMs == 0 || elapsed == 0) return 0;
+
+  // bytes/ms * 1000 / 1024 * 10
+  return (uint32_t)((uint64_t)received * 10000 / 1024 / elapsed);
+}
+
+uint32_t OtaSession::getEffectiveRateKBps10() const {
+  uint32_t rate = getRateKBps10();
+  if (!isCompressed()) return rate;
+  return (uint32_t)((uint64_t)rate * rawSize / size);
+}
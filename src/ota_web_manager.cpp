@@ -5,10 +5,13 @@
 #include "config.h"
 #include "version.h"
 #include "ota_web_manager.h"
+#include "web_page.h"
+#include "web_assets.h"
 
 OTAWebManager::OTAWebManager() 
-  : display(nullptr), webServer(nullptr), httpUpdater(nullptr), 
-    isActive(false), currentIP("") {}
+  : display(nullptr), webServer(nullptr),
+    isActive(false), currentIP(""),
+    chunkOffset(0), chunkRejected(false), lastProgressDraw(0) {}
 
 OTAWebManager::~OTAWebManager() {
   stop();
@@ -44,162 +47,102 @@ void OTAWebManager::showClosedScreen() {
   delay(1500);
 }
 
-String OTAWebManager::generateRootHTML() {
-  String html = F("<!DOCTYPE html><html><head><meta charset='UTF-8'>");
-  html += F("<meta name='viewport' content='width=device-width,initial-scale=1'>");
-  html += F("<title>Firmware Update</title>");
-  html += F("<style>");
-  html += F("*{margin:0;padding:0;box-sizing:border-box}");
-  html += F("body{font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',sans-serif;");
-  html += F("background:linear-gradient(135deg,#667eea 0%,#764ba2 100%);");
-  html += F("min-height:100vh;display:flex;align-items:center;justify-content:center}");
-  html += F(".container{background:white;padding:40px;border-radius:10px;");
-  html += F("box-shadow:0 10px 40px rgba(0,0,0,0.2);max-width:500px;text-align:center}");
-  html += F("h1{color:#333;margin-bottom:10px;font-size:28px}");
-  html += F("p{color:#666;margin-bottom:30px;line-height:1.6}");
-  html += F(".btn{display:inline-block;padding:15px 40px;background:#667eea;");
-  html += F("color:white;text-decoration:none;border-radius:5px;font-weight:600;");
-  html += F("transition:all 0.3s}");
-  html += F(".btn:hover{background:#5568d3;transform:translateY(-2px)}");
-  html += F(".info{background:#f8f9fa;padding:15px;border-radius:5px;");
-  html += F("margin-bottom:20px;font-size:14px;color:#555}");
-  html += F("</style></head><body>");
-  html += F("<div class='container'>");
-  html += F("<h1>Firmware Update</h1>");
-  html += F("<p>");
-  html += F(PROJECT_NAME);
-  html += F(" v");
-  html += F(PROJECT_VERSION);
-  html += F("</p>");
-  html += F("<div class='info'>Click the button below to access the firmware update page. ");
-  html += F("You can upload a new .bin file to update your device.</div>");
-  html += F("<a href='/update' class='btn'>Update Firmware</a>");
-  html += F("</div></body></html>");
-  return html;
+void OTAWebManager::sendRootPage() {
+  WebPage::sendTemplate(*webServer, "text/html", WEB_OTA_ROOT_TPL,
+    [](const char* key, char* out, size_t outLen) {
+      if (strcmp(key, "PROJECT") == 0) {
+        strncpy_P(out, PSTR(PROJECT_NAME), outLen - 1);
+      } else if (strcmp(key, "VERSION") == 0) {
+        strncpy_P(out, PSTR(PROJECT_VERSION), outLen - 1);
+      }
+      out[outLen - 1] = '\0';
+    });
 }
 
-String OTAWebManager::generateUpdateHTML() {
-  String html = F("<!DOCTYPE html><html><head><meta charset='UTF-8'>");
-  html += F("<meta name='viewport' content='width=device-width,initial-scale=1'>");
-  html += F("<title>Upload Firmware</title>");
-  html += F("<style>");
-  html += F("*{margin:0;padding:0;box-sizing:border-box}");
-  html += F("body{font-family:-apple-system,BlinkMacSystemFont,'Segoe UI',sans-serif;");
-  html += F("background:linear-gradient(135deg,#667eea 0%,#764ba2 100%);");
-  html += F("min-height:100vh;display:flex;align-items:center;justify-content:center;padding:20px}");
-  html += F(".container{background:white;padding:40px;border-radius:10px;");
-  html += F("box-shadow:0 10px 40px rgba(0,0,0,0.2);max-width:600px;width:100%}");
-  html += F("h1{color:#333;margin-bottom:10px;font-size:28px;text-align:center}");
-  html += F("p{color:#666;margin-bottom:30px;line-height:1.6;text-align:center}");
-  html += F(".upload-area{border:2px dashed #667eea;border-radius:8px;padding:40px;");
-  html += F("text-align:center;cursor:pointer;transition:all 0.3s;margin-bottom:20px}");
-  html += F(".upload-area:hover{border-color:#5568d3;background:#f8f9ff}");
-  html += F(".upload-area.dragover{border-color:#5568d3;background:#e8eaff}");
-  html += F("input[type=file]{display:none}");
-  html += F(".file-icon{font-size:48px;color:#667eea;margin-bottom:15px}");
-  html += F(".file-name{color:#333;font-weight:600;margin:10px 0}");
-  html += F(".file-size{color:#999;font-size:14px}");
-  html += F(".btn{display:block;width:100%;padding:15px;background:#667eea;color:white;");
-  html += F("border:none;border-radius:5px;font-weight:600;font-size:16px;cursor:pointer;");
-  html += F("transition:all 0.3s;margin-top:20px}");
-  html += F(".btn:hover:not(:disabled){background:#5568d3;transform:translateY(-2px)}");
-  html += F(".btn:disabled{background:#ccc;cursor:not-allowed}");
-  html += F(".progress{display:none;margin-top:20px}");
-  html += F(".progress-bar{height:30px;background:#f0f0f0;border-radius:15px;overflow:hidden}");
-  html += F(".progress-fill{height:100%;background:linear-gradient(90deg,#667eea,#764ba2);");
-  html += F("transition:width 0.3s;display:flex;align-items:center;justify-content:center;");
-  html += F("color:white;font-weight:600}");
-  html += F(".status{text-align:center;margin-top:15px;color:#666;font-size:14px}");
-  html += F(".success{color:#28a745;font-weight:600}");
-  html += F(".error{color:#dc3545;font-weight:600}");
-  html += F("</style></head><body>");
-  html += F("<div class='container'>");
-  html += F("<h1>Upload Firmware</h1>");
-  html += F("<p>Select a .bin file to update your device</p>");
-  html += F("<form id='uploadForm' method='POST' enctype='multipart/form-data'>");
-  html += F("<div class='upload-area' id='uploadArea'>");
-  html += F("<div class='file-icon'>📁</div>");
-  html += F("<div id='fileName'>Click or drag file here</div>");
-  html += F("<div id='fileSize' class='file-size'></div>");
-  html += F("<input type='file' id='fileInput' name='firmware' accept='.bin'>");
-  html += F("</div>");
-  html += F("<button type='submit' class='btn' id='uploadBtn' disabled>Upload Firmware</button>");
-  html += F("</form>");
-  html += F("<div class='progress' id='progress'>");
-  html += F("<div class='progress-bar'><div class='progress-fill' id='progressFill'>0%</div></div>");
-  html += F("<div class='status' id='status'></div>");
-  html += F("</div>");
-  html += F("</div>");
-  html += F("<script>");
-  html += F("const area=document.getElementById('uploadArea');");
-  html += F("const input=document.getElementById('fileInput');");
-  html += F("const btn=document.getElementById('uploadBtn');");
-  html += F("const form=document.getElementById('uploadForm');");
-  html += F("const fileName=document.getElementById('fileName');");
-  html += F("const fileSize=document.getElementById('fileSize');");
-  html += F("const progress=document.getElementById('progress');");
-  html += F("const progressFill=document.getElementById('progressFill');");
-  html += F("const status=document.getElementById('status');");
-  html += F("area.onclick=()=>input.click();");
-  html += F("input.onchange=e=>{const f=e.target.files[0];");
-  html += F("if(f){fileName.textContent=f.name;fileSize.textContent=(f.size/1024).toFixed(1)+'KB';");
-  html += F("btn.disabled=false}};");
-  html += F("['dragover','dragenter'].forEach(e=>area.addEventListener(e,ev=>{");
-  html += F("ev.preventDefault();area.classList.add('dragover')}));");
-  html += F("['dragleave','drop'].forEach(e=>area.addEventListener(e,()=>area.classList.remove('dragover')));");
-  html += F("area.addEventListener('drop',e=>{e.preventDefault();");
-  html += F("const f=e.dataTransfer.files[0];if(f&&f.name.endsWith('.bin')){");
-  html += F("input.files=e.dataTransfer.files;fileName.textContent=f.name;");
-  html += F("fileSize.textContent=(f.size/1024).toFixed(1)+'KB';btn.disabled=false}});");
-  html += F("form.onsubmit=async e=>{e.preventDefault();");
-  html += F("const f=input.files[0];if(!f)return;");
-  html += F("btn.disabled=true;progress.style.display='block';");
-  html += F("const fd=new FormData();fd.append('firmware',f);");
-  html += F("const xhr=new XMLHttpRequest();");
-  html += F("xhr.upload.onprogress=e=>{if(e.lengthComputable){");
-  html += F("const p=Math.round(e.loaded/e.total*100);");
-  html += F("progressFill.style.width=p+'%';progressFill.textContent=p+'%';");
-  html += F("status.textContent='Uploading...'}};");
-  html += F("xhr.onload=()=>{if(xhr.status===200){");
-  html += F("progressFill.style.width='100%';progressFill.textContent='100%';");
-  html += F("status.textContent='Upload complete! Rebooting...';status.className='status success';");
-  html += F("setTimeout(()=>location.href='/',3000)}else{");
-  html += F("status.textContent='Upload failed!';status.className='status error';btn.disabled=false}};");
-  html += F("xhr.onerror=()=>{status.textContent='Upload error!';status.className='status error';btn.disabled=false};");
-  html += F("xhr.open('POST','/upload');xhr.send(fd)};");
-  html += F("</script></body></html>");
-  return html;
+void OTAWebManager::handleUpdatePage() {
+  WebPage::sendGzip(*webServer, "text/html", WEB_OTA_UPDATE_GZ, WEB_OTA_UPDATE_GZ_LEN);
 }
 
-void OTAWebManager::handleUpdatePage() {
-  webServer->send(200, "text/html", generateUpdateHTML());
+// Progress line under the instructions, redrawn at most once a second
+void OTAWebManager::showProgress() {
+  if (display == nullptr) return;
+  
+  char line[24];
+  uint32_t rate = session.getRateKBps10();
+  
+  display->fillRect(0, 135, 128, 20, ST77XX_BLACK);
+  snprintf(line, sizeof(line), "Recv: %u%%%s", session.getPercent(), session.isCompressed() ? " (gz)" : "");
+  display->drawText(5, 135, line, ST77XX_CYAN, 1);
+  if (session.isCompressed()) {
+    // Wire rate -> firmware bytes per second after eboot inflates the image
+    snprintf(line, sizeof(line), "%u KB/s, eff %u", rate / 10, session.getEffectiveRateKBps10() / 10);
+  } else {
+    snprintf(line, sizeof(line), "%u.%u KB/s", rate / 10, rate % 10);
+  }
+  display->drawText(5, 145, line, ST77XX_CYAN, 1);
+}
+
+void OTAWebManager::sendStatus(int code) {
+  static const char* const STATE_NAMES[] = {"idle", "receiving", "verified", "failed"};
+  
+  char json[192];
+  uint32_t rate = session.getRateKBps10();
+  uint32_t effective = session.getEffectiveRateKBps10();
+  snprintf(json, sizeof(json),
+           "{\"state\":\"%s\",\"offset\":%u,\"size\":%u,\"rate\":%u.%u,\"effective\":%u.%u,\"error\":\"%s\"}",
+           STATE_NAMES[session.getState()], session.getOffset(), session.getSize(),
+           rate / 10, rate % 10, effective / 10, effective % 10, session.getError());
+  webServer->send(code, "application/json", json);
+}
+
+// POST /ota/begin?size=N&sha256=HEX[&raw=N] - start or resume a session
+// (raw = uncompressed size when uploading a .bin.gz)
+void OTAWebManager::handleBegin() {
+  uint32_t size = strtoul(webServer->arg("size").c_str(), nullptr, 10);
+  uint32_t raw = strtoul(webServer->arg("raw").c_str(), nullptr, 10);
+  
+  if (!session.begin(size, webServer->arg("sha256").c_str(), raw)) {
+    sendStatus(400);
+    return;
+  }
+  sendStatus(200);
 }
 
-void OTAWebManager::handleUpload() {
+// POST /ota/chunk?offset=N (multipart) - body arrives in HTTP_UPLOAD_BUFLEN pieces
+void OTAWebManager::handleChunk() {
   HTTPUpload& upload = webServer->upload();
   
   if (upload.status == UPLOAD_FILE_START) {
-    Serial.printf("[OTA] Upload started: %s\n", upload.filename.c_str());
-    uint32_t maxSketchSpace = (ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000;
-    if (!Update.begin(maxSketchSpace)) {
-      Update.printError(Serial);
-    }
-  } else if (upload.status == UPLOAD_FILE_WRITE) {
-    if (Update.write(upload.buf, upload.currentSize) != upload.currentSize) {
-      Update.printError(Serial);
-    }
-  } else if (upload.status == UPLOAD_FILE_END) {
-    if (Update.end(true)) {
-      Serial.printf("[OTA] Upload success: %u bytes\n", upload.totalSize);
-    } else {
-      Update.printError(Serial);
+    chunkOffset = strtoul(webServer->arg("offset").c_str(), nullptr, 10);
+    chunkRejected = false;
+  } else if (upload.status == UPLOAD_FILE_WRITE && !chunkRejected) {
+    OtaWriteResult result = session.write(chunkOffset, upload.buf, upload.currentSize);
+    chunkOffset += upload.currentSize;
+    
+    if (result == OTA_WRITE_GAP || result == OTA_WRITE_ERROR) {
+      chunkRejected = true;
     }
   }
+  // UPLOAD_FILE_ABORTED: keep the session - the client resumes from getOffset()
 }
 
-void OTAWebManager::handleUploadCallback() {
-  webServer->send(200, "text/plain", (Update.hasError()) ? "FAIL" : "OK");
-  if (!Update.hasError()) {
+void OTAWebManager::handleChunkDone() {
+  OtaState state = session.getState();
+  
+  if (state == OTA_FAILED) {
+    sendStatus(422);
+    return;
+  }
+  if (chunkRejected) {
+    sendStatus(409);  // Client should resume from the reported offset
+    return;
+  }
+  
+  sendStatus(200);
+  
+  if (state == OTA_VERIFIED) {
+    DEBUG_PRINTF("[OTA] Upload verified: %u bytes\n", session.getSize());
+    showProgress();
     delay(1000);
     ESP.restart();
   }
@@ -220,7 +163,7 @@ void OTAWebManager::start(const String& ipAddress) {
   
   // Root page
   webServer->on("/", [this]() {
-    webServer->send(200, "text/html", generateRootHTML());
+    sendRootPage();
   });
   
   // Custom update page
@@ -228,11 +171,21 @@ void OTAWebManager::start(const String& ipAddress) {
     handleUpdatePage();
   });
   
-  // Handle firmware upload
-  webServer->on("/upload", HTTP_POST, [this]() {
-    handleUploadCallback();
+  // Verified, resumable upload (see OtaSession)
+  webServer->on("/ota/begin", HTTP_POST, [this]() {
+    handleBegin();
+  });
+  webServer->on("/ota/status", HTTP_GET, [this]() {
+    sendStatus(200);
+  });
+  webServer->on("/ota/chunk", HTTP_POST, [this]() {
+    handleChunkDone();
   }, [this]() {
-    handleUpload();
+    handleChunk();
+  });
+  webServer->on("/ota/abort", HTTP_POST, [this]() {
+    session.abort();
+    sendStatus(200);
   });
   
   webServer->begin();
@@ -249,6 +202,7 @@ void OTAWebManager::stop() {
   DEBUG_PRINTLN(F("\n[OTA] Exiting OTA Mode..."));
   
   // Show closed screen
+  session.abort();
   showClosedScreen();
   
   // Clean up
@@ -258,11 +212,6 @@ void OTAWebManager::stop() {
     webServer = nullptr;
   }
   
-  if (httpUpdater != nullptr) {
-    delete httpUpdater;
-    httpUpdater = nullptr;
-  }
-  
   isActive = false;
   
   DEBUG_PRINTLN(F("[OTA] Mode closed"));
@@ -272,6 +221,11 @@ void OTAWebManager::stop() {
 void OTAWebManager::handle() {
   if (isActive && webServer != nullptr) {
     webServer->handleClient();
+    
+    if (session.getState() == OTA_RECEIVING && millis() - lastProgressDraw >= 1000) {
+      lastProgressDraw = millis();
+      showProgress();
+    }
     yield();
   }
 }
@@ -0,0 +1,83 @@
+/*
+ * Power Manager Implementation
+ */
+
+#include "config.h"
+#include "power_manager.h"
+#include <ESP8266WiFi.h>
+
+extern "C" {
+  #include "user_interface.h"
+  #include "gpio.h"
+}
+
+PowerManager::PowerManager(uint8_t sleepMode, uint8_t pin)
+  : mode(sleepMode), wakePin(pin), fetchStart(0), fetchMs(0) {}
+
+void PowerManager::begin() {
+  switch (mode) {
+    case POWER_MODE_MODEM:
+      WiFi.setSleepMode(WIFI_MODEM_SLEEP, WIFI_LISTEN_INTERVAL);
+      break;
+      
+    case POWER_MODE_LIGHT:
+      WiFi.setSleepMode(WIFI_LIGHT_SLEEP, WIFI_LISTEN_INTERVAL);
+      // Button (active LOW) wakes the CPU from light sleep immediately
+      if (wakePin != 0xFF) {
+        wifi_enable_gpio_wakeup(GPIO_ID_PIN(wakePin), GPIO_PIN_INTR_LOLEVEL);
+      }
+      break;
+      
+    case POWER_MODE_OFF:
+    default:
+      WiFi.setSleepMode(WIFI_NONE_SLEEP);
+      break;
+  }
+  
+  DEBUG_PRINT(F("[PWR] WiFi sleep: "));
+  DEBUG_PRINTLN(getModeText());
+}
+
+void PowerManager::beginFetch() {
+  fetchStart = millis();
+}
+
+void PowerManager::endFetch() {
+  fetchMs += millis() - fetchStart;
+}
+
+void PowerManager::idle(unsigned long msUntilNext) {
+  if (mode == POWER_MODE_OFF) return;
+  
+  // Wake in time for the next fetch
+  if (msUntilNext <= WAKE_MARGIN) return;
+  
+  unsigned long slice = msUntilNext - WAKE_MARGIN;
+  if (slice > IDLE_SLICE) slice = IDLE_SLICE;
+  
+  // delay() lets the SDK enter modem/light sleep until the next DTIM
+  delay(slice);
+}
+
+uint32_t PowerManager::getRadioOnMs() const {
+  uint32_t uptime = millis();
+  if (mode == POWER_MODE_OFF) return uptime;
+  
+  // Fetch time at 100% + idle time at the estimated beacon duty cycle
+  uint32_t idleMs = (uptime > fetchMs) ? uptime - fetchMs : 0;
+  return fetchMs + (uint32_t)(((uint64_t)idleMs * BEACON_DUTY_X1000) / 1000);
+}
+
+fixed10_t PowerManager::getRadioDutyPercent() const {
+  uint32_t uptime = millis();
+  if (uptime == 0) return 0;
+  return (fixed10_t)(((uint64_t)getRadioOnMs() * 1000) / uptime);
+}
+
+const char* PowerManager::getModeText() const {
+  switch (mode) {
+    case POWER_MODE_MODEM: return "Modem sleep";
+    case POWER_MODE_LIGHT: return "Light sleep";
+    default:               return "Always on";
+  }
+}
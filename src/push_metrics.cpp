@@ -0,0 +1,145 @@
+/*
+ * Push Metrics Implementation
+ */
+
+#include "config.h"
+#include "push_metrics.h"
+#include <ArduinoJson.h>
+
+static const char WEBHOOK_PREFIX[] = "am.";  // Alertmanager alerts: am.<alertname>, am.firing
+
+// Static pool: no heap, no 1 KB stack frame. Bodies are parsed from a
+// char* (zero-copy), so keys point into the body and only slots use the pool.
+static StaticJsonDocument<PUSH_JSON_POOL> doc;
+
+// ArduinoJson numbers -> x10 (ints stay integer math)
+static fixed10_t toFixed(JsonVariantConst v) {
+  if (v.is<bool>()) return v.as<bool>() ? FIXED10_SCALE : 0;
+  if (v.is<long>()) return v.as<long>() * FIXED10_SCALE;
+  return lroundf(v.as<float>() * FIXED10_SCALE);
+}
+
+PushMetrics::PushMetrics() : entries(), used(0) {}
+
+// Names end up in JSON strings and Prometheus labels - keep them plain
+bool PushMetrics::validName(const char* name, size_t len) {
+  if (len == 0 || len >= PUSH_NAME_LEN) return false;
+  for (size_t i = 0; i < len; i++) {
+    char c = name[i];
+    if (!isalnum((unsigned char)c) && c != '.' && c != '_' && c != '-' && c != ':') return false;
+  }
+  return true;
+}
+
+PushMetric* PushMetrics::slot(const char* name, size_t len, unsigned long now) {
+  PushMetric* oldest = nullptr;
+  for (uint8_t i = 0; i < used; i++) {
+    PushMetric& m = entries[i];
+    if (strncmp(m.name, name, len) == 0 && m.name[len] == '\0') return &m;
+    if (!oldest || now - m.updatedAt > now - oldest->updatedAt) oldest = &m;
+  }
+
+  // New name: next free entry, or replace the one updated longest ago
+  PushMetric* m = (used < PUSH_METRIC_MAX) ? &entries[used++] : oldest;
+  memcpy(m->name, name, len);
+  m->name[len] = '\0';
+  m->value = 0;
+  m->updatedAt = now;
+  return m;
+}
+
+bool PushMetrics::set(const char* name, size_t nameLen, fixed10_t value, unsigned long now) {
+  if (!validName(name, nameLen)) return false;
+  PushMetric* m = slot(name, nameLen, now);
+  m->value = value;
+  m->updatedAt = now;
+  return true;
+}
+
+bool PushMetrics::get(const char* name, fixed10_t& value, unsigned long now) const {
+  for (uint8_t i = 0; i < used; i++) {
+    const PushMetric& m = entries[i];
+    if (strcmp(m.name, name) != 0) continue;
+    if (now - m.updatedAt > PUSH_METRIC_TTL) return false;
+    value = m.value;
+    return true;
+  }
+  return false;
+}
+
+int16_t PushMetrics::ingestJson(char* body, size_t len, unsigned long now) {
+  body[len] = '\0';
+  if (strstr(body, "\"alerts\"")) return ingestWebhook(body, len, now);
+
+  if (deserializeJson(doc, body, len)) return -1;
+  JsonObjectConst obj = doc.as<JsonObjectConst>();
+  if (obj.isNull()) return -1;
+
+  int16_t stored = 0;
+  for (JsonPairConst kv : obj) {
+    JsonVariantConst v = kv.value();
+    if (!v.is<float>() && !v.is<bool>()) continue;  // Numbers and booleans only
+    const char* key = kv.key().c_str();
+    if (set(key, strlen(key), toFixed(v), now)) stored++;
+  }
+  return stored;
+}
+
+// Alertmanager webhook: am.<alertname> = alerts of that name firing, am.firing = total
+int16_t PushMetrics::ingestWebhook(char* body, size_t len, unsigned long now) {
+  StaticJsonDocument<128> filter;
+  filter["alerts"][0]["status"] = true;
+  filter["alerts"][0]["labels"]["alertname"] = true;
+  if (deserializeJson(doc, body, len, DeserializationOption::Filter(filter))) return -1;
+  JsonArrayConst alerts = doc["alerts"].as<JsonArrayConst>();
+  if (alerts.isNull()) return -1;
+
+  char name[PUSH_NAME_LEN];
+  const size_t prefixLen = sizeof(WEBHOOK_PREFIX) - 1;
+  memcpy(name, WEBHOOK_PREFIX, prefixLen);
+
+  // Two passes: zero every name in the payload, then count the firing ones
+  int16_t stored = 0;
+  fixed10_t firing = 0;
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    for (JsonVariantConst alert : alerts) {
+      const char* alertName = alert["labels"]["alertname"] | "";
+      size_t n = strlen(alertName);
+      if (n > sizeof(name) - 1 - prefixLen) n = sizeof(name) - 1 - prefixLen;  // Cut long names
+      memcpy(name + prefixLen, alertName, n);
+      if (!validName(name, prefixLen + n)) continue;
+
+      PushMetric* m = slot(name, prefixLen + n, now);
+      m->updatedAt = now;
+      if (pass == 0) {
+        m->value = 0;
+        stored++;
+      } else if (strcmp(alert["status"] | "", "firing") == 0) {
+        m->value += FIXED10_SCALE;
+        firing += FIXED10_SCALE;
+      }
+    }
+  }
+  if (set("am.firing", 9, firing, now)) stored++;
+  return stored;
+}
+
+int16_t PushMetrics::ingestBinary(const uint8_t* body, size_t len, unsigned long now) {
+  // Validate the whole frame first so a truncated body stores nothing
+  size_t pos = 0;
+  while (pos < len) {
+    uint8_t n = body[pos];
+    if (n == 0 || pos + 1 + n + 4 > len) return -1;
+    pos += 1 + n + 4;
+  }
+
+  int16_t stored = 0;
+  for (pos = 0; pos < len; pos += 1 + body[pos] + 4) {
+    uint8_t n = body[pos];
+    const uint8_t* v = body + pos + 1 + n;
+    int32_t value = (int32_t)((uint32_t)v[0] | ((uint32_t)v[1] << 8) |
+                              ((uint32_t)v[2] << 16) | ((uint32_t)v[3] << 24));
+    if (set((const char*)body + pos + 1, n, value, now)) stored++;
+  }
+  return stored;
+}
@@ -0,0 +1,75 @@
+/*
+ * Recovery Policy Implementation
+ */
+
+#include "config.h"
+#include "recovery_policy.h"
+#include "metrics.h"
+
+RecoveryPolicy::RecoveryPolicy()
+  : tier(RECOVERY_OK), failures(0), outageStart(0), lastSuccess(0), lastRecoveryMs(0) {}
+
+RecoveryTier RecoveryPolicy::target() const {
+  if (failures == 0) return RECOVERY_OK;
+  if (RECOVERY_AP_AFTER > 0 && getOutageMs() >= RECOVERY_AP_AFTER) return RECOVERY_AP;
+  if (failures >= RECOVERY_BACKOFF_AFTER) return RECOVERY_BACKOFF;
+  if (failures >= REDISCOVER_AFTER) return RECOVERY_REDISCOVER;
+  return RECOVERY_STALE;
+}
+
+bool RecoveryPolicy::reportFailure() {
+  if (failures == 0) outageStart = millis();
+  if (failures < UINT16_MAX) failures++;
+
+  RecoveryTier next = target();
+  if (next == tier) return false;
+
+  tier = next;
+  Metrics::setRecoveryTier(tier);
+  DEBUG_PRINTF("[RECOVER] %u failures -> %s\n", failures, getTierText());
+  return true;
+}
+
+bool RecoveryPolicy::reportSuccess() {
+  lastSuccess = millis();
+  if (failures == 0) return false;
+
+  lastRecoveryMs = millis() - outageStart;
+  Metrics::recordRecovery(lastRecoveryMs);
+  DEBUG_PRINTF("[RECOVER] Server back after %lus (%u failures, tier %s)\n",
+               lastRecoveryMs / 1000, failures, getTierText());
+
+  failures = 0;
+  tier = RECOVERY_OK;
+  Metrics::setRecoveryTier(tier);
+  return true;
+}
+
+unsigned long RecoveryPolicy::getRetryInterval(unsigned long normal) const {
+  if (tier < RECOVERY_BACKOFF) return normal;
+
+  // Double per failure past the threshold, capped (cap before narrowing:
+  // a long outage must not wrap back to the normal interval)
+  uint16_t past = failures >= RECOVERY_BACKOFF_AFTER ? failures - RECOVERY_BACKOFF_AFTER + 1 : 1;
+  uint8_t shift = past > 8 ? 8 : past;
+  unsigned long interval = normal << shift;
+  return interval > RECOVERY_MAX_INTERVAL ? RECOVERY_MAX_INTERVAL : interval;
+}
+
+unsigned long RecoveryPolicy::getOutageMs() const {
+  return failures > 0 ? millis() - outageStart : 0;
+}
+
+unsigned long RecoveryPolicy::getDataAgeMs() const {
+  return millis() - lastSuccess;
+}
+
+const char* RecoveryPolicy::getTierText() const {
+  switch (tier) {
+    case RECOVERY_STALE:      return "stale";
+    case RECOVERY_REDISCOVER: return "rediscover";
+    case RECOVERY_BACKOFF:    return "backoff";
+    case RECOVERY_AP:         return "ap";
+    default:                  return "ok";
+  }
+}
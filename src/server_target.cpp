@@ -0,0 +1,78 @@
+/*
+ * Server Target Implementation
+ */
+
+#include "config.h"
+#include "server_target.h"
+#include "metrics.h"
+#include <ESP8266WiFi.h>
+
+ServerTarget::ServerTarget()
+  : port(0), literal(false), resolved(false), resolvedAt(0), ttl(DNS_CACHE_TTL), requestLen(0) {
+  host[0] = '\0';
+  request[0] = '\0';
+}
+
+bool ServerTarget::set(const char* newHost, uint16_t newPort, const char* path) {
+  if (strlen(newHost) >= sizeof(host)) {
+    DEBUG_PRINTLN(F("[NET] Server host too long"));
+    return false;
+  }
+
+  strcpy(host, newHost);
+  port = newPort;
+  // New server: never fall back to the previous one's address
+  IPAddress parsed;
+  literal = parsed.fromString(host);
+  address = literal ? parsed : IPAddress();
+  resolved = literal;
+  resolvedAt = millis();
+  ttl = DNS_CACHE_TTL;
+
+  // HTTP/1.0 + close: no chunked encoding, the body can be parsed off the socket
+  int len = snprintf_P(request, sizeof(request),
+                       PSTR("GET %s HTTP/1.0\r\nHost: %s:%u\r\nConnection: close\r\n\r\n"),
+                       path, host, port);
+  requestLen = (len > 0 && (size_t)len < sizeof(request)) ? len : 0;
+
+  DEBUG_PRINTF("[NET] Server %s:%u (%s)\n", host, port, literal ? "IP" : "hostname");
+  return requestLen > 0;
+}
+
+bool ServerTarget::resolve(IPAddress& out) {
+  if (resolved && (literal || millis() - resolvedAt < ttl)) {
+    out = address;
+    return true;
+  }
+
+  IPAddress fresh;
+  Metrics::recordDnsLookup();
+  if (WiFi.hostByName(host, fresh, DNS_TIMEOUT) == 1 && fresh.isSet()) {
+    if (fresh != address) {
+      DEBUG_PRINTF("[NET] %s -> %s\n", host, fresh.toString().c_str());
+    }
+    address = fresh;
+    resolved = true;
+    resolvedAt = millis();
+    ttl = DNS_CACHE_TTL;
+    out = address;
+    return true;
+  }
+
+  // DNS down: keep using the last known address until a connect fails
+  if (address.isSet()) {
+    DEBUG_PRINTLN(F("[NET] DNS failed - using cached address"));
+    resolvedAt = millis();
+    ttl = STALE_RETRY;  // Not the full TTL: pick up the answer once DNS is back
+    resolved = true;
+    out = address;
+    return true;
+  }
+  return false;
+}
+
+void ServerTarget::invalidate() {
+  if (literal) return;
+  resolved = false;
+  address = IPAddress();  // It just failed - no serve-stale fallback to it
+}
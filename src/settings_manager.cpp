@@ -4,6 +4,10 @@
 
 #include "config.h"
 #include "settings_manager.h"
+#include "metrics.h"
+#include <stddef.h>
+
+static_assert(ALERTS_EEPROM_OFFSET + sizeof(AlertSettings) <= 512, "Alert rules do not fit in EEPROM");
 
 SettingsManager::SettingsManager() {
   // Constructor
@@ -22,6 +26,12 @@ void SettingsManager::begin() {
     DEBUG_PRINT(settings.refreshInterval);
     DEBUG_PRINTLN(F("ms"));
   }
+  
+  EEPROM.get(ALERTS_EEPROM_OFFSET, alerts);
+  if (alerts.magic != ALERTS_MAGIC || alerts.checksum != alertChecksum(alerts)) {
+    DEBUG_PRINTLN(F("[SETTINGS] No alert rules, using defaults"));
+    resetAlerts();
+  }
 }
 
 bool SettingsManager::load() {
@@ -33,6 +43,7 @@ bool SettingsManager::save() {
   settings.magic = SETTINGS_MAGIC;  // Ensure magic is set
   EEPROM.put(SETTINGS_EEPROM_OFFSET, settings);
   bool success = EEPROM.commit();
+  Metrics::recordFlashWrite();
   
   if (success) {
     DEBUG_PRINTLN(F("[SETTINGS] Saved successfully"));
@@ -48,6 +59,42 @@ void SettingsManager::reset() {
   DEBUG_PRINTLN(F("[SETTINGS] Reset to defaults"));
 }
 
+uint8_t SettingsManager::alertChecksum(const AlertSettings& data) {
+  uint8_t sum = 0;
+  const uint8_t* bytes = (const uint8_t*)&data;
+  for (size_t i = 0; i < offsetof(AlertSettings, checksum); i++) {
+    sum ^= bytes[i];
+  }
+  return sum;
+}
+
+// Defaults: hot CPU/GPU flash once and stay outlined, full RAM pulses the backlight
+void SettingsManager::resetAlerts() {
+  memset(&alerts, 0, sizeof(alerts));
+  alerts.magic = ALERTS_MAGIC;
+  alerts.rules[0] = { ALERT_CPU_TEMP,  ALERT_HIGHLIGHT | ALERT_FLASH, 900, 850, 10 };
+  alerts.rules[1] = { ALERT_GPU_TEMP,  ALERT_HIGHLIGHT | ALERT_FLASH, 850, 800, 10 };
+  alerts.rules[2] = { ALERT_CPU_LOAD,  ALERT_HIGHLIGHT,               950, 850, 30 };
+  alerts.rules[3] = { ALERT_RAM_LOAD,  ALERT_HIGHLIGHT | ALERT_PULSE, 900, 850, 30 };
+  alerts.rules[4] = { ALERT_DISK_TEMP, ALERT_HIGHLIGHT,               600, 550, 30 };
+  alerts.checksum = alertChecksum(alerts);
+}
+
+bool SettingsManager::setAlertRule(uint8_t slot, const AlertRule& rule) {
+  if (slot >= ALERT_RULE_MAX || rule.metric >= ALERT_METRIC_COUNT) return false;
+  alerts.rules[slot] = rule;
+  return true;
+}
+
+bool SettingsManager::saveAlerts() {
+  alerts.magic = ALERTS_MAGIC;
+  alerts.checksum = alertChecksum(alerts);
+  EEPROM.put(ALERTS_EEPROM_OFFSET, alerts);
+  bool success = EEPROM.commit();
+  Metrics::recordFlashWrite();
+  return success;
+}
+
 void SettingsManager::setRefreshInterval(uint16_t interval) {
   // Validate interval (500ms to 60000ms)
   if (interval >= 500 && interval <= 60000) {
@@ -64,7 +111,34 @@ void SettingsManager::setDisplayMode(uint8_t mode) {
   settings.displayMode = mode;
 }
 
+// Settings saved before adaptive mode existed have zeros here
+uint16_t SettingsManager::getAdaptiveMinInterval() const {
+  return settings.adaptiveMinInterval ? settings.adaptiveMinInterval : 500;
+}
+
+uint16_t SettingsManager::getAdaptiveMaxInterval() const {
+  return settings.adaptiveMaxInterval ? settings.adaptiveMaxInterval : 10000;
+}
+
+void SettingsManager::setAdaptiveRefresh(bool enabled) {
+  settings.adaptiveRefresh = enabled ? 1 : 0;
+  DEBUG_PRINT(F("[SETTINGS] Adaptive refresh: "));
+  DEBUG_PRINTLN(enabled ? F("ON") : F("OFF"));
+}
+
+void SettingsManager::setAdaptiveBounds(uint16_t minMs, uint16_t maxMs) {
+  // Same limits as fixed intervals (500ms to 60000ms)
+  if (minMs >= 500 && maxMs <= 60000 && minMs <= maxMs) {
+    settings.adaptiveMinInterval = minMs;
+    settings.adaptiveMaxInterval = maxMs;
+  } else {
+    DEBUG_PRINTLN(F("[SETTINGS] Invalid adaptive bounds!"));
+  }
+}
+
 const char* SettingsManager::getRefreshRateText() const {
+  if (isAdaptiveRefresh()) return "Auto";
+  
   switch (settings.refreshInterval) {
     case 500:  return "0.5s (2Hz)";
     case 1000: return "1s (1Hz)";
@@ -74,8 +148,30 @@ const char* SettingsManager::getRefreshRateText() const {
   }
 }
 
+// Adaptive bounds offered in the menu (fastest, slowest poll)
+static const uint16_t AUTO_BOUNDS[][2] = { {500, 10000}, {1000, 30000}, {2000, 60000} };
+static constexpr uint8_t AUTO_BOUNDS_COUNT = sizeof(AUTO_BOUNDS) / sizeof(AUTO_BOUNDS[0]);
+
 void SettingsManager::cycleRefreshRate() {
-  // Cycle: 5s -> 3s -> 1s -> 0.5s -> 5s
+  // Cycle: 5s -> 3s -> 1s -> 0.5s -> Auto 0.5-10s -> Auto 1-30s -> Auto 2-60s -> 5s
+  if (isAdaptiveRefresh()) {
+    uint8_t next = 1;  // Custom bounds (no preset matches): continue after the first preset
+    for (uint8_t i = 0; i < AUTO_BOUNDS_COUNT; i++) {
+      if (getAdaptiveMinInterval() == AUTO_BOUNDS[i][0] && getAdaptiveMaxInterval() == AUTO_BOUNDS[i][1]) {
+        next = i + 1;
+      }
+    }
+    if (next < AUTO_BOUNDS_COUNT) {
+      setAdaptiveBounds(AUTO_BOUNDS[next][0], AUTO_BOUNDS[next][1]);
+    } else {
+      settings.adaptiveRefresh = 0;
+      settings.refreshInterval = 5000;
+    }
+    DEBUG_PRINTF("[SETTINGS] Cycled to: %s %u-%ums\n", getRefreshRateText(),
+                 getAdaptiveMinInterval(), getAdaptiveMaxInterval());
+    return;
+  }
+  
   switch (settings.refreshInterval) {
     case 5000:
       settings.refreshInterval = 3000;
@@ -87,6 +183,9 @@ void SettingsManager::cycleRefreshRate() {
       settings.refreshInterval = 500;
       break;
     case 500:
+      settings.adaptiveRefresh = 1;  // Keep 500ms as fallback interval
+      setAdaptiveBounds(AUTO_BOUNDS[0][0], AUTO_BOUNDS[0][1]);
+      break;
     default:
       settings.refreshInterval = 5000;
       break;
@@ -95,3 +194,35 @@ void SettingsManager::cycleRefreshRate() {
   DEBUG_PRINT(F("[SETTINGS] Cycled to: "));
   DEBUG_PRINTLN(getRefreshRateText());
 }
+
+void SettingsManager::setBacklightLevels(uint8_t full, uint8_t dim) {
+  settings.backlightFull = full ? full : 255;
+  settings.backlightDim = dim;
+}
+
+const char* SettingsManager::getBrightnessText() const {
+  switch (getBacklightFull()) {
+    case 255: return "100%";
+    case 191: return "75%";
+    case 128: return "50%";
+    case 64:  return "25%";
+    default:  return "Custom";
+  }
+}
+
+void SettingsManager::cycleBrightness() {
+  // Cycle: 100% -> 75% -> 50% -> 25% -> 100% (dim level follows at 1/4)
+  uint8_t full;
+  switch (getBacklightFull()) {
+    case 255: full = 191; break;
+    case 191: full = 128; break;
+    case 128: full = 64;  break;
+    case 64:
+    default:  full = 255; break;
+  }
+  settings.backlightFull = full;
+  settings.backlightDim = full / 4;
+  
+  DEBUG_PRINT(F("[SETTINGS] Brightness: "));
+  DEBUG_PRINTLN(getBrightnessText());
+}
@@ -0,0 +1,140 @@
+/*
+ * System Data JSON Implementation
+ */
+
+#include "config.h"  // Same DISK_MAX/CORE_MAX/... as the rest of the firmware
+#include "system_data_json.h"
+
+// Read a metric as fixed10_t. A bridge that honours "?fixed=1" sends
+// pre-scaled integers and sets "fixed": 10 at the top level, so no float
+// math runs at all. Older bridges send floats, converted once here.
+static fixed10_t readFixed(JsonVariantConst v, bool prescaled) {
+  if (prescaled) return v.as<long>();
+  if (v.is<long>()) return v.as<long>() * FIXED10_SCALE;
+  return lroundf(v.as<float>() * FIXED10_SCALE);
+}
+
+// Copy a JSON string into a fixed buffer (cut, always terminated)
+static void copyName(char* dst, size_t len, const char* src) {
+  strncpy(dst, src, len - 1);
+  dst[len - 1] = '\0';
+}
+
+// Decode a packed hex string ("0a64...", two digits per core) into out[]
+static uint8_t unpackHex(const char* hex, uint8_t* out, uint8_t capacity) {
+  uint8_t count = 0;
+  while (count < capacity && isxdigit(hex[0]) && isxdigit(hex[1])) {
+    char pair[3] = { hex[0], hex[1], '\0' };
+    out[count++] = strtoul(pair, nullptr, 16);
+    hex += 2;
+  }
+  return count;
+}
+
+// Keep only the fields parse() reads (drops gpu_integrated etc.)
+// Keys are literals, so the filter stores pointers only and fits on the stack
+void SystemDataJson::buildFilter(JsonDocument& filter) {
+  filter["fixed"] = true;
+  filter["host"] = true;
+  filter["layout"] = true;
+  
+  JsonObject cpu = filter.createNestedObject("cpu");
+  cpu["name"] = true;
+  cpu["temp"] = true;
+  cpu["load"] = true;
+  cpu["power"] = true;
+  
+  JsonObject ram = filter.createNestedObject("ram");
+  ram["used"] = true;
+  ram["total"] = true;
+  ram["percent"] = true;
+  
+  JsonObject gpu = filter.createNestedObject("gpu_discrete");
+  gpu["name"] = true;
+  gpu["temp"] = true;
+  gpu["load"] = true;
+  gpu["power"] = true;
+  gpu["mem_used"] = true;
+  gpu["mem_total"] = true;
+  
+  JsonObject disk = filter.createNestedArray("disk").createNestedObject();
+  disk["name"] = true;
+  disk["temp"] = true;
+  disk["load"] = true;
+  
+  JsonObject net = filter.createNestedObject("network");
+  net["name"] = true;
+  net["download"] = true;
+  net["upload"] = true;
+  
+  JsonObject nets = filter.createNestedArray("networks").createNestedObject();
+  nets["name"] = true;
+  nets["download"] = true;
+  nets["upload"] = true;
+  
+  JsonObject cores = filter.createNestedObject("cores");
+  cores["load"] = true;
+  cores["clock"] = true;
+}
+
+void SystemDataJson::parse(JsonDocument& doc, SystemData& data) {
+  bool prescaled = (doc["fixed"] | 0) == FIXED10_SCALE;
+  
+  // Bridge hostname (newer bridges only)
+  data.hostName = doc["host"] | "";
+  data.layoutId = doc["layout"] | 0UL;  // Bridge serves a dashboard layout (GET /layout)
+  
+  // Parse CPU
+  data.cpuName = doc["cpu"]["name"].as<String>();
+  data.cpuTemp = readFixed(doc["cpu"]["temp"], prescaled);
+  data.cpuLoad = readFixed(doc["cpu"]["load"], prescaled);
+  data.cpuPower = readFixed(doc["cpu"]["power"], prescaled);
+  
+  // Parse RAM
+  data.ramUsed = readFixed(doc["ram"]["used"], prescaled);
+  data.ramTotal = readFixed(doc["ram"]["total"], prescaled);
+  data.ramPercent = readFixed(doc["ram"]["percent"], prescaled);
+  
+  // Parse GPU
+  data.gpuName = doc["gpu_discrete"]["name"].as<String>();
+  data.gpuTemp = readFixed(doc["gpu_discrete"]["temp"], prescaled);
+  data.gpuLoad = readFixed(doc["gpu_discrete"]["load"], prescaled);
+  data.gpuPower = readFixed(doc["gpu_discrete"]["power"], prescaled);
+  data.gpuMemUsed = doc["gpu_discrete"]["mem_used"].as<int>();
+  data.gpuMemTotal = doc["gpu_discrete"]["mem_total"].as<int>();
+  
+  // Parse Disks (extra entries past DISK_MAX are dropped)
+  data.diskCount = 0;
+  for (JsonVariantConst d : doc["disk"].as<JsonArrayConst>()) {
+    if (data.diskCount >= DISK_MAX) break;
+    DiskInfo& disk = data.disks[data.diskCount++];
+    copyName(disk.name, sizeof(disk.name), d["name"] | "");
+    disk.temp = readFixed(d["temp"], prescaled);
+    disk.load = readFixed(d["load"], prescaled);
+  }
+  
+  // Parse Network: every interface on newer bridges, else the single busiest one
+  data.nicCount = 0;
+  JsonArrayConst nets = doc["networks"].as<JsonArrayConst>();
+  if (!nets.isNull()) {
+    for (JsonVariantConst n : nets) {
+      if (data.nicCount >= NIC_MAX) break;
+      NicInfo& nic = data.nics[data.nicCount++];
+      copyName(nic.name, sizeof(nic.name), n["name"] | "");
+      nic.down = readFixed(n["download"], prescaled);
+      nic.up = readFixed(n["upload"], prescaled);
+    }
+  } else if ((doc["network"]["name"] | "")[0] != '\0') {
+    NicInfo& nic = data.nics[data.nicCount++];
+    copyName(nic.name, sizeof(nic.name), doc["network"]["name"] | "");
+    nic.down = readFixed(doc["network"]["download"], prescaled);
+    nic.up = readFixed(doc["network"]["upload"], prescaled);
+  }
+  
+  // Per-core load/clock: packed strings, one pool copy instead of a slot per core
+  data.coreCount = unpackHex(doc["cores"]["load"] | "", data.coreLoad, CORE_MAX);
+  uint8_t clocks = unpackHex(doc["cores"]["clock"] | "", data.coreClock, data.coreCount);
+  memset(data.coreClock + clocks, 0, data.coreCount - clocks);
+  
+  data.hasData = true;
+}
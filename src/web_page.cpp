@@ -0,0 +1,90 @@
+/*
+ * Web Page Implementation
+ */
+
+#include "config.h"
+#include "web_page.h"
+
+void WebPage::sendGzip(ESP8266WebServer& server, const char* contentType,
+                       const uint8_t* data, size_t length, int code) {
+  server.sendHeader(F("Content-Encoding"), F("gzip"));
+  server.send_P(code, contentType, reinterpret_cast<PGM_P>(data), length);
+}
+
+// Append to the chunk buffer, flushing when full
+static inline void put(ESP8266WebServer& server, char* buf, size_t& used, char c) {
+  buf[used++] = c;
+  if (used == WebPage::CHUNK_SIZE) {
+    server.sendContent(buf, used);
+    used = 0;
+  }
+}
+
+void WebPage::sendEscaped(ESP8266WebServer& server, const char* value,
+                          char* buf, size_t& used) {
+  for (const char* p = value; *p; p++) {
+    const char* entity = nullptr;
+    switch (*p) {
+      case '&':  entity = "&amp;";  break;
+      case '<':  entity = "&lt;";   break;
+      case '>':  entity = "&gt;";   break;
+      case '"':  entity = "&quot;"; break;
+      case '\'': entity = "&#39;";  break;
+    }
+
+    if (entity) {
+      while (*entity) put(server, buf, used, *entity++);
+    } else {
+      put(server, buf, used, *p);
+    }
+  }
+}
+
+void WebPage::sendTemplate(ESP8266WebServer& server, const char* contentType,
+                           PGM_P tmpl, const Resolver& resolve, int code) {
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(code, contentType, "");
+
+  char buf[CHUNK_SIZE];
+  size_t used = 0;
+  size_t len = strlen_P(tmpl);
+  size_t i = 0;
+
+  while (i < len) {
+    char c = pgm_read_byte(tmpl + i);
+
+    if (c == '{' && i + 1 < len && pgm_read_byte(tmpl + i + 1) == '{') {
+      // Collect KEY up to the closing braces
+      char key[MAX_KEY];
+      size_t k = 0;
+      size_t j = i + 2;
+      while (j < len && k < MAX_KEY - 1) {
+        char kc = pgm_read_byte(tmpl + j);
+        if (kc == '}') break;
+        key[k++] = kc;
+        j++;
+      }
+      key[k] = '\0';
+
+      if (j + 1 < len && pgm_read_byte(tmpl + j) == '}' && pgm_read_byte(tmpl + j + 1) == '}') {
+        char value[MAX_VALUE];
+        value[0] = '\0';
+        resolve(key, value, sizeof(value));
+        value[MAX_VALUE - 1] = '\0';
+
+        sendEscaped(server, value, buf, used);
+        i = j + 2;
+        continue;
+      }
+      // Not a placeholder - emit the brace literally
+    }
+
+    put(server, buf, used, c);
+    i++;
+  }
+
+  if (used > 0) {
+    server.sendContent(buf, used);
+  }
+  server.sendContent("");  // Terminating chunk
+}
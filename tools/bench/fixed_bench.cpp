@@ -0,0 +1,145 @@
+/*
+ * Fixed10 Benchmark
+ * So sánh đường float cũ với Fixed10 trên host: parse, format 1 chữ số thập phân
+ * và phần trăm RAM/VRAM - cùng bộ giá trị, cùng kết quả
+ *
+ *   pio run -e native_bench && .pio/build/native_bench/program [--rounds 200]
+ *
+ * Host có FPU: số đo chỉ để so sánh tương đối, không thay cho đo trên ESP8266
+ * (ở đó mọi phép float đi qua soft-float).
+ */
+
+#include <Arduino.h>
+#include <stdlib.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "fixed_point.h"
+
+static constexpr size_t SAMPLES = 4096;
+static constexpr int REPEATS = 5;   // Best of, to skip scheduler noise
+
+static volatile int32_t sink;       // Keeps the optimizer from dropping the loops
+
+// Metric-like values in tenths: temperatures, loads, GB, Mb/s, a few negatives
+static std::vector<fixed10_t> makeValues() {
+  std::vector<fixed10_t> values(SAMPLES);
+  uint32_t seed = 28;
+  for (size_t i = 0; i < SAMPLES; i++) {
+    seed = seed * 1103515245 + 12345;
+    int32_t v = (seed >> 8) % 20000;        // 0.0 .. 1999.9
+    values[i] = (i % 16 == 0) ? -(v % 300) : v;
+  }
+  return values;
+}
+
+// Old tile output: Arduino Print::printFloat(value, 1) into a buffer
+static size_t printFloat1(char* buf, float value) {
+  double number = value;
+  size_t n = 0;
+  if (number < 0.0) {
+    buf[n++] = '-';
+    number = -number;
+  }
+  number += 0.05;
+  unsigned long whole = (unsigned long)number;
+  double remainder = number - (double)whole;
+
+  char tmp[12];
+  uint8_t digits = 0;
+  do {
+    tmp[digits++] = '0' + whole % 10;
+    whole /= 10;
+  } while (whole > 0);
+  while (digits > 0) buf[n++] = tmp[--digits];
+
+  buf[n++] = '.';
+  remainder *= 10.0;
+  buf[n++] = '0' + (int)remainder;
+  buf[n] = '\0';
+  return n;
+}
+
+// ns per call of fn(i), best of REPEATS
+template <typename Fn>
+static double timeNs(int rounds, Fn fn) {
+  double best = 0;
+  for (int r = 0; r < REPEATS; r++) {
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+      for (size_t i = 0; i < SAMPLES; i++) fn(i);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    double ns = elapsed.count() / ((double)rounds * SAMPLES);
+    if (r == 0 || ns < best) best = ns;
+  }
+  return best;
+}
+
+static void report(const char* name, double floatNs, double fixedNs, unsigned mismatches) {
+  printf("%-10s %8.1f ns %8.1f ns %6.2fx   %u mismatch(es)\n",
+         name, floatNs, fixedNs, floatNs / fixedNs, mismatches);
+}
+
+int main(int argc, char** argv) {
+  int rounds = 200;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--rounds") == 0 && i + 1 < argc) rounds = atoi(argv[++i]);
+  }
+  if (rounds < 1) rounds = 1;
+
+  std::vector<fixed10_t> values = makeValues();
+  std::vector<float> floats(SAMPLES);
+  std::vector<std::string> texts(SAMPLES);
+  std::vector<int32_t> used(SAMPLES), totals(SAMPLES);   // RAM-style MB pairs, used <= total
+  char buf[16];
+  for (size_t i = 0; i < SAMPLES; i++) {
+    floats[i] = values[i] / 10.0f;
+    Fixed10::format(buf, sizeof(buf), values[i]);
+    texts[i] = buf;
+    totals[i] = 1024 + (values[(i + 1) % SAMPLES] & 0x7fff) * 4;
+    used[i] = (int32_t)(((int64_t)totals[i] * (i % 101)) / 100);
+  }
+
+  // Same answers first: the float path rounds to tenths like the bridge did
+  unsigned parseDiff = 0, formatDiff = 0, percentDiff = 0;
+  for (size_t i = 0; i < SAMPLES; i++) {
+    fixed10_t parsed = 0;
+    if (!Fixed10::parse(texts[i].c_str(), parsed) ||
+        parsed != lroundf(strtof(texts[i].c_str(), nullptr) * FIXED10_SCALE)) parseDiff++;
+
+    char old[16];
+    printFloat1(old, floats[i]);
+    if (texts[i] != old) formatDiff++;
+
+    float oldPercent = used[i] / (float)totals[i] * 100.0f;
+    if (Fixed10::percent(used[i], totals[i]) != lroundf(oldPercent * 10)) percentDiff++;
+  }
+
+  printf("%zu values x %d rounds, best of %d\n", SAMPLES, rounds, REPEATS);
+  printf("%-10s %11s %11s %8s\n", "", "float", "fixed10", "speedup");
+
+  double floatNs = timeNs(rounds, [&](size_t i) {
+    sink = lroundf(strtof(texts[i].c_str(), nullptr) * FIXED10_SCALE);
+  });
+  double fixedNs = timeNs(rounds, [&](size_t i) {
+    fixed10_t v = 0;
+    Fixed10::parse(texts[i].c_str(), v);
+    sink = v;
+  });
+  report("parse", floatNs, fixedNs, parseDiff);
+
+  floatNs = timeNs(rounds, [&](size_t i) { sink = printFloat1(buf, floats[i]) + buf[0]; });
+  fixedNs = timeNs(rounds, [&](size_t i) {
+    sink = Fixed10::format(buf, sizeof(buf), values[i]) + buf[0];
+  });
+  report("format", floatNs, fixedNs, formatDiff);
+
+  floatNs = timeNs(rounds, [&](size_t i) {
+    sink = lroundf(used[i] / (float)totals[i] * 100.0f * 10);
+  });
+  fixedNs = timeNs(rounds, [&](size_t i) { sink = Fixed10::percent(used[i], totals[i]); });
+  report("percent", floatNs, fixedNs, percentDiff);
+
+  return 0;
+}
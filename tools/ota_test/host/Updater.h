@@ -0,0 +1,63 @@
+/*
+ * Host Updater Shim
+ * Update (ESP8266 Updater) giả lập flash bằng RAM + ESP.getFreeSketchSpace()
+ * cho env:native_ota - ghi lại mọi lần begin/write/end để test kiểm tra
+ */
+
+#ifndef HOST_UPDATER_H
+#define HOST_UPDATER_H
+
+#include <Arduino.h>
+#include <vector>
+
+class HostUpdater {
+public:
+  std::vector<uint8_t> flash;  // Bytes written since begin()
+  size_t size = 0;
+  bool active = false;
+  bool committed = false;      // end() succeeded: eboot would boot the new image
+  int begins = 0;
+  int discards = 0;            // Unfinished images dropped by end(false)
+  bool failWrites = false;     // Simulate a flash error
+
+  bool begin(size_t imageSize) {
+    flash.clear();
+    size = imageSize;
+    active = true;
+    committed = false;
+    begins++;
+    return true;
+  }
+
+  size_t write(uint8_t* data, size_t len) {
+    if (!active || failWrites || flash.size() + len > size) return 0;
+    flash.insert(flash.end(), data, data + len);
+    return len;
+  }
+
+  // Same rule as the core: an incomplete image is discarded unless evenIfRemaining
+  bool end(bool evenIfRemaining = false) {
+    if (!active) return false;
+    active = false;
+    if (flash.size() < size && !evenIfRemaining) {
+      discards++;
+      return false;
+    }
+    committed = true;
+    return true;
+  }
+
+  void printError(HostSerial&) {}
+};
+
+inline HostUpdater Update;
+
+class HostEsp {
+public:
+  uint32_t freeSketchSpace = 1024 * 1024;
+  uint32_t getFreeSketchSpace() const { return freeSketchSpace; }
+};
+
+inline HostEsp ESP;
+
+#endif // HOST_UPDATER_H
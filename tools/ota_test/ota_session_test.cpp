@@ -0,0 +1,225 @@
+/*
+ * OTA Session Test
+ * Chạy OtaSession của firmware trên host với Updater giả (tools/ota_test/host):
+ * ảnh hỏng, bị cắt, đoạn sai thứ tự / nhảy cóc và resume
+ *
+ *   pio run -e native_ota && .pio/build/native_ota/program
+ *
+ * Thoát với mã != 0 nếu có case nào sai.
+ */
+
+#include <Arduino.h>
+#include <Updater.h>
+#include <bearssl/bearssl_hash.h>
+#include <vector>
+#include "ota_session.h"
+
+static constexpr size_t IMAGE_SIZE = 10000;  // Not a multiple of CHUNK: short last piece
+static constexpr size_t CHUNK = 1024;
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } \
+  } while (0)
+
+static std::vector<uint8_t> makeImage(size_t size, uint32_t seed) {
+  std::vector<uint8_t> image(size);
+  for (size_t i = 0; i < size; i++) {
+    seed = seed * 1103515245 + 12345;
+    image[i] = seed >> 16;
+  }
+  return image;
+}
+
+static std::string sha256Hex(const uint8_t* data, size_t len) {
+  br_sha256_context ctx;
+  uint8_t digest[32];
+  br_sha256_init(&ctx);
+  br_sha256_update(&ctx, data, len);
+  br_sha256_out(&ctx, digest);
+  char hex[65];
+  for (int i = 0; i < 32; i++) snprintf(hex + 2 * i, 3, "%02x", digest[i]);
+  return hex;
+}
+
+static std::string sha256Hex(const std::vector<uint8_t>& data) {
+  return sha256Hex(data.data(), data.size());
+}
+
+// Send [from, to) in CHUNK pieces; result of the last write
+static OtaWriteResult send(OtaSession& ota, const std::vector<uint8_t>& image, size_t from, size_t to) {
+  OtaWriteResult result = OTA_WRITE_OK;
+  for (size_t off = from; off < to; off += CHUNK) {
+    size_t n = (to - off < CHUNK) ? to - off : CHUNK;
+    result = ota.write(off, image.data() + off, n);
+    if (result != OTA_WRITE_OK) break;
+  }
+  return result;
+}
+
+static void resetUpdater() {
+  Update = HostUpdater();
+  ESP = HostEsp();
+}
+
+static void testShim() {
+  printf("host sha256 shim\n");
+  const char* abc = "abc";
+  CHECK(sha256Hex((const uint8_t*)abc, 3) ==
+        "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  CHECK(sha256Hex(nullptr, 0) ==
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+}
+
+static void testCleanImage() {
+  printf("clean image\n");
+  resetUpdater();
+  OtaSession ota;
+  std::vector<uint8_t> image = makeImage(IMAGE_SIZE, 1);
+
+  CHECK(ota.begin(IMAGE_SIZE, sha256Hex(image).c_str()));
+  CHECK(send(ota, image, 0, IMAGE_SIZE) == OTA_WRITE_OK);
+  CHECK(ota.getState() == OTA_VERIFIED);
+  CHECK(ota.getPercent() == 100);
+  CHECK(Update.committed);
+  CHECK(Update.flash == image);
+}
+
+static void testBadManifest() {
+  printf("bad manifest\n");
+  resetUpdater();
+  OtaSession ota;
+  CHECK(!ota.begin(IMAGE_SIZE, "1234"));
+  CHECK(!ota.begin(IMAGE_SIZE, std::string(64, 'z').c_str()));
+  CHECK(!ota.begin(0, std::string(64, '0').c_str()));
+  CHECK(ota.getState() == OTA_FAILED);
+  CHECK(Update.begins == 0);
+
+  ESP.freeSketchSpace = IMAGE_SIZE;  // No room for the image + a spare sector
+  CHECK(!ota.begin(IMAGE_SIZE, std::string(64, '0').c_str()));
+  CHECK(Update.begins == 0);
+}
+
+static void testCorruptDigest() {
+  printf("corrupt image\n");
+  resetUpdater();
+  OtaSession ota;
+  std::vector<uint8_t> image = makeImage(IMAGE_SIZE, 2);
+  std::string digest = sha256Hex(image);
+  image[IMAGE_SIZE / 2] ^= 0x01;  // One bit flipped in transit
+
+  CHECK(ota.begin(IMAGE_SIZE, digest.c_str()));
+  CHECK(send(ota, image, 0, IMAGE_SIZE) == OTA_WRITE_ERROR);
+  CHECK(ota.getState() == OTA_FAILED);
+  CHECK(strcmp(ota.getError(), "sha256 mismatch") == 0);
+  CHECK(!Update.committed);
+  CHECK(Update.discards == 1);
+  CHECK(Update.flash.size() < IMAGE_SIZE);  // Final piece never reached flash
+  CHECK(ota.write(0, image.data(), CHUNK) == OTA_WRITE_ERROR);  // Dead until a new begin()
+}
+
+static void testTruncated() {
+  printf("truncated image\n");
+  resetUpdater();
+  OtaSession ota;
+  std::vector<uint8_t> image = makeImage(IMAGE_SIZE, 3);
+
+  // Upload stops short: never verified, abort() drops it
+  CHECK(ota.begin(IMAGE_SIZE, sha256Hex(image).c_str()));
+  CHECK(send(ota, image, 0, IMAGE_SIZE - 100) == OTA_WRITE_OK);
+  CHECK(ota.getState() == OTA_RECEIVING);
+  CHECK(ota.getOffset() == IMAGE_SIZE - 100);
+  ota.abort();
+  CHECK(ota.getState() == OTA_IDLE);
+  CHECK(!Update.committed);
+  CHECK(Update.discards == 1);
+
+  // Manifest declares less than the client sends: the extra bytes are refused
+  resetUpdater();
+  std::vector<uint8_t> shortImage(image.begin(), image.begin() + IMAGE_SIZE / 2);
+  CHECK(ota.begin(shortImage.size(), sha256Hex(shortImage).c_str()));
+  CHECK(send(ota, image, 0, IMAGE_SIZE) == OTA_WRITE_ERROR);
+  CHECK(ota.getState() == OTA_FAILED);
+  CHECK(!Update.committed);
+}
+
+static void testOrdering() {
+  printf("out of order / gaps / retransmits\n");
+  resetUpdater();
+  OtaSession ota;
+  std::vector<uint8_t> image = makeImage(IMAGE_SIZE, 4);
+  CHECK(ota.begin(IMAGE_SIZE, sha256Hex(image).c_str()));
+
+  CHECK(ota.write(0, image.data(), CHUNK) == OTA_WRITE_OK);
+  CHECK(ota.write(2 * CHUNK, image.data() + 2 * CHUNK, CHUNK) == OTA_WRITE_GAP);  // Skipped a chunk
+  CHECK(ota.getOffset() == CHUNK);
+  CHECK(ota.write(0, image.data(), CHUNK) == OTA_WRITE_DUPLICATE);                // Retransmit
+  CHECK(ota.write(CHUNK / 2, image.data() + CHUNK / 2, CHUNK) == OTA_WRITE_OK);   // Half new
+  CHECK(ota.getOffset() == CHUNK + CHUNK / 2);
+  CHECK(ota.getState() == OTA_RECEIVING);
+
+  CHECK(send(ota, image, CHUNK + CHUNK / 2, IMAGE_SIZE) == OTA_WRITE_OK);
+  CHECK(ota.getState() == OTA_VERIFIED);
+  CHECK(Update.flash == image);  // No byte written twice
+}
+
+static void testResume() {
+  printf("resume\n");
+  resetUpdater();
+  OtaSession ota;
+  std::vector<uint8_t> image = makeImage(IMAGE_SIZE, 5);
+  std::string digest = sha256Hex(image);
+
+  CHECK(ota.begin(IMAGE_SIZE, digest.c_str()));
+  CHECK(send(ota, image, 0, 4 * CHUNK) == OTA_WRITE_OK);
+
+  // Client reconnects and announces the same image: carry on at the device's offset
+  CHECK(ota.begin(IMAGE_SIZE, digest.c_str()));
+  CHECK(Update.begins == 1);
+  CHECK(ota.getOffset() == 4 * CHUNK);
+  CHECK(send(ota, image, ota.getOffset(), IMAGE_SIZE) == OTA_WRITE_OK);
+  CHECK(ota.getState() == OTA_VERIFIED);
+  CHECK(Update.flash == image);
+
+  // A different image mid-transfer starts over (old one discarded)
+  resetUpdater();
+  OtaSession other;
+  std::vector<uint8_t> next = makeImage(IMAGE_SIZE, 6);
+  CHECK(other.begin(IMAGE_SIZE, digest.c_str()));
+  CHECK(send(other, image, 0, 3 * CHUNK) == OTA_WRITE_OK);
+  CHECK(other.begin(IMAGE_SIZE, sha256Hex(next).c_str()));
+  CHECK(Update.begins == 2);
+  CHECK(Update.discards == 1);
+  CHECK(other.getOffset() == 0);
+  CHECK(send(other, next, 0, IMAGE_SIZE) == OTA_WRITE_OK);
+  CHECK(other.getState() == OTA_VERIFIED);
+  CHECK(Update.flash == next);
+}
+
+static void testFlashError() {
+  printf("flash write error\n");
+  resetUpdater();
+  OtaSession ota;
+  std::vector<uint8_t> image = makeImage(IMAGE_SIZE, 7);
+  CHECK(ota.begin(IMAGE_SIZE, sha256Hex(image).c_str()));
+  CHECK(ota.write(0, image.data(), CHUNK) == OTA_WRITE_OK);
+  Update.failWrites = true;
+  CHECK(ota.write(CHUNK, image.data() + CHUNK, CHUNK) == OTA_WRITE_ERROR);
+  CHECK(ota.getState() == OTA_FAILED);
+  CHECK(!Update.committed);
+}
+
+int main() {
+  testShim();
+  testCleanImage();
+  testBadManifest();
+  testCorruptDigest();
+  testTruncated();
+  testOrdering();
+  testResume();
+  testFlashError();
+
+  printf(failures ? "%d check(s) failed\n" : "all passed\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,82 @@
+/*
+ * Host Arduino Shim
+ * Đủ Arduino API cho các module không phụ thuộc phần cứng khi build env:native
+ * (String, millis/micros, Serial ra stdout) - không dùng trong firmware
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <string>
+
+#define F(s) (s)
+#define PSTR(s) (s)
+
+inline unsigned long millis() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (unsigned long)duration_cast<milliseconds>(steady_clock::now() - start).count();
+}
+
+inline unsigned long micros() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (unsigned long)duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+// Arduino String on top of std::string (what ArduinoJson and SystemData need)
+class String {
+public:
+  String() {}
+  String(const char* s) : str(s ? s : "") {}
+  String(const std::string& s) : str(s) {}
+
+  const char* c_str() const { return str.c_str(); }
+  unsigned int length() const { return str.length(); }
+  bool reserve(unsigned int size) { str.reserve(size); return true; }
+
+  bool concat(const char* s) { if (s) str += s; return true; }
+  bool concat(char c) { str += c; return true; }
+  String& operator+=(const char* s) { concat(s); return *this; }
+  String& operator+=(char c) { concat(c); return *this; }
+
+  bool operator==(const String& other) const { return str == other.str; }
+  bool operator==(const char* s) const { return str == (s ? s : ""); }
+  bool operator!=(const String& other) const { return str != other.str; }
+
+private:
+  std::string str;
+};
+
+// Referenced by ArduinoJson's String adapter
+class StringSumHelper : public String {
+public:
+  using String::String;
+};
+
+class HostSerial {
+public:
+  void begin(unsigned long) {}
+  void print(const char* s) { fputs(s, stdout); }
+  void print(const String& s) { fputs(s.c_str(), stdout); }
+  void print(long v) { ::printf("%ld", v); }
+  void println() { fputc('\n', stdout); }
+  template <typename T> void println(const T& v) { print(v); println(); }
+  void printf(const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+  }
+};
+
+inline HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
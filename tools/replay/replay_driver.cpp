@@ -0,0 +1,274 @@
+/*
+ * Replay Driver
+ * Chạy bản ghi /system-info (server/system_monitor_server.py, RECORD_FILE) qua
+ * parser + AdaptiveRefresh của firmware trên host, không cần ESP hay LHM
+ *
+ *   pio run -e native
+ *   .pio/build/native/program recording.jsonl [--min 500] [--max 10000] [--fixed MS] [--parse-runs 50]
+ *       [--alert cpu_temp:90:85:10[:highlight+flash]]...
+ *
+ * Đồng hồ ảo theo timestamp của bản ghi -> kết quả poll/lag giống hệt nhau mỗi lần chạy.
+ * Chỉ thời gian parse (µs trên host) là đo thật, dùng để so sánh tương đối.
+ */
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <stdlib.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "system_data.h"
+#include "system_data_json.h"
+#include "adaptive_refresh.h"
+#include "alert_engine.h"
+
+#ifndef JSON_POOL_SIZE
+  #define JSON_POOL_SIZE (2048 + 4 * CORE_MAX)  // Same pool as NetworkManager
+#endif
+
+static constexpr size_t LINE_POOL = 8192;  // One recording line (frame + envelope)
+
+struct Frame {
+  unsigned long t;      // ms since the recording started
+  std::string json;     // /system-info body as the bridge sent it
+  SystemData data;
+};
+
+struct Options {
+  const char* path = nullptr;
+  uint16_t minMs = 500;
+  uint16_t maxMs = 10000;
+  uint16_t fixedMs = 0;     // > 0: poll at a fixed interval instead of adaptive
+  int parseRuns = 50;
+  AlertRule alerts[ALERT_RULE_MAX] = {};
+  uint8_t alertCount = 0;
+};
+
+static bool parseFrame(const std::string& json, SystemData& data) {
+  StaticJsonDocument<SystemDataJson::FILTER_CAPACITY> filter;
+  SystemDataJson::buildFilter(filter);
+  DynamicJsonDocument doc(JSON_POOL_SIZE);
+
+  if (deserializeJson(doc, json, DeserializationOption::Filter(filter))) return false;
+  SystemDataJson::parse(doc, data);
+  return true;
+}
+
+static bool loadRecording(const char* path, std::vector<Frame>& frames, unsigned& skipped) {
+  std::ifstream in(path);
+  if (!in) {
+    fprintf(stderr, "Cannot open %s\n", path);
+    return false;
+  }
+
+  DynamicJsonDocument line(LINE_POOL);
+  std::string text;
+  bool header = false;
+  skipped = 0;
+
+  while (std::getline(in, text)) {
+    if (text.empty()) continue;
+    if (deserializeJson(line, text)) {
+      skipped++;
+      continue;
+    }
+
+    if (!header) {
+      if ((line["hwmon_rec"] | 0) != 1) {
+        fprintf(stderr, "%s: not a recording (missing hwmon_rec header)\n", path);
+        return false;
+      }
+      printf("Recording: %s, host %s, sampled every %lums\n", path,
+             line["host"] | "?", (unsigned long)(line["interval"] | 0));
+      header = true;
+      continue;
+    }
+
+    // Bridge errors (LHM down) are kept in the file but carry no metrics
+    JsonObjectConst body = line["d"].as<JsonObjectConst>();
+    if (body.isNull() || body.containsKey("error")) {
+      skipped++;
+      continue;
+    }
+
+    Frame frame;
+    frame.t = line["t"] | 0UL;
+    serializeJson(body, frame.json);
+    if (!parseFrame(frame.json, frame.data)) {
+      skipped++;
+      continue;
+    }
+    frames.push_back(frame);
+  }
+  return header;
+}
+
+// Poll the recording the way the main loop does: at each poll the device
+// sees the newest frame, then waits the interval the scheduler returns
+static void simulate(const std::vector<Frame>& frames, const Options& opt) {
+  AdaptiveRefresh adaptive(opt.minMs, opt.maxMs);
+  adaptive.reset(0);
+
+  unsigned long end = frames.back().t;
+  unsigned long now = frames.front().t;
+  size_t seen = 0;          // Frames with t <= now
+  size_t lastShown = SIZE_MAX;
+  unsigned long polls = 0, shown = 0;
+  unsigned long lagSum = 0, lagMax = 0;   // Frame arrival -> first poll that shows it
+  unsigned long intervalMin = UINT32_MAX, intervalMax = 0;
+
+  while (now <= end) {
+    while (seen < frames.size() && frames[seen].t <= now) seen++;
+    size_t current = seen - 1;
+    polls++;
+
+    if (current != lastShown) {
+      unsigned long lag = now - frames[current].t;
+      lagSum += lag;
+      if (lag > lagMax) lagMax = lag;
+      shown++;
+      lastShown = current;
+    }
+
+    unsigned long interval = opt.fixedMs ? opt.fixedMs : adaptive.update(frames[current].data, now);
+    if (interval < intervalMin) intervalMin = interval;
+    if (interval > intervalMax) intervalMax = interval;
+    now += interval;
+  }
+
+  unsigned long span = end - frames.front().t;
+  printf("\nSchedule (%s)\n", opt.fixedMs ? "fixed" : "adaptive");
+  printf("  span          %lu.%lus\n", span / 1000, (span % 1000) / 100);
+  printf("  polls         %lu (%.1f/min)\n", polls, span ? polls * 60000.0 / span : 0.0);
+  printf("  interval      %lu..%lums\n", intervalMin, intervalMax);
+  printf("  frames shown  %lu of %zu\n", shown, frames.size());
+  printf("  lag           avg %lums, max %lums\n", shown ? lagSum / shown : 0, lagMax);
+}
+
+static void benchmarkParse(const std::vector<Frame>& frames, int runs) {
+  if (runs <= 0) return;
+
+  size_t bytes = 0;
+  unsigned long start = micros();
+  for (int run = 0; run < runs; run++) {
+    for (const Frame& frame : frames) {
+      SystemData data;
+      parseFrame(frame.json, data);
+      if (run == 0) bytes += frame.json.size();
+    }
+  }
+  unsigned long elapsed = micros() - start;
+  unsigned long count = (unsigned long)runs * frames.size();
+
+  printf("\nParse (host, filter + SystemDataJson::parse)\n");
+  printf("  frames        %lu x %d runs, avg %zu bytes\n", (unsigned long)frames.size(), runs,
+         bytes / frames.size());
+  printf("  per frame     %.2fus\n", (double)elapsed / count);
+}
+
+// metric:raise:clear:sustainS[:highlight+flash+pulse] (actions default to highlight)
+static bool parseAlert(const char* spec, AlertRule& rule) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%s", spec);
+  char* fields[5] = {};
+  uint8_t n = 0;
+  for (char* tok = strtok(buf, ":"); tok && n < 5; tok = strtok(nullptr, ":")) fields[n++] = tok;
+  if (n < 4) return false;
+
+  int8_t metric = AlertEngine::metricFromName(fields[0]);
+  fixed10_t raise, clear;
+  if (metric < 0 || !Fixed10::parse(fields[1], raise) || !Fixed10::parse(fields[2], clear)) return false;
+
+  uint8_t actions = ALERT_HIGHLIGHT;
+  if (n == 5) {
+    actions = 0;
+    if (strstr(fields[4], "highlight")) actions |= ALERT_HIGHLIGHT;
+    if (strstr(fields[4], "flash")) actions |= ALERT_FLASH;
+    if (strstr(fields[4], "pulse")) actions |= ALERT_PULSE;
+    if (actions == 0) return false;
+  }
+  rule = { (uint8_t)metric, actions, (int16_t)raise, (int16_t)clear, (uint8_t)atoi(fields[3]) };
+  return true;
+}
+
+// Every frame through AlertEngine on the recording's clock: when each rule trips and clears
+static void simulateAlerts(const std::vector<Frame>& frames, const Options& opt) {
+  if (opt.alertCount == 0) return;
+
+  AlertEngine engine;
+  engine.setRules(opt.alerts, opt.alertCount);
+  bool wasActive[ALERT_RULE_MAX] = {};
+  unsigned long since[ALERT_RULE_MAX] = {};
+  unsigned long activeMs[ALERT_RULE_MAX] = {};
+  unsigned trips[ALERT_RULE_MAX] = {};
+  unsigned long start = frames.front().t;
+
+  printf("\nAlerts\n");
+  for (const Frame& frame : frames) {
+    if (!engine.update(frame.data, frame.t)) continue;
+    for (uint8_t i = 0; i < engine.getRuleCount(); i++) {
+      if (engine.isActive(i) == wasActive[i]) continue;
+      wasActive[i] = engine.isActive(i);
+      char value[12];
+      Fixed10::format(value, sizeof(value), AlertEngine::metricValue(frame.data, engine.getRule(i).metric));
+      unsigned long at = frame.t - start;
+      printf("  %6lu.%lus  %-5s  #%u %s = %s\n", at / 1000, (at % 1000) / 100,
+             wasActive[i] ? "RAISE" : "CLEAR", i, AlertEngine::metricName(engine.getRule(i).metric), value);
+      if (wasActive[i]) {
+        trips[i]++;
+        since[i] = frame.t;
+      } else {
+        activeMs[i] += frame.t - since[i];
+      }
+    }
+  }
+  for (uint8_t i = 0; i < engine.getRuleCount(); i++) {
+    if (wasActive[i]) activeMs[i] += frames.back().t - since[i];
+    printf("  #%u %-10s trips %u, active %lu.%lus\n", i, AlertEngine::metricName(engine.getRule(i).metric),
+           trips[i], activeMs[i] / 1000, (activeMs[i] % 1000) / 100);
+  }
+}
+
+static void usage() {
+  fprintf(stderr, "Usage: replay_driver <recording.jsonl> [--min MS] [--max MS] [--fixed MS] [--parse-runs N]\n"
+                  "                     [--alert metric:raise:clear:sustainS[:highlight+flash+pulse]]...\n");
+}
+
+int main(int argc, char** argv) {
+  Options opt;
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+    if (!strcmp(argv[i], "--min") && hasValue) opt.minMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--max") && hasValue) opt.maxMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--fixed") && hasValue) opt.fixedMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--parse-runs") && hasValue) opt.parseRuns = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--alert") && hasValue && opt.alertCount < ALERT_RULE_MAX &&
+             parseAlert(argv[i + 1], opt.alerts[opt.alertCount])) {
+      opt.alertCount++;
+      i++;
+    }
+    else if (argv[i][0] != '-' && !opt.path) opt.path = argv[i];
+    else {
+      usage();
+      return 2;
+    }
+  }
+  if (!opt.path || opt.minMs == 0 || opt.maxMs < opt.minMs) {
+    usage();
+    return 2;
+  }
+
+  std::vector<Frame> frames;
+  unsigned skipped = 0;
+  if (!loadRecording(opt.path, frames, skipped)) return 1;
+  if (frames.empty()) {
+    fprintf(stderr, "No usable frames (%u skipped)\n", skipped);
+    return 1;
+  }
+  printf("Frames: %zu (%u skipped)\n", frames.size(), skipped);
+
+  simulate(frames, opt);
+  simulateAlerts(frames, opt);
+  benchmarkParse(frames, opt.parseRuns);
+  return 0;
+}
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+Web Asset Embedder
+Converts web/*.html into PROGMEM arrays in include/web_assets.h
+
+- <link rel='stylesheet' href='x.css'> and <script src='x.js'> pointing at
+  files in web/ are inlined, so every page is served in a single request
+- Pages without placeholders are gzip-compressed (served with
+  Content-Encoding: gzip)
+- Pages containing {{KEY}} placeholders are stored as plain templates and
+  streamed by WebPage::sendTemplate()
+
+Runs automatically before each PlatformIO build (extra_scripts), or manually:
+    python web/embed_web_assets.py
+"""
+
+import gzip
+import os
+import re
+
+HEADER_NAME = 'web_assets.h'
+PLACEHOLDER = re.compile(r'\{\{[A-Z0-9_]+\}\}')
+STYLE_LINK = re.compile(r"<link\s+rel=['\"]stylesheet['\"]\s+href=['\"]([\w.-]+\.css)['\"]\s*/?>")
+SCRIPT_SRC = re.compile(r"<script\s+src=['\"]([\w.-]+\.js)['\"]\s*>\s*</script>")
+
+
+def project_dir():
+    try:
+        Import('env')  # noqa: F821 - provided by PlatformIO/SCons
+        return env.subst('$PROJECT_DIR')  # noqa: F821
+    except NameError:
+        return os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def read_text(path):
+    with open(path, 'r', encoding='utf-8') as f:
+        return f.read()
+
+
+def inline_assets(html, web_dir):
+    """Replace local stylesheet/script references with their contents"""
+    def style(m):
+        return '<style>\n' + read_text(os.path.join(web_dir, m.group(1))) + '</style>'
+
+    def script(m):
+        return '<script>\n' + read_text(os.path.join(web_dir, m.group(1))) + '</script>'
+
+    html = STYLE_LINK.sub(style, html)
+    return SCRIPT_SRC.sub(script, html)
+
+
+def minify(text):
+    """Drop indentation and blank lines (keeps newlines so JS/text stay valid)"""
+    lines = (line.strip() for line in text.splitlines())
+    return '\n'.join(line for line in lines if line)
+
+
+def c_bytes(data, per_line=16):
+    rows = []
+    for i in range(0, len(data), per_line):
+        rows.append('  ' + ', '.join('0x%02x' % b for b in data[i:i + per_line]) + ',')
+    return '\n'.join(rows)
+
+
+def c_string(text):
+    """One quoted literal per line; non-ASCII bytes as octal escapes"""
+    rows = []
+    for line in text.split('\n'):
+        esc = ''
+        for b in (line + '\n').encode('utf-8'):
+            c = chr(b)
+            if c in '\\"':
+                esc += '\\' + c
+            elif c == '\n':
+                esc += '\\n'
+            elif 32 <= b < 127:
+                esc += c
+            else:
+                esc += '\\%03o' % b
+        rows.append('  "%s"' % esc)
+    return '\n'.join(rows)
+
+
+def symbol_for(filename):
+    stem = os.path.splitext(filename)[0]
+    return 'WEB_' + re.sub(r'[^A-Za-z0-9]', '_', stem).upper()
+
+
+def build_header(web_dir):
+    out = [
+        '/*',
+        ' * Web Assets (GENERATED - do not edit)',
+        ' * Sinh tự động bởi web/embed_web_assets.py từ các file trong web/',
+        ' */',
+        '',
+        '#ifndef WEB_ASSETS_H',
+        '#define WEB_ASSETS_H',
+        '',
+        '#include <Arduino.h>',
+        '',
+    ]
+
+    for name in sorted(os.listdir(web_dir)):
+        if not name.endswith('.html'):
+            continue
+
+        page = minify(inline_assets(read_text(os.path.join(web_dir, name)), web_dir))
+        raw = page.encode('utf-8')
+        sym = symbol_for(name)
+
+        if PLACEHOLDER.search(page):
+            keys = sorted(set(k[2:-2] for k in PLACEHOLDER.findall(page)))
+            out.append('// %s: template, %d bytes, keys: %s' % (name, len(raw), ', '.join(keys)))
+            out.append('static const char %s_TPL[] PROGMEM =' % sym)
+            out.append(c_string(page) + ';')
+        else:
+            packed = gzip.compress(raw, compresslevel=9, mtime=0)
+            out.append('// %s: %d -> %d bytes (gzip)' % (name, len(raw), len(packed)))
+            out.append('static const uint8_t %s_GZ[] PROGMEM = {' % sym)
+            out.append(c_bytes(packed))
+            out.append('};')
+            out.append('static const size_t %s_GZ_LEN = %d;' % (sym, len(packed)))
+        out.append('')
+
+    out.append('#endif // WEB_ASSETS_H')
+    out.append('')
+    return '\n'.join(out)
+
+
+def main():
+    root = project_dir()
+    web_dir = os.path.join(root, 'web')
+    target = os.path.join(root, 'include', HEADER_NAME)
+
+    content = build_header(web_dir)
+
+    # Only touch the header when something changed (avoids needless rebuilds)
+    if os.path.exists(target) and read_text(target) == content:
+        return
+
+    with open(target, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(content)
+    print('✓ Generated include/%s' % HEADER_NAME)
+
+
+main()
@@ -0,0 +1,122 @@
+const area = document.getElementById('uploadArea');
+const input = document.getElementById('fileInput');
+const btn = document.getElementById('uploadBtn');
+const form = document.getElementById('uploadForm');
+const fileName = document.getElementById('fileName');
+const fileSize = document.getElementById('fileSize');
+const progress = document.getElementById('progress');
+const progressFill = document.getElementById('progressFill');
+const status = document.getElementById('status');
+
+function pick(f) {
+  fileName.textContent = f.name;
+  fileSize.textContent = (f.size / 1024).toFixed(1) + 'KB';
+  btn.disabled = false;
+}
+
+area.onclick = () => input.click();
+input.onchange = e => {
+  const f = e.target.files[0];
+  if (f) pick(f);
+};
+
+['dragover', 'dragenter'].forEach(e => area.addEventListener(e, ev => {
+  ev.preventDefault();
+  area.classList.add('dragover');
+}));
+['dragleave', 'drop'].forEach(e => area.addEventListener(e, () => area.classList.remove('dragover')));
+area.addEventListener('drop', e => {
+  e.preventDefault();
+  const f = e.dataTransfer.files[0];
+  if (f && /\.bin(\.gz)?$/.test(f.name)) {
+    input.files = e.dataTransfer.files;
+    pick(f);
+  }
+});
+
+const CHUNK = 16384;      // Bytes per POST
+const RETRIES = 5;       // Attempts per chunk before giving up
+
+function fail(msg) {
+  status.textContent = msg;
+  status.className = 'status error';
+  btn.disabled = false;
+}
+
+function rateText(info) {
+  let text = info.rate.toFixed(1) + ' KB/s';
+  if (info.effective > info.rate) text += ' (effective ' + info.effective.toFixed(1) + ' KB/s)';
+  return text;
+}
+
+function showProgress(offset, size, info) {
+  const p = Math.floor(offset / size * 100);
+  progressFill.style.width = p + '%';
+  progressFill.textContent = p + '%';
+  status.textContent = 'Uploading... ' + rateText(info);
+}
+
+// .bin.gz: uncompressed size is the gzip ISIZE trailer (last 4 bytes, LE)
+function rawSize(data) {
+  const bytes = new Uint8Array(data);
+  if (bytes.length < 18 || bytes[0] !== 0x1f || bytes[1] !== 0x8b) return 0;
+  return new DataView(data).getUint32(data.byteLength - 4, true);
+}
+
+async function api(path, body) {
+  const res = await fetch(path, {method: body === undefined ? 'GET' : 'POST', body: body});
+  const info = await res.json();
+  info.httpStatus = res.status;
+  return info;
+}
+
+// Send [offset, offset+CHUNK); device answers with the offset it wants next
+async function sendChunk(data, offset) {
+  const fd = new FormData();
+  fd.append('firmware', new Blob([data.slice(offset, offset + CHUNK)]), 'chunk.bin');
+  return api('/ota/chunk?offset=' + offset, fd);
+}
+
+async function upload(f) {
+  status.className = 'status';
+  status.textContent = 'Hashing...';
+  const data = await f.arrayBuffer();
+  const sha = await digestHex(data);
+
+  // Starts a new session, or resumes the same image after a dropout
+  let info = await api('/ota/begin?size=' + data.byteLength + '&sha256=' + sha + '&raw=' + rawSize(data), '');
+  if (info.httpStatus !== 200) return fail('Rejected: ' + info.error);
+
+  let offset = info.offset;
+  let tries = 0;
+  while (info.state === 'receiving') {
+    try {
+      info = await sendChunk(data, offset);
+      tries = 0;
+    } catch (e) {
+      // Connection dropped - ask where the device got to, then resume
+      if (++tries > RETRIES) return fail('Upload interrupted at ' + offset + ' bytes');
+      await new Promise(r => setTimeout(r, 1000 * tries));
+      try { info = await api('/ota/status'); } catch (e2) { continue; }
+    }
+    if (info.state === 'failed') return fail('Upload failed: ' + info.error);
+    offset = info.offset;
+    showProgress(offset, data.byteLength, info);
+  }
+
+  if (info.state !== 'verified') return fail('Upload failed!');
+  progressFill.style.width = '100%';
+  progressFill.textContent = '100%';
+  status.textContent = 'Verified (' + rateText(info) + '). Rebooting...';
+  status.className = 'status success';
+  setTimeout(() => location.href = '/', 5000);
+}
+
+form.onsubmit = e => {
+  e.preventDefault();
+  const f = input.files[0];
+  if (!f) return;
+  btn.disabled = true;
+  progress.style.display = 'block';
+  upload(f).catch(err => fail('Upload error: ' + err.message));
+};